@@ -7,6 +7,8 @@
 
 # Here are some related function options:
 # DYE_FORCE_GENERATE_CODE - If enabled, the build function will always re-generate code for DYEditor::TypeRegistry even if the user code is unchanged.
+# DYE_LEAN_RUNTIME_WORLD - If enabled, runtime executables are built with a lean World, see World.h.
+# DYE_LEAN_RUNTIME_WORLD_WITHOUT_GUID_MAP - If enabled together with DYE_LEAN_RUNTIME_WORLD, the lean World doesn't keep a GUID lookup.
 
 # Build editor executable target called <NAME> from the given sources and generated code.
 function(DYEditor_AddEditorExecutable NAME SOURCE_ROOT_DIR INCLUDE_DIRS SOURCE_FILES HEADER_FILES)
@@ -23,6 +25,7 @@ function(DYEditor_AddEditorExecutable NAME SOURCE_ROOT_DIR INCLUDE_DIRS SOURCE_F
     # see - https://stackoverflow.com/questions/49049463/how-to-remove-definitions-per-target-in-cmake-2-8-12
     get_target_property(definitions DYEditor COMPILE_DEFINITIONS)
     list(FILTER definitions EXCLUDE REGEX [[^DYE_RUNTIME$]])
+    list(FILTER definitions EXCLUDE REGEX [[^DYE_LEAN_RUNTIME_WORLD]])
     set_property(TARGET DYEditor PROPERTY COMPILE_DEFINITIONS ${definitions})
 
 endfunction()
@@ -37,6 +40,16 @@ function(DYEditor_AddRuntimeExecutable NAME SOURCE_ROOT_DIR INCLUDE_DIRS SOURCE_
     target_compile_definitions(${NAME} PUBLIC DYE_RUNTIME)
     target_compile_definitions(DYEditor PUBLIC DYE_RUNTIME)
 
+    if (DYE_LEAN_RUNTIME_WORLD)
+        target_compile_definitions(${NAME} PUBLIC DYE_LEAN_RUNTIME_WORLD)
+        target_compile_definitions(DYEditor PUBLIC DYE_LEAN_RUNTIME_WORLD)
+
+        if (DYE_LEAN_RUNTIME_WORLD_WITHOUT_GUID_MAP)
+            target_compile_definitions(${NAME} PUBLIC DYE_LEAN_RUNTIME_WORLD_WITHOUT_GUID_MAP)
+            target_compile_definitions(DYEditor PUBLIC DYE_LEAN_RUNTIME_WORLD_WITHOUT_GUID_MAP)
+        endif ()
+    endif ()
+
     # Remove DYE_EDITOR from DYEditor library explicitly because
     # users might also call DYEditor_AddEditorExecutable in the same CMakeLists.txt.
     # see - https://stackoverflow.com/questions/49049463/how-to-remove-definitions-per-target-in-cmake-2-8-12
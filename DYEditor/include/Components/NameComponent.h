@@ -1,11 +1,12 @@
 #pragma once
 
-#include <string>
+#include "Util/InternedName.h"
 
 namespace DYE::DYEditor
 {
     struct NameComponent
     {
-        std::string Name;
+        /// Use Entity::SetName to rename an entity, so the change is visible to World's name index.
+        InternedName Name;
     };
 }
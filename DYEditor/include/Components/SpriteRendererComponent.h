@@ -3,6 +3,7 @@
 #include "Core/EditorProperty.h"
 #include "Math/Color.h"
 #include "Graphics/Texture.h"
+#include "Graphics/TextureAtlas.h"
 
 namespace DYE::DYEditor
 {
@@ -12,5 +13,14 @@ namespace DYE::DYEditor
         glm::vec4 Color = Color::White;
         DYE::AssetPath TextureAssetPath;
         std::shared_ptr<Texture2D> Texture = Texture2D::GetDefaultTexture();
+
+        /// If assigned, the sprite is rendered with the region of the atlas instead of TextureAssetPath,
+        /// all the sprites on the same atlas share one texture.
+        DYE::AssetPath AtlasAssetPath;
+        DYE::String AtlasRegionName;
+        std::shared_ptr<TextureAtlas> Atlas;
+
+        /// The scale (xy) & offset (zw) of the texture coordinates, it's the rect of the region if the sprite is on an atlas.
+        glm::vec4 TilingOffset = {1, 1, 0, 0};
     };
-}
\ No newline at end of file
+}
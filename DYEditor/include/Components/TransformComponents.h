@@ -81,6 +81,35 @@ namespace DYE::DYEditor
         }
     };
 
+    /// Render the entity between the local transforms of the last two FixedUpdates instead of the latest one,
+    /// so that the motion simulated in FixedUpdate looks smooth even if the fixed rate is lower than the frame rate.
+    /// The rendered transform is one fixed step behind the simulation.
+    /// A transform that is moved outside FixedUpdate (i.e. teleported in Update) is blended with the stale snapshot until the next FixedUpdate.
+    struct InterpolateTransformComponent
+    {
+        /// The local transform before the last FixedUpdate, taken by SnapshotTransformsForInterpolation. It is not serialized.
+        LocalTransformComponent PreviousLocalTransform;
+        bool HasPreviousLocalTransform = false;
+
+        /// \param alpha see Time::FixedUpdateInterpolationAlpha
+        glm::mat4 GetInterpolatedTransformMatrix(LocalTransformComponent const &currentLocalTransform, float alpha) const
+        {
+            if (!HasPreviousLocalTransform)
+            {
+                return currentLocalTransform.GetTransformMatrix();
+            }
+
+            LocalTransformComponent const interpolatedLocalTransform
+                {
+                    .Position = glm::mix(PreviousLocalTransform.Position, currentLocalTransform.Position, alpha),
+                    .Scale = glm::mix(PreviousLocalTransform.Scale, currentLocalTransform.Scale, alpha),
+                    .Rotation = glm::slerp(PreviousLocalTransform.Rotation, currentLocalTransform.Rotation, alpha)
+                };
+
+            return interpolatedLocalTransform.GetTransformMatrix();
+        }
+    };
+
     namespace Internal
     {
         /// This component is only meant for Editor,
@@ -20,6 +20,23 @@ namespace DYE::DYEditor
         constexpr char const *MainWindowHeight = "Window.Main.Height";
         constexpr char const *MainWindowFullScreenMode = "Window.Main.FullScreenMode";
         constexpr char const *SubWindows = "Window.SubWindows";
+        /// If true, the frames are rendered on a dedicated render thread (see Application::SetThreadedRendering).
+        constexpr char const *ThreadedRendering = "Rendering.ThreadedRendering";
+        /// If not empty, the input of the session is recorded into the file at the path.
+        constexpr char const *InputRecordingPath = "Debug.Input.RecordTo";
+        /// If not empty, the input of the session is replayed from the recording file at the path.
+        constexpr char const *InputReplayPath = "Debug.Input.ReplayFrom";
+        /// If not 0, the entity GUIDs are generated deterministically from the 64-bit seed (i.e. for headless runs & tests).
+        /// A replay uses the seed stored in the recording instead. Neither is applied in the windowed editor, whose worlds are saved as scenes.
+        constexpr char const *GUIDSeed = "Debug.GUIDSeed";
+        /// If true, the application runs without a window, graphics context, audio & imgui (i.e. for benchmarks on CI).
+        constexpr char const *HeadlessEnabled = "Debug.Headless.Enabled";
+        /// The number of frames before a headless run exits, 0 means no limit.
+        constexpr char const *HeadlessMaxFrames = "Debug.Headless.MaxFrames";
+        /// The duration (in seconds) before a headless run exits, 0 means no limit.
+        constexpr char const *HeadlessMaxSeconds = "Debug.Headless.MaxSeconds";
+        /// If true, a headless run advances the time by the fixed delta time every frame instead of the real time.
+        constexpr char const *HeadlessUseFixedDeltaTime = "Debug.Headless.FixedDeltaTime";
     }
 
     namespace EditorConfigKeys
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Core/EntityTypes.h"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace DYE::DYEditor
+{
+    using ComponentChangeSubscriptionID = std::uint32_t;
+
+    /// The entities whose component has changed since the set was last cleared, each entity appears at most once per set.
+    /// A component that is added & then removed before the set is cleared doesn't appear in any of the sets.
+    struct ComponentChangeSet
+    {
+        entt::sparse_set Added;
+        /// Only the updates done through registry.patch/replace are observed, modifying a component through a reference is not noticed.
+        entt::sparse_set Updated;
+        /// The component is no longer on the entity, and the entity itself might have been destroyed as well.
+        entt::sparse_set Removed;
+
+        void Clear();
+    };
+
+    /// Record the changes of a component type in a registry, built on top of the on_construct/on_update/on_destroy signals.
+    /// Every subscriber owns a change set, which is cleared by the subscriber once it has consumed the changes.
+    /// Use World::GetComponentChangeStream to get the stream of a component type.
+    /// The stream is owned by a shared pointer, hold it with weak_from_this to find out if it is still alive.
+    class ComponentChangeStream : public std::enable_shared_from_this<ComponentChangeStream>
+    {
+    public:
+        explicit ComponentChangeStream(entt::sparse_set const &pool) : m_pPool(&pool) {}
+        ComponentChangeStream(ComponentChangeStream const &other) = delete;
+        ComponentChangeStream &operator=(ComponentChangeStream const &other) = delete;
+
+        /// Create a stream that is connected to the signals of the given component type. The stream should outlive the connections.
+        template<typename Component>
+        static std::shared_ptr<ComponentChangeStream> Create(entt::registry &registry)
+        {
+            auto pStream = std::make_shared<ComponentChangeStream>(registry.storage<Component>());
+            registry.on_construct<Component>().template connect<&ComponentChangeStream::onConstruct>(*pStream);
+            registry.on_update<Component>().template connect<&ComponentChangeStream::onUpdate>(*pStream);
+            registry.on_destroy<Component>().template connect<&ComponentChangeStream::onDestroy>(*pStream);
+
+            return pStream;
+        }
+
+        /// The change set of a new subscription starts with all the entities that currently have the component as Added.
+        ComponentChangeSubscriptionID Subscribe();
+        void Unsubscribe(ComponentChangeSubscriptionID subscriptionID);
+
+        ComponentChangeSet &GetChangeSet(ComponentChangeSubscriptionID subscriptionID);
+        std::size_t GetNumberOfSubscriptions() const;
+
+    private:
+        void onConstruct(entt::registry &, EntityIdentifier entity);
+        void onUpdate(entt::registry &, EntityIdentifier entity);
+        void onDestroy(entt::registry &, EntityIdentifier entity);
+
+        /// The storage of the component type, used to populate new subscriptions.
+        entt::sparse_set const *m_pPool = nullptr;
+
+        /// Indexed by ComponentChangeSubscriptionID, the slots of the removed subscriptions are reused.
+        std::vector<std::optional<ComponentChangeSet>> m_Subscriptions;
+    };
+}
\ No newline at end of file
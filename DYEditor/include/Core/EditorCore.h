@@ -3,6 +3,8 @@
 #include "Core/EditorProperty.h"
 #include "Core/EditorComponent.h"
 #include "Core/EditorSystem.h"
+#include "Core/SystemQuery.h"
+#include "Core/ReactiveSystem.h"
 
 /// Similar to FormerlySerializedAsAttribute in Unity, but on DYE types (i.e., DYE_COMPONENT, DYE_SYSTEM). \n\n
 ///
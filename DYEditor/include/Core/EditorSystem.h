@@ -4,6 +4,7 @@
 #include "World.h"
 
 #include <optional>
+#include <vector>
 
 /// A class marked with this macro will be identified by DYEditor code generator. DYEditor code generator will
 /// then generate code that registers the marked class into TypeRegistry as a system. \n\n
@@ -19,6 +20,8 @@
 
 namespace DYE::DYEditor
 {
+    class SystemQueryBase;
+
     enum class ExecutionMode
     {
         Play,
@@ -78,5 +81,12 @@ namespace DYE::DYEditor
         virtual void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) = 0;
         virtual void DrawInspector(DYE::DYEditor::World &world);
         virtual ~SystemBase() = default;
+
+        /// The queries (see SystemQuery.h) declared as members of the system, in declaration order.
+        std::vector<SystemQueryBase *> const &GetQueries() const { return m_Queries; }
+
+    private:
+        friend class SystemQueryBase;
+        std::vector<SystemQueryBase *> m_Queries;
     };
 }
\ No newline at end of file
@@ -90,9 +90,13 @@ namespace DYE::DYEditor
         }
 
         /// Syntactic sugar for TryGetComponent<NameComponent>().Name
-        /// \return
-        std::optional<std::string> TryGetName();
-        std::string GetName();
+        /// \return the interned name, use GetView/GetString to access the characters.
+        std::optional<InternedName> TryGetName();
+        InternedName GetName();
+
+        /// Rename the entity through entt::registry::patch, which notifies the name index of the world.
+        /// The entity must have a NameComponent.
+        void SetName(InternedName name);
 
         std::optional<GUID> TryGetGUID();
 
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Core/EditorSystem.h"
+#include "Core/ComponentChangeStream.h"
+#include "Core/World.h"
+
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace DYE::DYEditor
+{
+    /// The kinds of change of a component type that trigger a reactive system.
+    struct ReactiveTrigger
+    {
+        bool OnAdded = true;
+        /// Only the updates done through registry.patch/replace are observed.
+        bool OnUpdated = true;
+        bool OnRemoved = false;
+    };
+
+    /// A system that is only given the entities whose components have changed since its last execution,
+    /// so that the work scales with the number of changes instead of the number of entities in the world.
+    /// Declare the triggers in the constructor of the derived system with reactTo, and override ExecuteReactive instead of Execute.
+    /// On the first execution on a world, all the entities that already have the trigger components are given as added.
+    class ReactiveSystemBase : public SystemBase
+    {
+    public:
+        ~ReactiveSystemBase() override;
+
+        void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+        /// \param entities the entities that match any of the triggers, each entity appears once.
+        /// An entity given by an OnRemoved trigger might have been destroyed, check it with registry.valid before accessing it.
+        /// The changes made by the system itself during the execution are given on the next execution.
+        virtual void ExecuteReactive(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params, std::span<EntityIdentifier const> entities) = 0;
+
+        std::size_t GetNumberOfEntitiesLastExecution() const { return m_Entities.size(); }
+
+    protected:
+        template<typename Component>
+        void reactTo(ReactiveTrigger trigger = {})
+        {
+            m_Triggers.push_back({.Trigger = trigger, .GetStream = &getComponentChangeStream<Component>});
+        }
+
+    private:
+        template<typename Component>
+        static ComponentChangeStream &getComponentChangeStream(World &world) { return world.GetComponentChangeStream<Component>(); }
+
+        struct TriggerEntry
+        {
+            ReactiveTrigger Trigger;
+            ComponentChangeStream &(*GetStream)(World &world) = nullptr;
+
+            /// Expires when the subscribed world is destroyed.
+            std::weak_ptr<ComponentChangeStream> pSubscribedStream;
+            ComponentChangeSubscriptionID SubscriptionID = 0;
+        };
+
+        bool isSubscribedTo(World &world) const;
+        /// Unsubscribe from the streams that are still alive.
+        void unsubscribe();
+
+        std::vector<TriggerEntry> m_Triggers;
+
+        /// The subscriptions are made on the first execution on a world, and are kept until the system executes on another world.
+        /// Like SystemQueryBase, the world is identified by its address, the expired streams tell a new world at the same address apart.
+        World *m_pSubscribedWorld = nullptr;
+
+        /// The merged entities of the last execution, kept to retain the capacity.
+        std::vector<EntityIdentifier> m_Entities;
+        /// Keyed by the entity index without the version, each one maps to the same position in m_Entities.
+        entt::sparse_set m_MergedEntityIndices;
+    };
+}
\ No newline at end of file
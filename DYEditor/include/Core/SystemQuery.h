@@ -0,0 +1,182 @@
+#pragma once
+
+#include "Core/EditorSystem.h"
+#include "Core/World.h"
+#include "Core/WorldView.h"
+
+#include <entt/entt.hpp>
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace DYE::DYEditor
+{
+    enum class QueryPoolAccessType
+    {
+        Get,
+        /// The pool is owned (i.e. sorted) by a group.
+        Owned,
+        Exclude
+    };
+
+    std::string CastQueryPoolAccessTypeToString(QueryPoolAccessType accessType);
+
+    struct QueryPoolAccess
+    {
+        std::string_view ComponentTypeName;
+        QueryPoolAccessType AccessType = QueryPoolAccessType::Get;
+    };
+
+    /// The base of the queries that a system declares as its members (i.e. SystemViewQuery<Get_t<A, B>> m_Query {*this};).
+    /// A query caches the entt view/group of the world across frames, it is fetched from the registry again only when
+    /// the system is executed on a different world.
+    /// The query registers itself to the owner system, so that the tooling can list the pools a system touches.
+    /// ForEachChunk uses the scratch buffers of the query, therefore it's not reentrant:
+    /// a query must not be iterated with ForEachChunk again (i.e. from another thread or inside the chunk function) before the call returns.
+    class SystemQueryBase
+    {
+    public:
+        explicit SystemQueryBase(SystemBase &owner);
+        SystemQueryBase(SystemQueryBase const &other) = delete;
+        SystemQueryBase &operator=(SystemQueryBase const &other) = delete;
+        virtual ~SystemQueryBase() = default;
+
+        virtual std::span<QueryPoolAccess const> GetPoolAccesses() const = 0;
+
+        /// Drop the cached view/group, it will be fetched on the next access.
+        /// Call this if the registry of the world is replaced (i.e. move-assigned), the cache is keyed by the registry address.
+        void Reset() { m_pRegistry = nullptr; }
+
+    protected:
+        /// Split m_Entities into chunks of the given size & call the function on every chunk with the given execution policy.
+        template<typename ExecutionPolicy, typename Func>
+        void forEachChunk(ExecutionPolicy &&policy, std::size_t chunkSize, Func func)
+        {
+            chunkSize = std::max<std::size_t>(chunkSize, 1);
+
+            m_Chunks.clear();
+            for (std::size_t first = 0; first < m_Entities.size(); first += chunkSize)
+            {
+                m_Chunks.emplace_back(m_Entities.data() + first, std::min(chunkSize, m_Entities.size() - first));
+            }
+
+            std::for_each(std::forward<ExecutionPolicy>(policy), m_Chunks.begin(), m_Chunks.end(), func);
+        }
+
+        entt::registry *m_pRegistry = nullptr;
+
+        /// Scratch buffers of the chunked iteration, kept to retain the capacity.
+        std::vector<EntityIdentifier> m_Entities;
+        std::vector<std::span<EntityIdentifier const>> m_Chunks;
+    };
+
+    template<typename GetList, typename ExcludeList = Exclude_t<>>
+    class SystemViewQuery;
+
+    /// A cached view of the entities that have all the Components and none of the Excludes.
+    template<typename... Components, typename... Excludes>
+    class SystemViewQuery<Get_t<Components...>, Exclude_t<Excludes...>> final : public SystemQueryBase
+    {
+    public:
+        using ViewType = decltype(std::declval<entt::registry &>().view<Components...>(Exclude<Excludes...>));
+
+        explicit SystemViewQuery(SystemBase &owner) : SystemQueryBase(owner) {}
+
+        ViewType &Get(World &world)
+        {
+            entt::registry &registry = world.GetRegistry();
+            if (m_pRegistry != &registry)
+            {
+                m_View = registry.view<Components...>(Exclude<Excludes...>);
+                m_pRegistry = &registry;
+            }
+
+            return m_View;
+        }
+
+        /// Split the entities in the view into chunks & call func(std::span<EntityIdentifier const> chunk, ViewType &view) on each of them
+        /// with the given execution policy, i.e. std::execution::par to process the chunks on multiple threads.
+        /// You should not add or remove the queried components during the iteration.
+        template<typename ExecutionPolicy, typename Func>
+        void ForEachChunk(ExecutionPolicy &&policy, World &world, std::size_t chunkSize, Func func)
+        {
+            ViewType &view = Get(world);
+
+            m_Entities.assign(view.begin(), view.end());
+
+            forEachChunk(std::forward<ExecutionPolicy>(policy), chunkSize, [&view, &func](std::span<EntityIdentifier const> chunk) { func(chunk, view); });
+        }
+
+        std::span<QueryPoolAccess const> GetPoolAccesses() const final
+        {
+            static std::array<QueryPoolAccess, sizeof...(Components) + sizeof...(Excludes)> const poolAccesses
+                {
+                    QueryPoolAccess {.ComponentTypeName = entt::type_id<Components>().name(), .AccessType = QueryPoolAccessType::Get}...,
+                    QueryPoolAccess {.ComponentTypeName = entt::type_id<Excludes>().name(), .AccessType = QueryPoolAccessType::Exclude}...
+                };
+
+            return poolAccesses;
+        }
+
+    private:
+        ViewType m_View {};
+    };
+
+    template<typename OwnedList, typename GetList = Get_t<>, typename ExcludeList = Exclude_t<>>
+    class SystemGroupQuery;
+
+    /// A cached group that owns the Owned components, see entt::registry::group.
+    /// The group is created on the first access, call Get in InitializeLoad to pay the cost of sorting the pools up front.
+    template<typename... Owned, typename... Components, typename... Excludes>
+    class SystemGroupQuery<TypeList<Owned...>, Get_t<Components...>, Exclude_t<Excludes...>> final : public SystemQueryBase
+    {
+    public:
+        using GroupType = decltype(std::declval<entt::registry &>().group<Owned...>(DYEditor::Get<Components...>, Exclude<Excludes...>));
+
+        explicit SystemGroupQuery(SystemBase &owner) : SystemQueryBase(owner) {}
+
+        GroupType &Get(World &world)
+        {
+            entt::registry &registry = world.GetRegistry();
+            if (m_pRegistry != &registry)
+            {
+                m_Group = registry.group<Owned...>(DYEditor::Get<Components...>, Exclude<Excludes...>);
+                m_pRegistry = &registry;
+            }
+
+            return m_Group;
+        }
+
+        /// Split the entities in the group into chunks & call func(std::span<EntityIdentifier const> chunk, GroupType &group) on each of them
+        /// with the given execution policy, i.e. std::execution::par to process the chunks on multiple threads.
+        /// You should not add or remove the queried components during the iteration.
+        template<typename ExecutionPolicy, typename Func>
+        void ForEachChunk(ExecutionPolicy &&policy, World &world, std::size_t chunkSize, Func func)
+        {
+            GroupType &group = Get(world);
+
+            m_Entities.assign(group.begin(), group.end());
+
+            forEachChunk(std::forward<ExecutionPolicy>(policy), chunkSize, [&group, &func](std::span<EntityIdentifier const> chunk) { func(chunk, group); });
+        }
+
+        std::span<QueryPoolAccess const> GetPoolAccesses() const final
+        {
+            static std::array<QueryPoolAccess, sizeof...(Owned) + sizeof...(Components) + sizeof...(Excludes)> const poolAccesses
+                {
+                    QueryPoolAccess {.ComponentTypeName = entt::type_id<Owned>().name(), .AccessType = QueryPoolAccessType::Owned}...,
+                    QueryPoolAccess {.ComponentTypeName = entt::type_id<Components>().name(), .AccessType = QueryPoolAccessType::Get}...,
+                    QueryPoolAccess {.ComponentTypeName = entt::type_id<Excludes>().name(), .AccessType = QueryPoolAccessType::Exclude}...
+                };
+
+            return poolAccesses;
+        }
+
+    private:
+        GroupType m_Group {};
+    };
+}
@@ -2,17 +2,56 @@
 
 #include "Core/EntityTypes.h"
 #include "Core/WorldView.h"
+#include "Core/ComponentChangeStream.h"
 #include "Core/GUID.h"
+#include "Util/InternedName.h"
 
+#include <memory>
 #include <optional>
 #include <vector>
 #include <unordered_map>
 #include <concepts>
+#include <string>
+#include <tuple>
+#include <type_traits>
 
 namespace DYE::DYEditor
 {
     class Entity;
+    struct IDComponent;
+    struct NameComponent;
+    struct EntityEditorOnlyMetadata;
 
+    /// Describe the entities created by World::CreateEntities.
+    /// On top of the components every entity has (IDComponent & NameComponent), the given component types are added
+    /// with the values in ComponentPrototypes.
+    template<typename... Components>
+    struct EntityArchetype
+    {
+        /// The name shared by all the created entities.
+        InternedName Name;
+        std::tuple<Components...> ComponentPrototypes {};
+    };
+
+    /// An estimation of the memory used by the world to track the entities, excluding the user components.
+    /// The entt storages are counted as component + packed entity + sparse entry per element, ignoring the page slack.
+    struct WorldMemoryStatistics
+    {
+        std::size_t NumberOfEntities = 0;
+        std::size_t EntityHandleBytes = 0;
+        /// The GUID to entity lookup, see DYE_LEAN_RUNTIME_WORLD.
+        std::size_t GUIDLookupBytes = 0;
+        /// IDComponent, NameComponent and EntityEditorOnlyMetadata (in editor build).
+        std::size_t BuiltInComponentBytes = 0;
+
+        std::size_t GetTotalBytes() const { return EntityHandleBytes + GUIDLookupBytes + BuiltInComponentBytes; }
+        float GetBytesPerEntity() const { return NumberOfEntities == 0 ? 0.0f : (float) GetTotalBytes() / (float) NumberOfEntities; }
+    };
+
+    /// In runtime executables, the world can be built in lean mode by enabling the CMake option DYE_LEAN_RUNTIME_WORLD,
+    /// which stores the GUID lookup in a flat array sorted by GUID instead of a node-based hash map.
+    /// DYE_LEAN_RUNTIME_WORLD_WITHOUT_GUID_MAP removes the lookup altogether, finding an entity by GUID becomes a linear search.
+    /// The editor-only metadata is stripped from every runtime build (DYE_EDITOR is not defined).
     class World
     {
         friend class Entity; // We need this so Entity could access world.m_Registry for entt operation.
@@ -38,6 +77,29 @@ namespace DYE::DYEditor
         Entity CreateEntity(std::string const &name);
         Entity CreateEntityAtIndex(std::string const &name, std::size_t index);
         Entity CreateEntityWithGUID(std::string const &name, GUID guid);
+
+        /// Create a batch of entities with the same name & components, and put them at the end of the handle list.
+        /// The storages & the GUID map are reserved up front and the components are inserted per storage,
+        /// which is a lot faster than calling CreateEntity in a loop.
+        /// \return the index of the first created entity in the handle list, the entities are at [index, index + count).
+        template<typename... Components>
+        std::size_t CreateEntities(std::size_t count, EntityArchetype<Components...> const &archetype)
+        {
+            static_assert
+                (
+                    (!std::is_same_v<Components, IDComponent> && ...) && (!std::is_same_v<Components, NameComponent> && ...) &&
+                    (!std::is_same_v<Components, EntityEditorOnlyMetadata> && ...),
+                    "CreateEntities: the built-in components are added to every entity, they cannot be listed in the archetype."
+                );
+
+            std::size_t const firstIndex = m_EntityHandles.size();
+            std::vector<EntityIdentifier> const &identifiers = createEntities(count, archetype.Name);
+
+            (m_Registry.storage<Components>().reserve(m_Registry.storage<Components>().size() + count), ...);
+            (m_Registry.insert<Components>(identifiers.begin(), identifiers.end(), std::get<Components>(archetype.ComponentPrototypes)), ...);
+
+            return firstIndex;
+        }
         Entity WrapIdentifierIntoEntity(EntityIdentifier identifier);
 
         /// This method only destroys the command entity itself in the registry.
@@ -51,6 +113,33 @@ namespace DYE::DYEditor
         Entity DuplicateEntityAndChildren(Entity rootEntityToDuplicate);
 
         std::optional<Entity> TryGetEntityWithGUID(GUID entityGUID);
+
+        /// Find an entity with the given name. If more than one entity has the name, any of them could be returned.
+        /// It is a hash lookup when the name index is enabled, otherwise a linear search over the names (which are compared by handle).
+        std::optional<Entity> TryGetEntityWithName(InternedName name);
+
+        /// The name index is rebuilt lazily after a NameComponent is added, removed or renamed with Entity::SetName.
+        /// A name assigned to NameComponent in place is not noticed by the index.
+        void SetNameIndexEnabled(bool enabled);
+        bool IsNameIndexEnabled() const { return m_pNameIndex != nullptr; }
+        /// Get the change stream of the given component type, it is created & connected to the registry on the first call.
+        /// The stream lives as long as the world does, see ReactiveSystemBase for a system built on top of it.
+        template<typename Component>
+        ComponentChangeStream &GetComponentChangeStream()
+        {
+            std::shared_ptr<ComponentChangeStream> &pStream = m_ComponentChangeStreams[entt::type_hash<Component>::value()];
+            if (pStream == nullptr)
+            {
+                pStream = ComponentChangeStream::Create<Component>(m_Registry);
+            }
+
+            return *pStream;
+        }
+
+        /// Restart the GUID sequence of the world, the same seed always produces the same GUIDs for the created entities.
+        /// See GUIDFactory::SetDeterministicSeed to seed the worlds that are created afterwards.
+        void SetGUIDSeed(std::uint64_t seed) { m_EntityGUIDFactory.SetSeed(seed); }
+
         /// Get the index of the given entity inside Entity Handle array.
         std::optional<std::size_t> TryGetEntityIndex(Entity const &entity);
 
@@ -86,6 +175,8 @@ namespace DYE::DYEditor
 
         entt::registry &GetRegistry() { return m_Registry; };
 
+        WorldMemoryStatistics GetMemoryStatistics();
+
     private:
         /// Create an empty entity that is not tracked by the internal Entity Handle array & GUID map.
         /// You need to make sure to call registerUntrackedEntityAtIndex after adding an IDComponent to the entity.
@@ -95,6 +186,10 @@ namespace DYE::DYEditor
         /// This method is for engine-internally use (e.g. Deserialization, Undo/redo entity creation etc).
         void registerUntrackedEntityAtIndex(Entity entity, std::size_t index);
 
+        /// Create & register the given number of entities with the built-in components, used by CreateEntities.
+        /// \return the identifiers of the created entities, valid until the next call.
+        std::vector<EntityIdentifier> const &createEntities(std::size_t count, InternedName name);
+
         /// This method doesn't destroy the entity's children & update related hierarchy components.
         /// It is meant for engine-internally use (e.g. Undo/redo entity destruction).
         /// You should avoid using this on a single entity but instead on a batch of entity hierarchy.
@@ -108,18 +203,69 @@ namespace DYE::DYEditor
         /// Refresh all the entity cache stored in hierarchy components such as Parent and Children components.
         void refreshAllHierarchyComponentEntityCache();
 
+        void rebuildNameIndex();
+
+        /// Keep the GUID lookup in sync, the implementation depends on DYE_LEAN_RUNTIME_WORLD.
+        void trackGUID(GUID guid, EntityIdentifier identifier);
+        void untrackGUID(GUID guid);
+        std::optional<EntityIdentifier> tryGetTrackedIdentifier(GUID guid);
+        void reserveGUIDLookup(std::size_t capacity);
+        void clearGUIDLookup();
+        std::size_t getGUIDLookupBytes() const;
+
     private:
         struct EntityHandle
         {
             EntityIdentifier Identifier;
         };
 
+        struct NameIndex
+        {
+            std::unordered_map<InternedName, EntityIdentifier> NameToEntityIdentifierMap;
+            bool IsDirty = true;
+
+            /// Connected to the NameComponent signals of the registry.
+            void MarkDirty(entt::registry &, EntityIdentifier) { IsDirty = true; }
+        };
+
         GUIDFactory m_EntityGUIDFactory;
 
         std::vector<EntityHandle> m_EntityHandles;
 
+#if defined(DYE_LEAN_RUNTIME_WORLD) && defined(DYE_LEAN_RUNTIME_WORLD_WITHOUT_GUID_MAP)
+        // No GUID lookup, entities are found by searching through the IDComponent storage.
+#elif defined(DYE_LEAN_RUNTIME_WORLD)
+        struct GUIDEntry
+        {
+            GUID EntityGUID;
+            EntityIdentifier Identifier;
+        };
+
+        void sortGUIDEntries();
+        void removeGUIDEntryTombstones();
+        std::vector<GUIDEntry>::iterator findSortedGUIDEntry(GUID guid);
+
+        /// The entries are sorted by GUID up to m_NumberOfSortedGUIDEntries,
+        /// the ones appended after that are merged into the sorted range on the next lookup.
+        /// Untracked entries are marked as tombstones (null identifier) instead of being erased,
+        /// they are removed when the entries are sorted again or when they take up half of the entries.
+        std::vector<GUIDEntry> m_GUIDEntries;
+        std::size_t m_NumberOfSortedGUIDEntries = 0;
+        std::size_t m_NumberOfGUIDEntryTombstones = 0;
+#else
         using Map = std::unordered_map<GUID, EntityIdentifier>;
         Map m_GUIDToEntityIdentifierMap;
+#endif
+
+        /// Scratch buffers of createEntities, kept to retain the capacity.
+        std::vector<EntityIdentifier> m_CreatedEntityIdentifiers;
+        std::vector<GUID> m_CreatedEntityGUIDs;
+
+        /// Heap allocated so the address connected to the registry signals stays the same when the world is moved.
+        std::unique_ptr<NameIndex> m_pNameIndex;
+
+        /// Keyed by the type hash of the component, the streams are heap allocated for the same reason as the name index.
+        std::unordered_map<entt::id_type, std::shared_ptr<ComponentChangeStream>> m_ComponentChangeStreams;
 
         entt::registry m_Registry;
     };
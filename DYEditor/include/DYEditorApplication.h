@@ -15,6 +15,12 @@ namespace DYE::DYEditor
 
         explicit DYEditorApplication(WindowProperties mainWindowProperties, int fixedFramePerSecond = 60);
 
+        /// Create the application in headless mode, only the runtime layer is pushed and the first scene is loaded in play mode.
+        explicit DYEditorApplication(HeadlessRunProperties headlessRunProperties, int fixedFramePerSecond = 60);
+
         ~DYEditorApplication() final = default;
+
+    private:
+        void startInputRecordingOrReplayBasedOnRuntimeConfig();
     };
 }
\ No newline at end of file
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace DYE::DYEditor
+{
+    /// Pack a folder of sprite images into texture atlas pages (.tga + .tatlas).
+    void DrawTextureAtlasPackerWindow(bool *pIsOpen);
+
+    /// Cook a folder of source images into mipmapped (and optionally block compressed) textures (.dytex).
+    void DrawTextureCookerWindow(bool *pIsOpen);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Graphics/TextureAtlas.h"
+#include "Graphics/TextureAtlasPacker.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace DYE::DYEditor
+{
+    /// A texture atlas file (.tatlas) is the sidecar of an atlas page image,
+    /// it stores the relative path to the page image & the pixel rects of all the regions on the page.
+    class TextureAtlasFile
+    {
+    public:
+        static constexpr char const *Extension = ".tatlas";
+
+        /// Pack the images under the given folder into atlas pages,
+        /// then write '{atlasName}_{pageIndex}.tga' & '{atlasName}_{pageIndex}.tatlas' of each page into the output folder.
+        /// \return the paths to the written atlas files.
+        static std::vector<std::filesystem::path> BuildFromFolder(std::filesystem::path const &folderPath,
+                                                                  std::filesystem::path const &outputFolderPath,
+                                                                  std::string const &atlasName,
+                                                                  TextureAtlasPackerSettings const &settings);
+
+        /// Load the atlas & its page texture from the given atlas file.
+        /// Atlases loaded from the same path share the same instance (as long as it's still alive),
+        /// therefore sprites referencing the same atlas also share the same texture.
+        /// The file is loaded again if it has been written since (i.e. the atlas has been repacked).
+        /// \return the atlas, nullptr if the file cannot be loaded.
+        static std::shared_ptr<TextureAtlas> TryLoad(std::filesystem::path const &path);
+
+    private:
+        struct LoadedAtlas
+        {
+            std::weak_ptr<TextureAtlas> Atlas;
+            std::filesystem::file_time_type LastWriteTime;
+        };
+
+        static bool save(TextureAtlasPage const &page, std::filesystem::path const &imageFileName, std::filesystem::path const &path);
+        static std::string getLoadedAtlasKey(std::filesystem::path const &path) { return path.lexically_normal().generic_string(); }
+
+        /// Atlas file path -> the atlas loaded from it.
+        static std::unordered_map<std::string, LoadedAtlas> s_LoadedAtlases;
+    };
+}
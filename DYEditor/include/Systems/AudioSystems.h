@@ -1,15 +1,19 @@
 #pragma once
 
 #include "Core/EditorSystem.h"
+#include "Core/ReactiveSystem.h"
 
 namespace DYE::DYEditor
 {
-    struct AudioSystem final : public SystemBase
+    /// Start & stop the audio sources with command components. It only visits the entities the commands were added to since the last frame.
+    struct AudioSystem final : public ReactiveSystemBase
     {
         static constexpr char const *TypeName = "Audio System";
 
+        AudioSystem();
+
         ExecutionPhase GetPhase() const override { return ExecutionPhase::Cleanup; }
-        void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) override;
+        void ExecuteReactive(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params, std::span<EntityIdentifier const> entities) override;
     };
 
     struct PlayAudioSourceOnInitializeSystem final : public SystemBase
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Core/EditorSystem.h"
+#include "Core/SystemQuery.h"
+#include "Components/TransformComponents.h"
+#include "Components/SpriteRendererComponent.h"
 
 namespace DYE::DYEditor
 {
@@ -15,6 +18,19 @@ namespace DYE::DYEditor
         void DrawInspector(DYE::DYEditor::World &world) override;
 
     private:
+        /// Compute the render-only LocalToWorld matrices of the entities with InterpolateTransformComponent and their descendants.
+        void computeInterpolatedLocalToWorlds(DYE::DYEditor::World &world, float alpha);
+        /// The parent is interpolated as well, so the children move along with their interpolated ancestors.
+        glm::mat4 getInterpolatedLocalToWorld(DYE::DYEditor::World &world, EntityIdentifier entity, float alpha);
+        void propagateInterpolatedLocalToWorld(DYE::DYEditor::World &world, EntityIdentifier entity, float alpha);
+
+        // We use group here because we know Render2DSpriteSystem is the main critical path for SpriteRendererComponent.
+        SystemGroupQuery<TypeList<SpriteRendererComponent>, Get_t<LocalToWorldComponent>> m_SpriteQuery {*this};
+        SystemViewQuery<Get_t<InterpolateTransformComponent, LocalTransformComponent>> m_InterpolateQuery {*this};
+
+        /// Recomputed every frame in play mode, the entities without an interpolated ancestor are not in the storage
+        /// and are rendered with their LocalToWorldComponent.
+        entt::storage<glm::mat4> m_InterpolatedLocalToWorlds;
         int m_NumberOfRenderedEntitiesLastFrame = 0;
     };
 }
\ No newline at end of file
@@ -1,9 +1,16 @@
 #pragma once
 
 #include "Core/EditorSystem.h"
+#include "Core/SystemQuery.h"
+#include "Components/TransformComponents.h"
+#include "Components/HierarchyComponents.h"
 
 namespace DYE::DYEditor
 {
+    /// Store the current local transforms of the entities with InterpolateTransformComponent as their previous local transforms.
+    /// It is called by the runtime layer before the FixedUpdate systems are executed, regardless of the order of the systems.
+    void SnapshotTransformsForInterpolation(World &world);
+
     struct ComputeLocalToWorldSystem final : public SystemBase
     {
         static constexpr char const *TypeName = "Compute Local To World System";
@@ -13,5 +20,12 @@ namespace DYE::DYEditor
         void InitializeLoad(DYE::DYEditor::World &world, DYE::DYEditor::InitializeLoadParameters) final;
         void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
         void DrawInspector(DYE::DYEditor::World &world) final;
+
+    private:
+        /// The number of root transforms synchronized by one parallel task.
+        static constexpr std::size_t SyncChunkSize = 1024;
+
+        SystemGroupQuery<TypeList<LocalToWorldComponent, LocalTransformComponent>, Get_t<>, Exclude_t<ParentComponent>> m_SyncQuery {*this};
+        SystemViewQuery<Get_t<LocalToWorldComponent, ChildrenComponent>, Exclude_t<ParentComponent>> m_PropagationQuery {*this};
     };
 }
\ No newline at end of file
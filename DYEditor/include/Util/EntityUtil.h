@@ -3,9 +3,64 @@
 #include "Core/Entity.h"
 
 #include <vector>
+#include <type_traits>
 
 namespace DYE::DYEditor::EntityUtil
 {
+    /// A vector borrowed from a thread-local pool for the lifetime of the object, its capacity is kept when it's returned.
+    /// The hierarchy traversal functions use it as the stack, therefore they don't allocate once the pool is warmed up.
+    /// Nested traversals (i.e. traversing inside an iteration function) borrow different vectors.
+    template<typename T>
+    class ScratchVector
+    {
+    public:
+        ScratchVector()
+        {
+            auto &pool = getPool();
+            if (!pool.empty())
+            {
+                m_Elements = std::move(pool.back());
+                pool.pop_back();
+            }
+        }
+
+        ~ScratchVector()
+        {
+            m_Elements.clear();
+            getPool().push_back(std::move(m_Elements));
+        }
+
+        ScratchVector(ScratchVector const &other) = delete;
+        ScratchVector &operator=(ScratchVector const &other) = delete;
+
+        std::vector<T> &Get() { return m_Elements; }
+
+    private:
+        static std::vector<std::vector<T>> &getPool()
+        {
+            thread_local std::vector<std::vector<T>> pool;
+            return pool;
+        }
+
+        std::vector<T> m_Elements;
+    };
+
+    /// Call the iteration function of a traversal.
+    /// \return false if the function returns a bool and it's false (i.e. stop the traversal), otherwise true.
+    template<typename Func, typename... Args>
+    bool invokeIterationFunction(Func &func, Args &&...args)
+    {
+        if constexpr (std::is_same_v<std::invoke_result_t<Func &, Args...>, bool>)
+        {
+            return func(std::forward<Args>(args)...);
+        }
+        else
+        {
+            func(std::forward<Args>(args)...);
+            return true;
+        }
+    }
+
     bool IsFirstDegreeChildOf(Entity potentialChild, Entity potentialParent);
 
     /// Check recursively if potential child is under potential parent's hierarchy.
@@ -17,21 +72,33 @@ namespace DYE::DYEditor::EntityUtil
     /// Get an array of children of the given entity recursively in depth-first order.
     std::vector<Entity> GetAllChildrenPreorder(Entity root);
 
+    /// Append the children of the given entity recursively in depth-first order to the given array.
+    /// Pass in the vector of a ScratchVector to avoid allocation.
+    void GetAllChildrenPreorder(Entity root, std::vector<Entity> &outChildren);
+
+    /// \return the number of entities in the hierarchy of the given root entity, including the root itself.
+    std::size_t CountEntityAndAllChildren(Entity root);
+
     /// Iterate through the entity and its all children (including nth degree children)
     /// using depth-first order (preorder). You should not destroy any entity during the iteration.
+    /// If the function returns a bool, returning false stops the iteration.
     template<typename Func>
     void ForEntityAndEachChildPreorder(Entity root, Func func)
     {
-        std::stack<Entity> entityStack;
-        entityStack.push(root);
+        ScratchVector<Entity> scratchStack;
+        std::vector<Entity> &entityStack = scratchStack.Get();
+        entityStack.push_back(root);
 
         while (!entityStack.empty())
         {
-            Entity entity = entityStack.top();
+            Entity entity = entityStack.back();
+            entityStack.pop_back();
 
-            func(entity);
+            if (!invokeIterationFunction(func, entity))
+            {
+                return;
+            }
 
-            entityStack.pop();
             auto tryGetChild = entity.TryGetComponent<ChildrenComponent>();
             if (!tryGetChild.has_value())
             {
@@ -49,7 +116,7 @@ namespace DYE::DYEditor::EntityUtil
                     continue;
                 }
                 // Push the child into the stack.
-                entityStack.push(tryGetEntityWithGUID.value());
+                entityStack.push_back(tryGetEntityWithGUID.value());
             }
         }
     }
@@ -57,6 +124,7 @@ namespace DYE::DYEditor::EntityUtil
     /// Iterate through the entity and its all children (including nth degree children)
     /// using depth-first order (preorder). The second parameter of the function will be the relative depth to the root entity.
     /// You should not destroy any entity during the iteration.
+    /// If the function returns a bool, returning false stops the iteration.
     template<typename Func>
     void ForEntityAndEachChildPreorderWithDepth(Entity root, Func func)
     {
@@ -66,17 +134,21 @@ namespace DYE::DYEditor::EntityUtil
             int Depth = 0;
         };
 
-        std::stack<Element> entityStack;
-        entityStack.push({.Entity = root, .Depth = 0});
+        ScratchVector<Element> scratchStack;
+        std::vector<Element> &entityStack = scratchStack.Get();
+        entityStack.push_back({.Entity = root, .Depth = 0});
 
         while (!entityStack.empty())
         {
-            Element element = entityStack.top();
+            Element element = entityStack.back();
             Entity entity = element.Entity;
+            entityStack.pop_back();
 
-            func(entity, element.Depth);
+            if (!invokeIterationFunction(func, entity, element.Depth))
+            {
+                return;
+            }
 
-            entityStack.pop();
             auto tryGetChild = entity.TryGetComponent<ChildrenComponent>();
             if (!tryGetChild.has_value())
             {
@@ -94,7 +166,7 @@ namespace DYE::DYEditor::EntityUtil
                     continue;
                 }
                 // Push the child into the stack.
-                entityStack.push({.Entity = tryGetEntityWithGUID.value(), .Depth = element.Depth + 1});
+                entityStack.push_back({.Entity = tryGetEntityWithGUID.value(), .Depth = element.Depth + 1});
             }
         }
     }
@@ -102,26 +174,31 @@ namespace DYE::DYEditor::EntityUtil
     /// Iterate through all children (including nth degree children)
     /// using depth-first order (preorder). You should not destroy any entity during the iteration.
     /// If you really have to, consider using GetAllChildrenPreorder to get an array of children.
+    /// If the function returns a bool, returning false stops the iteration.
     template<typename Func>
     void ForEachChildPreorder(Entity root, Func func)
     {
-        std::stack<Entity> entityStack;
-        entityStack.push(root);
+        ScratchVector<Entity> scratchStack;
+        std::vector<Entity> &entityStack = scratchStack.Get();
+        entityStack.push_back(root);
 
         bool isRoot = true;
 
         while (!entityStack.empty())
         {
-            Entity entity = entityStack.top();
+            Entity entity = entityStack.back();
+            entityStack.pop_back();
 
             // We use a flag to skip the first entity in the stack (which is the parent).
             if (!isRoot)
             {
-                func(entity);
+                if (!invokeIterationFunction(func, entity))
+                {
+                    return;
+                }
             }
             isRoot = false;
 
-            entityStack.pop();
             auto tryGetChild = entity.TryGetComponent<ChildrenComponent>();
             if (!tryGetChild.has_value())
             {
@@ -139,7 +216,7 @@ namespace DYE::DYEditor::EntityUtil
                     continue;
                 }
                 // Push the child into the stack.
-                entityStack.push(tryGetEntityWithGUID.value());
+                entityStack.push_back(tryGetEntityWithGUID.value());
             }
         }
     }
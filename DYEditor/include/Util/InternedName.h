@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace DYE::DYEditor
+{
+    /// A handle to a string stored in the global name pool.
+    /// Interning the same string twice gives the same handle, so the entities that share a name also share the memory,
+    /// copying a name is copying a pointer and comparing two names is comparing two pointers.
+    /// The pool is append-only: pooled strings are never released, the views are valid until the program exits.
+    /// Therefore, avoid interning an unbounded number of unique strings (i.e. per-frame or per-keystroke names).
+    /// Interning is guarded by a mutex, names can be created on any thread.
+    class InternedName
+    {
+    public:
+        /// Create an empty name.
+        InternedName();
+        InternedName(std::string_view name);
+        InternedName(std::string const &name) : InternedName(std::string_view(name)) {}
+        InternedName(char const *name) : InternedName(std::string_view(name)) {}
+
+        /// \return a view of the pooled string, it stays valid even after the name is reassigned.
+        std::string_view GetView() const { return *m_pString; }
+
+        /// \return the pooled string, which is null-terminated and therefore can be passed to C-style APIs (i.e. ImGui).
+        std::string const &GetString() const { return *m_pString; }
+
+        bool IsEmpty() const { return m_pString->empty(); }
+
+        bool operator==(InternedName const &other) const { return m_pString == other.m_pString; }
+        bool operator!=(InternedName const &other) const { return m_pString != other.m_pString; }
+
+        /// \return the number of unique strings in the name pool.
+        static std::size_t GetNumberOfPooledNames();
+
+    private:
+        friend struct std::hash<InternedName>;
+
+        std::string const *m_pString = nullptr;
+    };
+}
+
+namespace std
+{
+    template<>
+    struct hash<DYE::DYEditor::InternedName>
+    {
+        std::size_t operator()(DYE::DYEditor::InternedName const &name) const
+        {
+            // Equal names always point to the same pooled string.
+            return hash<std::string const *>()(name.m_pString);
+        }
+    };
+}
@@ -0,0 +1,125 @@
+#include "ImGui/AssetToolWindows.h"
+
+#include "Serialization/TextureAtlasFile.h"
+#include "Graphics/TextureCooker.h"
+#include "ImGui/ImGuiUtil.h"
+
+#include <imgui.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace DYE::DYEditor
+{
+    void DrawTextureAtlasPackerWindow(bool *pIsOpen)
+    {
+        static std::string sourceFolder = "assets/Textures";
+        static std::string outputFolder = "assets/Atlases";
+        static std::string atlasName = "Atlas";
+        static std::int32_t pageSize = 2048;
+        static std::int32_t padding = 2;
+        static std::vector<std::filesystem::path> lastBuiltAtlasFilePaths;
+
+        ImGui::SetNextWindowSize(ImVec2(0, 0), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin("Texture Atlas Packer", pIsOpen))
+        {
+            ImGui::End();
+            return;
+        }
+
+        ImGui::PushID("Texture Atlas Packer");
+
+        ImGuiUtil::DrawTextControl("Source Folder", sourceFolder);
+        ImGuiUtil::DrawTextControl("Output Folder", outputFolder);
+        ImGuiUtil::DrawTextControl("Atlas Name", atlasName);
+        ImGuiUtil::DrawIntSliderControl("Page Size", pageSize, 64, 8192);
+        ImGuiUtil::DrawIntSliderControl("Padding", padding, 0, 16);
+
+        ImGui::Separator();
+        if (ImGui::Button("Pack"))
+        {
+            lastBuiltAtlasFilePaths = TextureAtlasFile::BuildFromFolder
+                (
+                    sourceFolder,
+                    outputFolder,
+                    atlasName,
+                    TextureAtlasPackerSettings
+                        {
+                            .PageWidth = (std::uint32_t) pageSize,
+                            .PageHeight = (std::uint32_t) pageSize,
+                            .Padding = (std::uint32_t) padding
+                        }
+                );
+        }
+
+        for (auto const &atlasFilePath: lastBuiltAtlasFilePaths)
+        {
+            ImGui::TextUnformatted(atlasFilePath.generic_string().c_str());
+        }
+
+        ImGui::PopID();
+        ImGui::End();
+    }
+
+    void DrawTextureCookerWindow(bool *pIsOpen)
+    {
+        static std::string sourceFolder = "assets/Textures";
+        static std::string cacheFolder = "assets/Cooked";
+        static std::int32_t formatIndex = 0;
+        static bool generateMipmaps = true;
+        static std::vector<std::filesystem::path> lastCookedTexturePaths;
+
+        ImGui::SetNextWindowSize(ImVec2(0, 0), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin("Texture Cooker", pIsOpen))
+        {
+            ImGui::End();
+            return;
+        }
+
+        ImGui::PushID("Texture Cooker");
+
+        ImGuiUtil::DrawTextControl("Source Folder", sourceFolder);
+        ImGuiUtil::DrawTextControl("Cache Folder", cacheFolder);
+        ImGuiUtil::DrawDropdownControl("Format", formatIndex, {"RGBA8", "BC1", "BC3"});
+        ImGuiUtil::DrawBoolControl("Generate Mipmaps", generateMipmaps);
+
+        ImGui::Separator();
+        std::error_code errorCode;
+        if (ImGui::Button("Cook") && std::filesystem::is_directory(sourceFolder, errorCode))
+        {
+            TextureCookSettings const settings {.Format = (CookedTextureFormat) formatIndex, .GenerateMipmaps = generateMipmaps};
+
+            // Textures that have been cooked with the same content & settings are skipped.
+            lastCookedTexturePaths.clear();
+            for (auto const &directoryEntry: std::filesystem::directory_iterator(sourceFolder))
+            {
+                if (!directoryEntry.is_regular_file())
+                {
+                    continue;
+                }
+
+                std::string const extension = directoryEntry.path().extension().string();
+                if (extension != ".png" && extension != ".jpg" && extension != ".jpeg" && extension != ".tga" && extension != ".bmp" && extension != ".psd")
+                {
+                    continue;
+                }
+
+                std::optional<std::filesystem::path> const cookedPath = TextureCooker::CookToCache(directoryEntry.path(), cacheFolder, settings);
+                if (cookedPath.has_value())
+                {
+                    lastCookedTexturePaths.push_back(cookedPath.value());
+                }
+            }
+        }
+
+        for (auto const &cookedTexturePath: lastCookedTexturePaths)
+        {
+            ImGui::TextUnformatted(cookedTexturePath.generic_string().c_str());
+        }
+
+        ImGui::PopID();
+        ImGui::End();
+    }
+}
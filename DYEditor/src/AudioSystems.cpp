@@ -8,31 +8,37 @@
 
 namespace DYE::DYEditor
 {
-    void AudioSystem::Execute(World &world, DYE::DYEditor::ExecuteParameters params)
+    AudioSystem::AudioSystem()
     {
-        // Start audio source.
+        // A command added before the audio source is executed once the audio source is added.
+        reactTo<StartAudioSourceComponent>({.OnAdded = true, .OnUpdated = false});
+        reactTo<StopAudioSourceComponent>({.OnAdded = true, .OnUpdated = false});
+        reactTo<AudioSource2DComponent>({.OnAdded = true, .OnUpdated = false});
+    }
+
+    void AudioSystem::ExecuteReactive(World &world, DYE::DYEditor::ExecuteParameters params, std::span<EntityIdentifier const> entities)
+    {
+        entt::registry &registry = world.GetRegistry();
+        for (EntityIdentifier const entity: entities)
         {
-            auto startView = world.GetRegistry().view<AudioSource2DComponent, StartAudioSourceComponent>();
-            for (auto entity: startView)
+            auto *pAudioSource = registry.try_get<AudioSource2DComponent>(entity);
+            if (pAudioSource == nullptr)
             {
-                auto &audioSource = startView.get<AudioSource2DComponent>(entity);
-                audioSource.Source.Play();
-
-                auto wrappedEntity = world.WrapIdentifierIntoEntity(entity);
-                wrappedEntity.RemoveComponent<StartAudioSourceComponent>();
+                continue;
             }
-        }
 
-        // Stop audio source.
-        {
-            auto stopView = world.GetRegistry().view<AudioSource2DComponent, StopAudioSourceComponent>();
-            for (auto entity: stopView)
+            // Start audio source.
+            if (registry.all_of<StartAudioSourceComponent>(entity))
             {
-                auto &audioSource = stopView.get<AudioSource2DComponent>(entity);
-                audioSource.Source.Stop();
+                pAudioSource->Source.Play();
+                registry.remove<StartAudioSourceComponent>(entity);
+            }
 
-                auto wrappedEntity = world.WrapIdentifierIntoEntity(entity);
-                wrappedEntity.RemoveComponent<StopAudioSourceComponent>();
+            // Stop audio source.
+            if (registry.all_of<StopAudioSourceComponent>(entity))
+            {
+                pAudioSource->Source.Stop();
+                registry.remove<StopAudioSourceComponent>(entity);
             }
         }
     }
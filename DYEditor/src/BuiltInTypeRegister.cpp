@@ -1,9 +1,11 @@
 #include "Type/BuiltInTypeRegister.h"
 
 #include "Graphics/Texture.h"
+#include "Graphics/TextureCooker.h"
 #include "Type/TypeRegistry.h"
 #include "Core/EditorProperty.h"
 #include "Serialization/SerializedObjectFactory.h"
+#include "Serialization/TextureAtlasFile.h"
 #include "Math/Color.h"
 #include "ImGui/ImGuiUtil.h"
 #include "ImGui/EditorImGuiUtil.h"
@@ -79,7 +81,7 @@ namespace DYE::DYEditor
         {
             // We don't do any error handling here (i.e. check if entity has NameComponent) because
             // the function will only be called when the entity has NameComponent for sure.
-            serializedComponent.SetPrimitiveTypePropertyValue("Name", entity.GetComponent<NameComponent>().Name);
+            serializedComponent.SetPrimitiveTypePropertyValue("Name", entity.GetComponent<NameComponent>().Name.GetString());
 
             return {};
         }
@@ -87,20 +89,32 @@ namespace DYE::DYEditor
         DeserializationResult
         NameComponent_Deserialize(SerializedComponent &serializedComponent, DYE::DYEditor::Entity &entity)
         {
-            auto &nameComponent = entity.AddOrGetComponent<NameComponent>();
-            nameComponent.Name = serializedComponent.GetPrimitiveTypePropertyValueOrDefault<DYE::String>("Name");
+            entity.AddOrGetComponent<NameComponent>();
+            entity.SetName(serializedComponent.GetPrimitiveTypePropertyValueOrDefault<DYE::String>("Name"));
 
             return {};
         }
 
         bool NameComponent_DrawInspector(DrawComponentInspectorContext &drawInspectorContext, Entity &entity)
         {
-            auto &nameComponent = entity.GetComponent<NameComponent>();
+            // Names are interned into a pool that never releases them, therefore the name being typed is kept in a local buffer
+            // and only applied when the edit is done. Only one text control can be edited at a time.
+            static std::string editedName;
 
-            bool const changed = ImGuiUtil::DrawTextControl("Name", nameComponent.Name);
+            std::string name = entity.GetComponent<NameComponent>().Name.GetString();
+            if (ImGuiUtil::DrawTextControl("Name", name))
+            {
+                editedName = name;
+            }
             drawInspectorContext.IsModificationActivated |= ImGuiUtil::IsControlActivated();
             drawInspectorContext.IsModificationDeactivated |= ImGuiUtil::IsControlDeactivated();
-            drawInspectorContext.IsModificationDeactivatedAfterEdit |= ImGuiUtil::IsControlDeactivatedAfterEdit();
+
+            bool const changed = ImGuiUtil::IsControlDeactivatedAfterEdit();
+            if (changed)
+            {
+                entity.SetName(editedName);
+            }
+            drawInspectorContext.IsModificationDeactivatedAfterEdit |= changed;
 
             return changed;
         }
@@ -419,6 +433,34 @@ namespace DYE::DYEditor
             entity.AddComponent<SpriteRendererComponent>();
         }
 
+        /// Load the atlas region if the atlas is assigned, otherwise load the texture asset.
+        void SpriteRendererComponent_LoadTexture(SpriteRendererComponent &component)
+        {
+            component.Atlas = nullptr;
+            component.TilingOffset = {1, 1, 0, 0};
+
+            if (!component.AtlasAssetPath.empty())
+            {
+                component.Atlas = TextureAtlasFile::TryLoad(component.AtlasAssetPath);
+                TextureAtlasRegion const *pRegion = component.Atlas != nullptr ? component.Atlas->TryGetRegion(component.AtlasRegionName) : nullptr;
+                if (pRegion != nullptr)
+                {
+                    component.Texture = component.Atlas->GetTexture();
+                    component.TilingOffset = component.Atlas->GetRegionTilingOffset(*pRegion);
+                    return;
+                }
+            }
+
+            if (FileSystem::FileExists(component.TextureAssetPath))
+            {
+                component.Texture = Texture2D::Create(component.TextureAssetPath);
+            }
+            else
+            {
+                component.Texture = Texture2D::GetDefaultTexture();
+            }
+        }
+
         SerializationResult
         SpriteRendererComponent_Serialize(DYE::DYEditor::Entity &entity, SerializedComponent &serializedComponent)
         {
@@ -426,6 +468,8 @@ namespace DYE::DYEditor
             serializedComponent.SetPrimitiveTypePropertyValue("IsEnabled", component.IsEnabled);
             serializedComponent.SetPrimitiveTypePropertyValue("Color", component.Color);
             serializedComponent.SetPrimitiveTypePropertyValue("TextureAssetPath", component.TextureAssetPath);
+            serializedComponent.SetPrimitiveTypePropertyValue("AtlasAssetPath", component.AtlasAssetPath);
+            serializedComponent.SetPrimitiveTypePropertyValue("AtlasRegionName", component.AtlasRegionName);
 
             return {};
         }
@@ -438,15 +482,10 @@ namespace DYE::DYEditor
             component.Color = serializedComponent.GetPrimitiveTypePropertyValueOrDefault<DYE::Color4>("Color");
             component.TextureAssetPath = serializedComponent.GetPrimitiveTypePropertyValueOrDefault<DYE::AssetPath>(
                 "TextureAssetPath");
+            component.AtlasAssetPath = serializedComponent.GetPrimitiveTypePropertyValueOrDefault<DYE::AssetPath>("AtlasAssetPath");
+            component.AtlasRegionName = serializedComponent.GetPrimitiveTypePropertyValueOrDefault<DYE::String>("AtlasRegionName");
 
-            if (FileSystem::FileExists(component.TextureAssetPath))
-            {
-                component.Texture = Texture2D::Create(component.TextureAssetPath);
-            }
-            else
-            {
-                component.Texture = Texture2D::GetDefaultTexture();
-            }
+            SpriteRendererComponent_LoadTexture(component);
 
             return {};
         }
@@ -460,21 +499,24 @@ namespace DYE::DYEditor
             drawInspectorContext.IsModificationDeactivated |= ImGuiUtil::IsControlDeactivated();
             drawInspectorContext.IsModificationDeactivatedAfterEdit |= ImGuiUtil::IsControlDeactivatedAfterEdit();
 
-            bool isPathChanged = ImGuiUtil::DrawAssetPathStringControl("Texture Asset Path", component.TextureAssetPath, {".jpg", ".jpeg", ".png", ".tga", ".bmp", ".psd"});
+            bool isPathChanged = ImGuiUtil::DrawAssetPathStringControl("Texture Asset Path", component.TextureAssetPath, {".jpg", ".jpeg", ".png", ".tga", ".bmp", ".psd", TextureCooker::CookedTextureExtension});
+            drawInspectorContext.IsModificationActivated |= ImGuiUtil::IsControlActivated();
+            drawInspectorContext.IsModificationDeactivated |= ImGuiUtil::IsControlDeactivated();
+            drawInspectorContext.IsModificationDeactivatedAfterEdit |= ImGuiUtil::IsControlDeactivatedAfterEdit();
+
+            isPathChanged |= ImGuiUtil::DrawAssetPathStringControl("Atlas Asset Path", component.AtlasAssetPath, {TextureAtlasFile::Extension});
+            drawInspectorContext.IsModificationActivated |= ImGuiUtil::IsControlActivated();
+            drawInspectorContext.IsModificationDeactivated |= ImGuiUtil::IsControlDeactivated();
+            drawInspectorContext.IsModificationDeactivatedAfterEdit |= ImGuiUtil::IsControlDeactivatedAfterEdit();
+
+            isPathChanged |= ImGuiUtil::DrawTextControl("Atlas Region Name", component.AtlasRegionName);
             drawInspectorContext.IsModificationActivated |= ImGuiUtil::IsControlActivated();
             drawInspectorContext.IsModificationDeactivated |= ImGuiUtil::IsControlDeactivated();
             drawInspectorContext.IsModificationDeactivatedAfterEdit |= ImGuiUtil::IsControlDeactivatedAfterEdit();
 
             if (isPathChanged)
             {
-                if (FileSystem::FileExists(component.TextureAssetPath))
-                {
-                    component.Texture = Texture2D::Create(component.TextureAssetPath);
-                }
-                else
-                {
-                    component.Texture = Texture2D::GetDefaultTexture();
-                }
+                SpriteRendererComponent_LoadTexture(component);
             }
 
             // Draw a preview of the texture.
@@ -640,6 +682,14 @@ namespace DYE::DYEditor
             return loadTypeChanged || isPathChanged || changed;
         }
 
+        bool InterpolateTransformComponent_DrawInspector(DrawComponentInspectorContext &drawInspectorContext, Entity &entity)
+        {
+            ImGui::Indent();
+            ImGui::TextWrapped("The sprite of this entity is rendered between the local transforms of the last two fixed updates in play mode.");
+            ImGui::Unindent();
+            return false;
+        }
+
         bool PlayAudioSourceOnInitializeComponent_DrawInspector(DrawComponentInspectorContext &drawInspectorContext, Entity &entity)
         {
             ImGui::Indent();
@@ -881,6 +931,18 @@ namespace DYE::DYEditor
                     }
             );
 
+        TypeRegistry::RegisterComponentType<InterpolateTransformComponent>
+            (
+                NAME_OF(DYE::DYEditor::InterpolateTransformComponent),
+                ComponentTypeDescriptor
+                    {
+                        .Serialize = BuiltInComponentTypeFunctions::SerializeEmptyComponent<InterpolateTransformComponent>,
+                        .Deserialize = BuiltInComponentTypeFunctions::DeserializeEmptyComponent<InterpolateTransformComponent>,
+                        .DrawInspector = BuiltInComponentTypeFunctions::InterpolateTransformComponent_DrawInspector,
+                        .GetDisplayName = []() { return "Interpolate Transform"; },
+                    }
+            );
+
         TypeRegistry::RegisterComponentType<CameraComponent>
             (
                 NAME_OF(DYE::DYEditor::CameraComponent),
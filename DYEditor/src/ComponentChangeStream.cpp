@@ -0,0 +1,107 @@
+#include "Core/ComponentChangeStream.h"
+
+#include "Util/Macro.h"
+
+#include <algorithm>
+
+namespace DYE::DYEditor
+{
+    void ComponentChangeSet::Clear()
+    {
+        Added.clear();
+        Updated.clear();
+        Removed.clear();
+    }
+
+    ComponentChangeSubscriptionID ComponentChangeStream::Subscribe()
+    {
+        auto freeSlotItr = std::find_if(m_Subscriptions.begin(), m_Subscriptions.end(), [](auto const &subscription) { return !subscription.has_value(); });
+        if (freeSlotItr == m_Subscriptions.end())
+        {
+            freeSlotItr = m_Subscriptions.emplace(m_Subscriptions.end());
+        }
+
+        ComponentChangeSet &changeSet = freeSlotItr->emplace();
+        for (EntityIdentifier const entity: *m_pPool)
+        {
+            changeSet.Added.push(entity);
+        }
+
+        return static_cast<ComponentChangeSubscriptionID>(std::distance(m_Subscriptions.begin(), freeSlotItr));
+    }
+
+    void ComponentChangeStream::Unsubscribe(ComponentChangeSubscriptionID subscriptionID)
+    {
+        DYE_ASSERT(subscriptionID < m_Subscriptions.size() && m_Subscriptions[subscriptionID].has_value() && "Invalid change stream subscription.");
+        m_Subscriptions[subscriptionID].reset();
+    }
+
+    ComponentChangeSet &ComponentChangeStream::GetChangeSet(ComponentChangeSubscriptionID subscriptionID)
+    {
+        DYE_ASSERT(subscriptionID < m_Subscriptions.size() && m_Subscriptions[subscriptionID].has_value() && "Invalid change stream subscription.");
+        return m_Subscriptions[subscriptionID].value();
+    }
+
+    std::size_t ComponentChangeStream::GetNumberOfSubscriptions() const
+    {
+        return std::count_if(m_Subscriptions.begin(), m_Subscriptions.end(), [](auto const &subscription) { return subscription.has_value(); });
+    }
+
+    void ComponentChangeStream::onConstruct(entt::registry &, EntityIdentifier entity)
+    {
+        for (auto &subscription: m_Subscriptions)
+        {
+            if (!subscription.has_value())
+            {
+                continue;
+            }
+
+            // Removed & added again, the entity ends up with a new instance of the component.
+            subscription->Removed.remove(entity);
+            if (!subscription->Added.contains(entity))
+            {
+                subscription->Added.push(entity);
+            }
+        }
+    }
+
+    void ComponentChangeStream::onUpdate(entt::registry &, EntityIdentifier entity)
+    {
+        for (auto &subscription: m_Subscriptions)
+        {
+            if (!subscription.has_value())
+            {
+                continue;
+            }
+
+            // An update to a newly added component is still an addition to the subscriber.
+            if (!subscription->Added.contains(entity) && !subscription->Updated.contains(entity))
+            {
+                subscription->Updated.push(entity);
+            }
+        }
+    }
+
+    void ComponentChangeStream::onDestroy(entt::registry &, EntityIdentifier entity)
+    {
+        for (auto &subscription: m_Subscriptions)
+        {
+            if (!subscription.has_value())
+            {
+                continue;
+            }
+
+            // The subscriber has never seen the component, therefore it doesn't need to know about the removal either.
+            if (subscription->Added.remove(entity))
+            {
+                continue;
+            }
+
+            subscription->Updated.remove(entity);
+            if (!subscription->Removed.contains(entity))
+            {
+                subscription->Removed.push(entity);
+            }
+        }
+    }
+}
\ No newline at end of file
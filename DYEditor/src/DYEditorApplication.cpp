@@ -5,6 +5,13 @@
 #include "Configuration/ProjectConfig.h"
 #include "Configuration/SubWindowConfiguration.h"
 #include "Core/RuntimeSceneManagement.h"
+#include "Core/Scene.h"
+#include "Core/RuntimeState.h"
+#include "Core/GUID.h"
+
+#include <cstdint>
+#include <optional>
+#include <random>
 
 namespace DYE::DYEditor
 {
@@ -38,5 +45,84 @@ namespace DYE::DYEditor
         pushLayerImmediate(runtimeLayer);
         pushLayerImmediate(editorLayer);
 #endif
+
+        startInputRecordingOrReplayBasedOnRuntimeConfig();
+    }
+
+    DYEditorApplication::DYEditorApplication(HeadlessRunProperties headlessRunProperties, int fixedFramePerSecond)
+        : Application(headlessRunProperties, fixedFramePerSecond)
+    {
+        DYE::DYEditor::RegisterBuiltInTypes();
+        DYE::DYEditor::RegisterUserTypes();
+
+        auto runtimeLayer = std::make_shared<DYEditor::SceneRuntimeLayer>();
+        pushLayerImmediate(runtimeLayer);
+
+        std::filesystem::path firstScenePath = (std::filesystem::path) DYE::DYEditor::GetRuntimeConfig().GetOrDefault<std::string>(RuntimeConfigKeys::FirstScene, "");
+        if (firstScenePath.empty())
+        {
+            DYE_ASSERT_RELEASE(false && "The settings for the first scene is empty."
+                                        "Be sure to set Project.FirstScene in the runtime configuration file (i.e. runtime.ini).");
+        }
+        DYE::DYEditor::RuntimeSceneManagement::LoadScene(firstScenePath);
+
+#ifdef DYE_EDITOR
+        // There is no editor layer to press the play button, enter play mode directly.
+        RuntimeState::SetIsPlayingAtTheEndOfFrame(true);
+#endif
+
+        startInputRecordingOrReplayBasedOnRuntimeConfig();
+    }
+
+    void DYEditorApplication::startInputRecordingOrReplayBasedOnRuntimeConfig()
+    {
+        ProjectConfig &runtimeConfig = DYE::DYEditor::GetRuntimeConfig();
+
+#ifdef DYE_EDITOR
+        // The worlds of the windowed editor are authored & saved into scene files, their GUIDs must stay random.
+        bool const canSeedGUIDs = IsHeadless();
+#else
+        bool const canSeedGUIDs = true;
+#endif
+
+        std::optional<std::uint64_t> guidSeed;
+        // TOML integers are signed 64-bit, a negative value is taken as its unsigned bit pattern so any 64-bit seed can be set.
+        auto const configGUIDSeed = (std::uint64_t) runtimeConfig.GetOrDefault<std::int64_t>(RuntimeConfigKeys::GUIDSeed, 0);
+        if (canSeedGUIDs && configGUIDSeed != 0)
+        {
+            // Also seed the worlds that are created later on (i.e. the temporary worlds of the systems).
+            guidSeed = configGUIDSeed;
+            GUIDFactory::SetDeterministicSeed(guidSeed);
+        }
+
+        std::filesystem::path const inputReplayPath = runtimeConfig.GetOrDefault<std::string>(RuntimeConfigKeys::InputReplayPath, "");
+        if (!inputReplayPath.empty() && StartInputReplay(inputReplayPath))
+        {
+            // Generate the same GUIDs as the recorded session for the entities created at runtime.
+            std::uint64_t const replayGUIDSeed = GetInputReplayGUIDSeed();
+            if (canSeedGUIDs && replayGUIDSeed != 0)
+            {
+                guidSeed = replayGUIDSeed;
+            }
+        }
+
+        std::filesystem::path const inputRecordingPath = runtimeConfig.GetOrDefault<std::string>(RuntimeConfigKeys::InputRecordingPath, "");
+        if (!inputRecordingPath.empty())
+        {
+            if (canSeedGUIDs && !guidSeed.has_value())
+            {
+                std::random_device randomDevice;
+                guidSeed = ((std::uint64_t) randomDevice() << 32) | (std::uint64_t) randomDevice();
+            }
+
+            // A session that cannot be seeded records 0, its replays keep random GUIDs as well.
+            StartInputRecording(inputRecordingPath, guidSeed.value_or(0));
+        }
+
+        if (guidSeed.has_value())
+        {
+            // The first scene is loaded at the end of the first frame into the same world, after the seed is set.
+            RuntimeSceneManagement::GetActiveMainScene().World.SetGUIDSeed(guidSeed.value());
+        }
     }
 }
\ No newline at end of file
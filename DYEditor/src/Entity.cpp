@@ -27,7 +27,7 @@ namespace DYE::DYEditor
         return !isNullEntity && m_pWorld->m_Registry.valid(m_EntityIdentifier);
     }
 
-    std::optional<std::string> Entity::TryGetName()
+    std::optional<InternedName> Entity::TryGetName()
     {
         if (!this->HasComponent<NameComponent>())
         {
@@ -37,11 +37,17 @@ namespace DYE::DYEditor
         return this->GetComponent<NameComponent>().Name;
     }
 
-    std::string Entity::GetName()
+    InternedName Entity::GetName()
     {
         return this->GetComponent<NameComponent>().Name;
     }
 
+    void Entity::SetName(InternedName name)
+    {
+        DYE_ASSERT(this->HasComponent<NameComponent>() && "Entity::SetName: Entity doesn't have a NameComponent.");
+        m_pWorld->m_Registry.patch<NameComponent>(m_EntityIdentifier, [name](NameComponent &nameComponent) { nameComponent.Name = name; });
+    }
+
     std::optional<GUID> Entity::TryGetGUID()
     {
         if (!this->HasComponent<IDComponent>())
@@ -41,44 +41,21 @@ namespace DYE::DYEditor::EntityUtil
             return false;
         }
 
-        // Go through all children using DFS.
-        std::stack<Entity> entityStack;
-        entityStack.push(potentialParent);
-        bool isRoot = true;
-        while (!entityStack.empty())
+        // Walk up the ancestors of the potential child, which is bounded by the depth instead of the size of the potential parent's subtree.
+        GUID const potentialParentGUID = potentialParent.GetComponent<IDComponent>().ID;
+        Entity ancestor = potentialChild;
+        while (ancestor.HasComponent<ParentComponent>())
         {
-            Entity entity = entityStack.top();
-
-            // We use a flag to skip the first entity in the stack (which is the parent).
-            if (!isRoot)
-            {
-                if (entity == potentialChild)
-                {
-                    // We find a child in the potential parent!
-                    return true;
-                }
-            }
-            isRoot = false;
-
-            entityStack.pop();
-            auto tryGetChild = entity.TryGetComponent<ChildrenComponent>();
-            if (!tryGetChild.has_value())
+            auto &parentComponent = ancestor.GetComponent<ParentComponent>();
+            if (parentComponent.GetParentGUID() == potentialParentGUID)
             {
-                // No child, nothing to push into the stack.
-                continue;
+                return true;
             }
 
-            auto const &childrenGUIDs = tryGetChild.value().get().GetChildrenGUIDs();
-            for (int i = childrenGUIDs.size() - 1; i >= 0; i--)
+            ancestor = parentComponent.GetParent(ancestor.GetWorld());
+            if (!ancestor.IsValid())
             {
-                auto childGUID = childrenGUIDs[i];
-                auto tryGetEntityWithGUID = potentialParent.GetWorld().TryGetEntityWithGUID(childGUID);
-                if (!tryGetEntityWithGUID.has_value())
-                {
-                    continue;
-                }
-                // Push the child into the stack.
-                entityStack.push(tryGetEntityWithGUID.value());
+                return false;
             }
         }
 
@@ -88,37 +65,8 @@ namespace DYE::DYEditor::EntityUtil
     std::vector<Entity> GetEntityAndAllChildrenPreorder(Entity root)
     {
         std::vector<Entity> result;
-
-        std::stack<Entity> entityStack;
-        entityStack.push(root);
-
-        while (!entityStack.empty())
-        {
-            Entity entity = entityStack.top();
-
-            result.push_back(entity);
-
-            entityStack.pop();
-            auto tryGetChild = entity.TryGetComponent<ChildrenComponent>();
-            if (!tryGetChild.has_value())
-            {
-                // No child, nothing to push into the stack.
-                continue;
-            }
-
-            auto const &childrenGUIDs = tryGetChild.value().get().GetChildrenGUIDs();
-            for (int i = childrenGUIDs.size() - 1; i >= 0; i--)
-            {
-                auto childGUID = childrenGUIDs[i];
-                auto tryGetEntityWithGUID = root.GetWorld().TryGetEntityWithGUID(childGUID);
-                if (!tryGetEntityWithGUID.has_value())
-                {
-                    continue;
-                }
-                // Push the child into the stack.
-                entityStack.push(tryGetEntityWithGUID.value());
-            }
-        }
+        result.push_back(root);
+        GetAllChildrenPreorder(root, result);
 
         return result;
     }
@@ -126,45 +74,21 @@ namespace DYE::DYEditor::EntityUtil
     std::vector<Entity> GetAllChildrenPreorder(Entity root)
     {
         std::vector<Entity> result;
+        GetAllChildrenPreorder(root, result);
 
-        std::stack<Entity> entityStack;
-        entityStack.push(root);
-
-        bool isRoot = true;
-
-        while (!entityStack.empty())
-        {
-            Entity entity = entityStack.top();
-
-            // We use a flag to skip the first entity in the stack (which is the parent).
-            if (!isRoot)
-            {
-                result.push_back(entity);
-            }
-            isRoot = false;
+        return result;
+    }
 
-            entityStack.pop();
-            auto tryGetChild = entity.TryGetComponent<ChildrenComponent>();
-            if (!tryGetChild.has_value())
-            {
-                // No child, nothing to push into the stack.
-                continue;
-            }
+    void GetAllChildrenPreorder(Entity root, std::vector<Entity> &outChildren)
+    {
+        ForEachChildPreorder(root, [&outChildren](Entity entity) { outChildren.push_back(entity); });
+    }
 
-            auto const &childrenGUIDs = tryGetChild.value().get().GetChildrenGUIDs();
-            for (int i = childrenGUIDs.size() - 1; i >= 0; i--)
-            {
-                auto childGUID = childrenGUIDs[i];
-                auto tryGetEntityWithGUID = root.GetWorld().TryGetEntityWithGUID(childGUID);
-                if (!tryGetEntityWithGUID.has_value())
-                {
-                    continue;
-                }
-                // Push the child into the stack.
-                entityStack.push(tryGetEntityWithGUID.value());
-            }
-        }
+    std::size_t CountEntityAndAllChildren(Entity root)
+    {
+        std::size_t count = 0;
+        ForEntityAndEachChildPreorder(root, [&count](Entity entity) { count++; });
 
-        return result;
+        return count;
     }
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "Util/InternedName.h"
+
+#include <mutex>
+#include <unordered_set>
+
+namespace DYE::DYEditor
+{
+    namespace
+    {
+        /// Allow the pool to be searched with a string_view without constructing a temporary std::string.
+        struct NameHash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()(std::string_view name) const { return std::hash<std::string_view>()(name); }
+        };
+
+        /// The nodes of unordered_set are never moved, therefore the handles to the pooled strings stay valid.
+        using NamePool = std::unordered_set<std::string, NameHash, std::equal_to<>>;
+
+        NamePool &getNamePool()
+        {
+            // Function-local so names can be created during static initialization (i.e. system instances).
+            static NamePool namePool;
+            return namePool;
+        }
+
+        std::mutex &getNamePoolMutex()
+        {
+            static std::mutex namePoolMutex;
+            return namePoolMutex;
+        }
+
+        std::string const *internName(std::string_view name)
+        {
+            std::scoped_lock lock(getNamePoolMutex());
+            NamePool &namePool = getNamePool();
+
+            auto iterator = namePool.find(name);
+            if (iterator == namePool.end())
+            {
+                iterator = namePool.emplace(name).first;
+            }
+
+            return &(*iterator);
+        }
+    }
+
+    InternedName::InternedName()
+    {
+        static std::string const *pEmptyString = internName({});
+        m_pString = pEmptyString;
+    }
+
+    InternedName::InternedName(std::string_view name) : m_pString(internName(name))
+    {
+    }
+
+    std::size_t InternedName::GetNumberOfPooledNames()
+    {
+        std::scoped_lock lock(getNamePoolMutex());
+        return getNamePool().size();
+    }
+}
@@ -156,6 +156,7 @@ namespace DYE::DYEditor
     template bool ProjectConfig::GetOrDefault<bool>(const std::string &key, bool const &defaultValue);
     template float ProjectConfig::GetOrDefault<float>(const std::string &key, float const &defaultValue);
     template int ProjectConfig::GetOrDefault<int>(const std::string &key, int const &defaultValue);
+    template std::int64_t ProjectConfig::GetOrDefault<std::int64_t>(const std::string &key, std::int64_t const &defaultValue);
     template std::string ProjectConfig::GetOrDefault<std::string>(const std::string &key, std::string const &defaultValue);
     template<>
     glm::vec3 ProjectConfig::GetOrDefault<glm::vec3>(const std::string &keyPath, glm::vec3 const &defaultValue)
@@ -0,0 +1,104 @@
+#include "Core/ReactiveSystem.h"
+
+#include <algorithm>
+
+namespace DYE::DYEditor
+{
+    namespace
+    {
+        /// An entity index appears once, the OnRemoved trigger can give a destroyed entity whose index has been recycled
+        /// by a newer entity in the other change sets. The valid version wins regardless of the merge order.
+        void mergeChangedEntities
+            (
+                entt::registry const &registry,
+                std::vector<EntityIdentifier> &entities,
+                entt::sparse_set &mergedEntityIndices,
+                entt::sparse_set const &changedEntities
+            )
+        {
+            for (EntityIdentifier const entity: changedEntities)
+            {
+                auto const entityIndex = static_cast<EntityIdentifier>(entt::to_entity(entity));
+                if (!mergedEntityIndices.contains(entityIndex))
+                {
+                    mergedEntityIndices.push(entityIndex);
+                    entities.push_back(entity);
+                    continue;
+                }
+
+                EntityIdentifier &mergedEntity = entities[mergedEntityIndices.index(entityIndex)];
+                if (mergedEntity != entity && registry.valid(entity))
+                {
+                    mergedEntity = entity;
+                }
+            }
+        }
+    }
+
+    ReactiveSystemBase::~ReactiveSystemBase()
+    {
+        unsubscribe();
+    }
+
+    void ReactiveSystemBase::Execute(World &world, DYE::DYEditor::ExecuteParameters params)
+    {
+        if (!isSubscribedTo(world))
+        {
+            unsubscribe();
+            for (TriggerEntry &trigger: m_Triggers)
+            {
+                ComponentChangeStream &stream = trigger.GetStream(world);
+                trigger.pSubscribedStream = stream.weak_from_this();
+                trigger.SubscriptionID = stream.Subscribe();
+            }
+            m_pSubscribedWorld = &world;
+        }
+
+        entt::registry const &registry = world.GetRegistry();
+        m_Entities.clear();
+        m_MergedEntityIndices.clear();
+        for (TriggerEntry &trigger: m_Triggers)
+        {
+            ComponentChangeSet &changeSet = trigger.pSubscribedStream.lock()->GetChangeSet(trigger.SubscriptionID);
+            if (trigger.Trigger.OnAdded)
+            {
+                mergeChangedEntities(registry, m_Entities, m_MergedEntityIndices, changeSet.Added);
+            }
+            if (trigger.Trigger.OnUpdated)
+            {
+                mergeChangedEntities(registry, m_Entities, m_MergedEntityIndices, changeSet.Updated);
+            }
+            if (trigger.Trigger.OnRemoved)
+            {
+                mergeChangedEntities(registry, m_Entities, m_MergedEntityIndices, changeSet.Removed);
+            }
+
+            changeSet.Clear();
+        }
+
+        ExecuteReactive(world, params, std::span<EntityIdentifier const>(m_Entities));
+    }
+
+    bool ReactiveSystemBase::isSubscribedTo(World &world) const
+    {
+        return m_pSubscribedWorld == &world &&
+               std::none_of
+                   (
+                       m_Triggers.begin(), m_Triggers.end(),
+                       [](TriggerEntry const &trigger) { return trigger.pSubscribedStream.expired(); }
+                   );
+    }
+
+    void ReactiveSystemBase::unsubscribe()
+    {
+        for (TriggerEntry &trigger: m_Triggers)
+        {
+            if (std::shared_ptr<ComponentChangeStream> pStream = trigger.pSubscribedStream.lock())
+            {
+                pStream->Unsubscribe(trigger.SubscriptionID);
+            }
+            trigger.pSubscribedStream.reset();
+        }
+        m_pSubscribedWorld = nullptr;
+    }
+}
\ No newline at end of file
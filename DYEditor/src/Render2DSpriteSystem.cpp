@@ -1,6 +1,8 @@
 #include "Systems/Render2DSpriteSystem.h"
 
 #include "Components/TransformComponents.h"
+#include "Components/HierarchyComponents.h"
+#include "Core/Time.h"
 #include "Components/SpriteRendererComponent.h"
 #include "Graphics/RenderPipelineManager.h"
 #include "Graphics/RenderPipeline2D.h"
@@ -16,14 +18,29 @@ namespace DYE::DYEditor
     void Render2DSpriteSystem::InitializeLoad(DYEditor::World &world, DYE::DYEditor::InitializeLoadParameters)
     {
         // Call this on initialize load to perform initialization step on the group.
-        auto group = world.GetRegistry().group<SpriteRendererComponent>(Get<LocalToWorldComponent>);
+        m_SpriteQuery.Get(world);
     }
 
     void Render2DSpriteSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
     {
         m_NumberOfRenderedEntitiesLastFrame = 0;
-        // We use group here because we know Render2DSpriteSystem is the main critical path for SpriteRendererComponent.
-        auto group = world.GetRegistry().group<SpriteRendererComponent>(Get<LocalToWorldComponent>);
+
+        // The active pipeline might not be a 2D pipeline (i.e. NullRenderPipeline in headless mode),
+        // in which case the sprites are still submitted through the base interface without the default geometry & material.
+        RenderPipelineBase &pipeline = RenderPipelineManager::GetActiveRenderPipeline();
+        RenderPipeline2D *pipeline2D = RenderPipelineManager::TryGetTypedActiveRenderPipelinePtr<RenderPipeline2D>();
+        std::shared_ptr<VertexArray> const geometryVAO = pipeline2D != nullptr ? pipeline2D->GetDefaultQuadSpriteVAO() : nullptr;
+        std::shared_ptr<Material> const spriteMaterial = pipeline2D != nullptr ? pipeline2D->GetDefaultSpriteMaterial() : nullptr;
+
+        // The fixed update interpolation is only meaningful when the simulation is running.
+        bool const interpolateTransforms = params.Mode == ExecutionMode::Play;
+        m_InterpolatedLocalToWorlds.clear();
+        if (interpolateTransforms)
+        {
+            computeInterpolatedLocalToWorlds(world, TIME.FixedUpdateInterpolationAlphaF());
+        }
+
+        auto &group = m_SpriteQuery.Get(world);
         for (auto entity: group)
         {
             auto [sprite, localToWorld] = group.get<SpriteRendererComponent, LocalToWorldComponent>(entity);
@@ -35,30 +52,109 @@ namespace DYE::DYEditor
 
             Entity wrappedEntity = world.WrapIdentifierIntoEntity(entity);
 
-            glm::mat4 modelMatrix = localToWorld.Matrix;
+            glm::mat4 modelMatrix = m_InterpolatedLocalToWorlds.contains(entity) ? m_InterpolatedLocalToWorlds.get(entity) : localToWorld.Matrix;
 
             // Scale the matrix based on sprite pixels per unit.
-            modelMatrix = glm::scale(modelMatrix, sprite.Texture->GetScaleFromTextureDimensions());
+            // If the sprite is a region of an atlas, only the region is taken into account.
+            glm::vec3 const textureScale = sprite.Texture->GetScaleFromTextureDimensions();
+            modelMatrix = glm::scale(modelMatrix, {textureScale.x * sprite.TilingOffset.x, textureScale.y * sprite.TilingOffset.y, textureScale.z});
 
             MaterialPropertyBlock materialPropertyBlock;
             materialPropertyBlock.SetTexture("_MainTex", sprite.Texture);
-            materialPropertyBlock.SetFloat4("_MainTex_TilingOffset", {1, 1, 0, 0});
+            materialPropertyBlock.SetFloat4("_MainTex_TilingOffset", sprite.TilingOffset);
             materialPropertyBlock.SetFloat4("_Color", sprite.Color);
 
-            RenderPipeline2D *pipeline2D = RenderPipelineManager::GetTypedActiveRenderPipelinePtr<RenderPipeline2D>();
-            auto geometryVAO = pipeline2D->GetDefaultQuadSpriteVAO();
-            pipeline2D->Submit(geometryVAO, pipeline2D->GetDefaultSpriteMaterial(), modelMatrix, materialPropertyBlock);
+            pipeline.Submit(geometryVAO, spriteMaterial, modelMatrix, materialPropertyBlock);
 
 #ifdef DYE_EDITOR
             // We only submit the sprite to the scene view selection system if it's in the editor.
-            SceneViewEntitySelection::RegisterEntityGeometry(wrappedEntity.GetInstanceID(), geometryVAO, modelMatrix);
+            if (geometryVAO)
+            {
+                SceneViewEntitySelection::RegisterEntityGeometry(wrappedEntity.GetInstanceID(), geometryVAO, modelMatrix);
+            }
 #endif
             m_NumberOfRenderedEntitiesLastFrame++;
         }
     }
 
+    void Render2DSpriteSystem::computeInterpolatedLocalToWorlds(World &world, float alpha)
+    {
+        auto &interpolateView = m_InterpolateQuery.Get(world);
+        for (auto entity: interpolateView)
+        {
+            getInterpolatedLocalToWorld(world, entity, alpha);
+            propagateInterpolatedLocalToWorld(world, entity, alpha);
+        }
+    }
+
+    glm::mat4 Render2DSpriteSystem::getInterpolatedLocalToWorld(World &world, EntityIdentifier entity, float alpha)
+    {
+        // The ancestors are shared by the siblings, compute each of them once.
+        if (m_InterpolatedLocalToWorlds.contains(entity))
+        {
+            return m_InterpolatedLocalToWorlds.get(entity);
+        }
+
+        // Same as computeLocalToWorldRecursively, except that the local transforms are interpolated when possible.
+        entt::registry &registry = world.GetRegistry();
+        glm::mat4 parentToWorld = glm::mat4 {1.0f};
+        if (auto *pParent = registry.try_get<ParentComponent>(entity))
+        {
+            Entity parent = pParent->GetParent(world);
+            if (parent.IsValid())
+            {
+                parentToWorld = getInterpolatedLocalToWorld(world, parent.GetIdentifier(), alpha);
+            }
+        }
+
+        glm::mat4 localToParent = glm::mat4 {1.0f};
+        if (auto *pLocalTransform = registry.try_get<LocalTransformComponent>(entity))
+        {
+            auto *pInterpolate = registry.try_get<InterpolateTransformComponent>(entity);
+            localToParent = pInterpolate != nullptr ? pInterpolate->GetInterpolatedTransformMatrix(*pLocalTransform, alpha) : pLocalTransform->GetTransformMatrix();
+        }
+
+        glm::mat4 const localToWorld = parentToWorld * localToParent;
+        m_InterpolatedLocalToWorlds.emplace(entity, localToWorld);
+        return localToWorld;
+    }
+
+    void Render2DSpriteSystem::propagateInterpolatedLocalToWorld(World &world, EntityIdentifier entity, float alpha)
+    {
+        auto *pChildren = world.GetRegistry().try_get<ChildrenComponent>(entity);
+        if (pChildren == nullptr)
+        {
+            return;
+        }
+
+        for (EntityIdentifier const child: pChildren->GetChildrenCache())
+        {
+            // The interpolated children propagate to their own descendants when they are iterated by the interpolate query.
+            if (!world.GetRegistry().valid(child) || world.GetRegistry().all_of<InterpolateTransformComponent>(child))
+            {
+                continue;
+            }
+
+            getInterpolatedLocalToWorld(world, child, alpha);
+            propagateInterpolatedLocalToWorld(world, child, alpha);
+        }
+    }
+
     void Render2DSpriteSystem::DrawInspector(DYEditor::World &world)
     {
         ImGui::Text("Rendered Entities: %d", m_NumberOfRenderedEntitiesLastFrame);
+
+        // Sprites sharing the same texture (i.e. on the same atlas) skip the texture bindings when they are drawn consecutively.
+        RenderPipeline2D *pipeline2D = RenderPipelineManager::TryGetTypedActiveRenderPipelinePtr<RenderPipeline2D>();
+        if (pipeline2D != nullptr)
+        {
+            RenderStateCacheStatistics const &statistics = pipeline2D->GetStateCacheStatisticsLastFrame();
+            ImGui::Text("Texture Binds: %d (Elided: %d)", statistics.NumberOfIssuedTextureBinds, statistics.NumberOfElidedTextureBinds);
+
+            // The counts are summed over all the cameras.
+            CullingStatistics const &cullingStatistics = pipeline2D->GetCullingStatisticsLastFrame();
+            ImGui::Text("Visible Submissions: %d (Culled: %d)", cullingStatistics.NumberOfVisibleSubmissions, cullingStatistics.NumberOfCulledSubmissions);
+            ImGui::Text("Reused Culling Results: %d", cullingStatistics.NumberOfReusedCullingResults);
+        }
     }
 }
@@ -6,6 +6,7 @@
 #include "Core/RuntimeState.h"
 #include "Core/RuntimeSceneManagement.h"
 #include "Core/EditorSystem.h"
+#include "Core/SystemQuery.h"
 #include "Serialization/SerializedObjectFactory.h"
 #include "Configuration/ProjectConfig.h"
 #include "Configuration/SubWindowConfiguration.h"
@@ -19,6 +20,7 @@
 #include "Event/KeyEvent.h"
 #include "Util/EntityUtil.h"
 #include "ImGui/EditorWindowManager.h"
+#include "ImGui/AssetToolWindows.h"
 #include "ImGui/ImGuiUtil.h"
 #include "ImGui/ImGuiUtil_Internal.h"
 #include "Undo/Undo.h"
@@ -136,6 +138,30 @@ namespace DYE::DYEditor
             }
         );
 
+        EditorWindowManager::RegisterEditorWindow(
+            RegisterEditorWindowParameters
+                {
+                    .Name = "Texture Atlas Packer",
+                    .isConfigOpenByDefault = false
+                },
+            [](char const *name, bool *pIsOpen, ImGuiViewport const *pMainViewportHint)
+            {
+                DrawTextureAtlasPackerWindow(pIsOpen);
+            }
+        );
+
+        EditorWindowManager::RegisterEditorWindow(
+            RegisterEditorWindowParameters
+                {
+                    .Name = "Texture Cooker",
+                    .isConfigOpenByDefault = false
+                },
+            [](char const *name, bool *pIsOpen, ImGuiViewport const *pMainViewportHint)
+            {
+                DrawTextureCookerWindow(pIsOpen);
+            }
+        );
+
         EditorWindowManager::RegisterEditorWindow(
             RegisterEditorWindowParameters
                 {
@@ -323,7 +349,7 @@ namespace DYE::DYEditor
                         {
                             Entity selectedEntity = tryGetSelectedEntity.value();
 
-                            std::string name = selectedEntity.TryGetName().value();
+                            std::string name = selectedEntity.TryGetName().value().GetString();
                             name = StringUtil::AddOrIncrementNumberSuffix(name);
 
                             auto newEntity = Undo::DuplicateEntityRecursively(activeScene.World, selectedEntity, name);
@@ -613,7 +639,11 @@ namespace DYE::DYEditor
 
         // ImGuiLayer shouldn't block events when SceneView window is focused OR hovered.
         bool const editorShouldReceiveCameraInputEvent = m_IsSceneViewDrawn && (m_IsSceneViewWindowFocused || m_IsSceneViewWindowHovered);
-        m_pApplication->GetImGuiLayer().SetBlockEvents(!editorShouldReceiveCameraInputEvent);
+        ImGuiLayer *pImGuiLayer = m_pApplication->TryGetImGuiLayer();
+        if (pImGuiLayer != nullptr)
+        {
+            pImGuiLayer->SetBlockEvents(!editorShouldReceiveCameraInputEvent);
+        }
 
         ImGui::End();
         ImGui::PopStyleVar();
@@ -982,20 +1012,20 @@ namespace DYE::DYEditor
             {
                 Undo::SetLatestOperationDescription(
                     "Move Entity '%s' to (%f, %f, %f)",
-                    selectedEntity.TryGetName().value().c_str(),
+                    selectedEntity.TryGetName().value().GetString().c_str(),
                     transform.Position.x,
                     transform.Position.y,
                     transform.Position.z);
             }
             else if (context.GizmoType == ImGuizmo::OPERATION::ROTATE)
             {
-                Undo::SetLatestOperationDescription("Rotate Entity '%s'", selectedEntity.TryGetName().value().c_str());
+                Undo::SetLatestOperationDescription("Rotate Entity '%s'", selectedEntity.TryGetName().value().GetString().c_str());
             }
             else if (context.GizmoType == ImGuizmo::OPERATION::SCALE)
             {
                 Undo::SetLatestOperationDescription(
                     "Scale Entity '%s' to (%f, %f, %f)",
-                    selectedEntity.TryGetName().value().c_str(),
+                    selectedEntity.TryGetName().value().GetString().c_str(),
                     transform.Scale.x,
                     transform.Scale.y,
                     transform.Scale.z);
@@ -1164,7 +1194,7 @@ namespace DYE::DYEditor
                         return;
                     }
 
-                    auto &name = tryGetNameResult.value();
+                    std::string const &name = tryGetNameResult.value().GetString();
                     auto &guid = tryGetGUIDResult.value();
                     auto tryGetChildrenComponent = entity.TryGetComponent<ChildrenComponent>();
 
@@ -1311,7 +1341,7 @@ namespace DYE::DYEditor
                                             ImGui::Indent();
                                         }
 
-                                        ImGui::TextUnformatted(e.TryGetName().value().c_str());
+                                        ImGui::TextUnformatted(e.TryGetName().value().GetString().c_str());
 
                                         for (int i = 0; i < depth; i++)
                                         {
@@ -1467,7 +1497,7 @@ namespace DYE::DYEditor
                                             {
                                                 reorderAtTop.HasOperation = true;
                                                 reorderAtTop.SrcIndex = payloadIndex;
-                                                reorderAtTop.DstIndex = indexInWorld + EntityUtil::GetEntityAndAllChildrenPreorder(entity).size();
+                                                reorderAtTop.DstIndex = indexInWorld + EntityUtil::CountEntityAndAllChildren(entity);
                                             }
                                         }
                                     }
@@ -1538,18 +1568,27 @@ namespace DYE::DYEditor
 
                     // We need to calculate the index in parent if it's not the first OR the last location that
                     // we are trying to insert. Basically convert 'flat-index' to 'first-degree-child-index'.
-                    std::vector<Entity> newParentAndItsChildren = EntityUtil::GetEntityAndAllChildrenPreorder(
-                        dstEntity);
-
                     // We start from 1 because 0 is the parent.
-                    for (int flatIndex = 1; flatIndex < setParent.DstFlatIndexRelativeToParent; flatIndex++)
-                    {
-                        auto childEntity = newParentAndItsChildren[flatIndex];
-                        if (EntityUtil::IsFirstDegreeChildOf(childEntity, dstEntity))
-                        {
-                            dstIndexInParent++;
-                        }
-                    }
+                    int flatIndex = 1;
+                    EntityUtil::ForEachChildPreorder
+                        (
+                            dstEntity,
+                            [&flatIndex, &dstIndexInParent, &setParent, dstEntity](Entity childEntity)
+                            {
+                                if (flatIndex >= setParent.DstFlatIndexRelativeToParent)
+                                {
+                                    return false;
+                                }
+
+                                if (EntityUtil::IsFirstDegreeChildOf(childEntity, dstEntity))
+                                {
+                                    dstIndexInParent++;
+                                }
+
+                                flatIndex++;
+                                return true;
+                            }
+                        );
                 }
 
                 Undo::SetEntityParent
@@ -1859,6 +1898,25 @@ namespace DYE::DYEditor
                 if (isRecognizedSystem)
                 {
                     pSystemInstance->DrawInspector(scene.World);
+
+                    // List the component pools touched by the cached queries of the system.
+                    std::vector<SystemQueryBase *> const &queries = pSystemInstance->GetQueries();
+                    if (!queries.empty() && ImGui::TreeNode("Queried Pools"))
+                    {
+                        for (int queryIndex = 0; queryIndex < queries.size(); queryIndex++)
+                        {
+                            for (QueryPoolAccess const &poolAccess: queries[queryIndex]->GetPoolAccesses())
+                            {
+                                ImGui::Text
+                                    (
+                                        "[%d] %s: %.*s", queryIndex,
+                                        CastQueryPoolAccessTypeToString(poolAccess.AccessType).c_str(),
+                                        (int) poolAccess.ComponentTypeName.size(), poolAccess.ComponentTypeName.data()
+                                    );
+                            }
+                        }
+                        ImGui::TreePop();
+                    }
                 }
                 else
                 {
@@ -1899,11 +1957,16 @@ namespace DYE::DYEditor
             ImGui::GetCurrentWindow(), ImGuiAxis_Y).GetWidth() : 0;
 
         // Draw entity's NameComponent as a InputField on the top.
-        auto &nameComponent = entity.AddOrGetComponent<NameComponent>();
+        // The name is interned, therefore it's edited in a copy & put back with SetName.
+        std::string name = entity.AddOrGetComponent<NameComponent>().Name.GetString();
         ImGui::PushItemWidth(
             ImGui::GetWindowWidth() - scrollBarWidth - addComponentButtonSize.x - ImGui::GetFontSize());
         {
-            bool const changedThisFrame = ImGui::InputText("##EntityNameComponent", &nameComponent.Name);
+            bool const changedThisFrame = ImGui::InputText("##EntityNameComponent", &name);
+            if (changedThisFrame)
+            {
+                entity.SetName(name);
+            }
             if (ImGui::IsItemActivated())
             {
                 context.IsModifyingEntityProperty = true;
@@ -2,6 +2,7 @@
 
 #include "Core/RuntimeState.h"
 #include "Core/RuntimeSceneManagement.h"
+#include "Systems/TransformSystems.h"
 
 namespace DYE::DYEditor
 {
@@ -16,6 +17,8 @@ namespace DYE::DYEditor
 
     void SceneRuntimeLayer::OnFixedUpdate()
     {
+        SnapshotTransformsForInterpolation(RuntimeSceneManagement::GetActiveMainScene().World);
+
         ExecuteParameters const params {.Phase = ExecutionPhase::FixedUpdate};
         for (auto &systemDescriptor: RuntimeSceneManagement::GetActiveMainScene().FixedUpdateSystemDescriptors)
         {
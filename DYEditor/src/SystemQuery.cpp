@@ -0,0 +1,27 @@
+#include "Core/SystemQuery.h"
+
+#include "Util/Macro.h"
+
+namespace DYE::DYEditor
+{
+    std::string CastQueryPoolAccessTypeToString(QueryPoolAccessType accessType)
+    {
+        switch (accessType)
+        {
+            case QueryPoolAccessType::Get:
+                return "Get";
+            case QueryPoolAccessType::Owned:
+                return "Owned";
+            case QueryPoolAccessType::Exclude:
+                return "Exclude";
+        }
+
+        DYE_ASSERT(false && "Invalid Access Type");
+        return "Invalid Access Type";
+    }
+
+    SystemQueryBase::SystemQueryBase(SystemBase &owner)
+    {
+        owner.m_Queries.push_back(this);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "Serialization/TextureAtlasFile.h"
+
+#include "FileSystem/FileSystem.h"
+#include "Util/Macro.h"
+
+#include <toml++/toml.h>
+
+#include <fstream>
+
+namespace DYE::DYEditor
+{
+    std::unordered_map<std::string, TextureAtlasFile::LoadedAtlas> TextureAtlasFile::s_LoadedAtlases = {};
+
+    std::vector<std::filesystem::path> TextureAtlasFile::BuildFromFolder(std::filesystem::path const &folderPath,
+                                                                         std::filesystem::path const &outputFolderPath,
+                                                                         std::string const &atlasName,
+                                                                         TextureAtlasPackerSettings const &settings)
+    {
+        std::vector<TextureAtlasPage> const pages = TextureAtlasPacker::PackFolder(folderPath, settings);
+        if (pages.empty())
+        {
+            return {};
+        }
+
+        std::error_code errorCode;
+        std::filesystem::create_directories(outputFolderPath, errorCode);
+
+        std::vector<std::filesystem::path> atlasFilePaths;
+        for (std::size_t i = 0; i < pages.size(); i++)
+        {
+            std::string const pageName = atlasName + "_" + std::to_string(i);
+            std::filesystem::path const imageFileName = pageName + ".tga";
+            std::filesystem::path const atlasFilePath = outputFolderPath / (pageName + Extension);
+
+            if (!TextureAtlasPacker::WritePageImageToTGA(pages[i], outputFolderPath / imageFileName))
+            {
+                continue;
+            }
+
+            if (save(pages[i], imageFileName, atlasFilePath))
+            {
+                atlasFilePaths.push_back(atlasFilePath);
+            }
+        }
+
+        return atlasFilePaths;
+    }
+
+    std::shared_ptr<TextureAtlas> TextureAtlasFile::TryLoad(std::filesystem::path const &path)
+    {
+        if (!FileSystem::FileExists(path))
+        {
+            return nullptr;
+        }
+
+        std::error_code errorCode;
+        std::filesystem::file_time_type const lastWriteTime = std::filesystem::last_write_time(path, errorCode);
+
+        std::string const key = getLoadedAtlasKey(path);
+        auto const loadedAtlasItr = s_LoadedAtlases.find(key);
+        if (loadedAtlasItr != s_LoadedAtlases.end() && loadedAtlasItr->second.LastWriteTime == lastWriteTime)
+        {
+            if (std::shared_ptr<TextureAtlas> atlas = loadedAtlasItr->second.Atlas.lock())
+            {
+                return atlas;
+            }
+        }
+
+        auto result = toml::parse_file(path.string());
+        if (!result)
+        {
+            std::string errorDescription(result.error().description());
+            DYE_LOG("Failed to parse texture atlas file at '%s'.\n"
+                    "Error: %s", path.string().c_str(), errorDescription.c_str());
+            return nullptr;
+        }
+
+        toml::table const &table = result.table();
+
+        // The image path is relative to the atlas file.
+        std::filesystem::path const imagePath = path.parent_path() / table["Texture"].value_or<std::string>("");
+        if (!FileSystem::FileExists(imagePath))
+        {
+            DYE_LOG("Cannot find the page image '%s' of texture atlas '%s'.", imagePath.string().c_str(), path.string().c_str());
+            return nullptr;
+        }
+
+        std::vector<TextureAtlasRegion> regions;
+        if (toml::array const *pRegionsArray = table["Regions"].as_array())
+        {
+            regions.reserve(pRegionsArray->size());
+            for (toml::node const &regionNode: *pRegionsArray)
+            {
+                toml::table const *pRegionTable = regionNode.as_table();
+                if (pRegionTable == nullptr)
+                {
+                    continue;
+                }
+
+                regions.push_back
+                    (
+                        TextureAtlasRegion
+                            {
+                                .Name = (*pRegionTable)["Name"].value_or<std::string>(""),
+                                .X = (std::uint32_t) (*pRegionTable)["X"].value_or<std::int64_t>(0),
+                                .Y = (std::uint32_t) (*pRegionTable)["Y"].value_or<std::int64_t>(0),
+                                .Width = (std::uint32_t) (*pRegionTable)["Width"].value_or<std::int64_t>(0),
+                                .Height = (std::uint32_t) (*pRegionTable)["Height"].value_or<std::int64_t>(0)
+                            }
+                    );
+            }
+        }
+
+        std::shared_ptr<TextureAtlas> atlas = TextureAtlas::Create(Texture2D::Create(imagePath), std::move(regions));
+        s_LoadedAtlases[key] = LoadedAtlas {.Atlas = atlas, .LastWriteTime = lastWriteTime};
+        return atlas;
+    }
+
+    bool TextureAtlasFile::save(TextureAtlasPage const &page, std::filesystem::path const &imageFileName, std::filesystem::path const &path)
+    {
+        toml::array regionsArray;
+        for (auto const &region: page.Regions)
+        {
+            regionsArray.push_back
+                (
+                    toml::table
+                        {
+                            {"Name", region.Name},
+                            {"X", (std::int64_t) region.X},
+                            {"Y", (std::int64_t) region.Y},
+                            {"Width", (std::int64_t) region.Width},
+                            {"Height", (std::int64_t) region.Height}
+                        }
+                );
+        }
+
+        toml::table const table
+            {
+                {"Version", 1},
+                {"Texture", imageFileName.generic_string()},
+                {"Width", (std::int64_t) page.Width},
+                {"Height", (std::int64_t) page.Height},
+                {"Regions", std::move(regionsArray)}
+            };
+
+        std::ofstream fileStream(path, std::ios::trunc);
+        if (!fileStream.is_open())
+        {
+            DYE_LOG("Failed to open '%s' to write texture atlas file.", path.string().c_str());
+            return false;
+        }
+
+        fileStream << table;
+
+        // The atlas loaded from the previous file is outdated.
+        s_LoadedAtlases.erase(getLoadedAtlasKey(path));
+        return true;
+    }
+}
@@ -9,9 +9,20 @@
 
 namespace DYE::DYEditor
 {
+    void SnapshotTransformsForInterpolation(World &world)
+    {
+        auto view = world.GetRegistry().view<InterpolateTransformComponent, LocalTransformComponent>();
+        for (auto &&[entity, interpolate, localTransform]: view.each())
+        {
+            interpolate.PreviousLocalTransform = localTransform;
+            interpolate.HasPreviousLocalTransform = true;
+        }
+    }
+
     void ComputeLocalToWorldSystem::InitializeLoad(World &world, DYE::DYEditor::InitializeLoadParameters)
     {
-        auto syncGroup = world.GetRegistry().group<LocalToWorldComponent, LocalTransformComponent>({}, Exclude<ParentComponent>);
+        // Create the group on initialize load, so the pools are sorted before the first frame.
+        m_SyncQuery.Get(world);
     }
 
     void ComputeLocalToWorldSystem::Execute(World &world, DYE::DYEditor::ExecuteParameters params)
@@ -30,22 +41,24 @@ namespace DYE::DYEditor
         // see the multithreading/iterators section of https://skypjack.github.io/entt/md_docs_md_entity.html.
 
 
-        // Synchronize LocalToWorld for root transforms.
-        auto syncGroup = world.GetRegistry().group<LocalToWorldComponent, LocalTransformComponent>({}, Exclude<ParentComponent>);
-        std::for_each
+        // Synchronize LocalToWorld for root transforms, each chunk only writes the components of its own entities.
+        m_SyncQuery.ForEachChunk
             (
-                std::execution::unseq, syncGroup.begin(), syncGroup.end(),
-                [&syncGroup](auto entityIdentifier)
+                std::execution::par, world, SyncChunkSize,
+                [](std::span<EntityIdentifier const> chunk, auto &syncGroup)
                 {
-                    LocalToWorldComponent &localToWorld = syncGroup.get<LocalToWorldComponent>(entityIdentifier);
-                    LocalTransformComponent localTransformComponent = syncGroup.get<LocalTransformComponent>(entityIdentifier);
+                    for (EntityIdentifier const entityIdentifier: chunk)
+                    {
+                        LocalToWorldComponent &localToWorld = syncGroup.template get<LocalToWorldComponent>(entityIdentifier);
+                        LocalTransformComponent const &localTransformComponent = syncGroup.template get<LocalTransformComponent>(entityIdentifier);
 
-                    localToWorld.Matrix = localTransformComponent.GetTransformMatrix();
+                        localToWorld.Matrix = localTransformComponent.GetTransformMatrix();
+                    }
                 }
             );
 
         // Compute & propagate LocalToWorld from root transforms down to their children recursively.
-        auto propagationView = world.GetRegistry().view<LocalToWorldComponent, ChildrenComponent>(Exclude<ParentComponent>);
+        auto &propagationView = m_PropagationQuery.Get(world);
         std::for_each
             (
                 std::execution::unseq, propagationView.begin(), propagationView.end(),
@@ -110,14 +123,14 @@ namespace DYE::DYEditor
     {
         ImGui::TextUnformatted("Sync Group");
         ImGui::Separator();
-        auto syncGroup = world.GetRegistry().group<LocalToWorldComponent, LocalTransformComponent>({}, Exclude<ParentComponent>);
+        auto &syncGroup = m_SyncQuery.Get(world);
         std::for_each
             (
                 syncGroup.begin(), syncGroup.end(),
                 [&world](auto entityIdentifier)
                 {
                     Entity entity = world.WrapIdentifierIntoEntity(entityIdentifier);
-                    ImGui::TextUnformatted(entity.GetName().c_str());
+                    ImGui::TextUnformatted(entity.GetName().GetString().c_str());
                 }
             );
 
@@ -125,14 +138,14 @@ namespace DYE::DYEditor
 
         ImGui::TextUnformatted("Propagation Group");
         ImGui::Separator();
-        auto propagationView = world.GetRegistry().view<LocalToWorldComponent, ChildrenComponent>(Exclude<ParentComponent>);
+        auto &propagationView = m_PropagationQuery.Get(world);
         std::for_each
             (
                 propagationView.begin(), propagationView.end(),
                 [&world](auto entityIdentifier)
                 {
                     Entity entity = world.WrapIdentifierIntoEntity(entityIdentifier);
-                    ImGui::TextUnformatted(entity.GetName().c_str());
+                    ImGui::TextUnformatted(entity.GetName().GetString().c_str());
                 }
             );
     }
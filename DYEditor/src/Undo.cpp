@@ -186,7 +186,7 @@ namespace DYE::DYEditor
         bool const isAlreadyInGroupOperationBeforeThisFunctionCall = s_Data.IsInGroup;
 
         auto tryGetRootEntityName = rootEntityToDuplicate.TryGetName();
-        std::string rootEntityName = tryGetRootEntityName.has_value() ? tryGetRootEntityName.value() : "No Name";
+        std::string rootEntityName = tryGetRootEntityName.has_value() ? tryGetRootEntityName.value().GetString() : "No Name";
 
         if (!isAlreadyInGroupOperationBeforeThisFunctionCall)
         {
@@ -303,7 +303,7 @@ namespace DYE::DYEditor
             NameComponentTypeName,
             TypeRegistry::GetComponentTypeDescriptor_NameComponent());
 
-        newRootEntity.GetComponent<NameComponent>().Name = newEntityName;
+        newRootEntity.SetName(newEntityName);
 
         auto serializedNameComponentAfter = SerializedObjectFactory::CreateSerializedComponentOfType(
             newRootEntity,
@@ -350,9 +350,11 @@ namespace DYE::DYEditor
         }
 
         // Get name, guid and the children of the entity before deleting it.
-        std::string entityName = entity.TryGetName().value();
+        std::string entityName = entity.TryGetName().value().GetString();
         GUID entityGUID = entity.TryGetGUID().value();
-        auto allChildren = EntityUtil::GetAllChildrenPreorder(entity);
+        EntityUtil::ScratchVector<Entity> scratchChildren;
+        std::vector<Entity> &allChildren = scratchChildren.Get();
+        EntityUtil::GetAllChildrenPreorder(entity, allChildren);
 
         // Remove the entity from its old Parent's ChildrenComponent if it has a parent.
         auto tryGetOldParent = entity.TryGetComponent<ParentComponent>();
@@ -422,7 +424,7 @@ namespace DYE::DYEditor
         operation->DeletedSerializedEntity = SerializedObjectFactory::CreateSerializedEntity(entity);
         operation->IndexInWorldEntityArray = indexInWorldHandleArray;
 
-        sprintf(operation->Description, "Delete Entity '%s' (GUID: %s)", entity.TryGetName().value().c_str(), operation->EntityGUID.ToString().c_str());
+        sprintf(operation->Description, "Delete Entity '%s' (GUID: %s)", entity.TryGetName().value().GetString().c_str(), operation->EntityGUID.ToString().c_str());
 
         operation->pWorld->destroyEntityByGUIDButNotChildren(operation->EntityGUID);
 
@@ -458,7 +460,7 @@ namespace DYE::DYEditor
         }
 
         sprintf(operation->Description, "Move Entity '%s' from %d to %d",
-                entity.TryGetName().value().c_str(),
+                entity.TryGetName().value().GetString().c_str(),
                 indexBeforeMove,
                 indexToInsert);
 
@@ -508,8 +510,8 @@ namespace DYE::DYEditor
             char operationDescription[128] = "";
             sprintf(operationDescription,
                     "Set the parent of '%s' to '%s'",
-                    entity.TryGetName().value().c_str(),
-                    newParent.TryGetName().value().c_str());
+                    entity.TryGetName().value().GetString().c_str(),
+                    newParent.TryGetName().value().GetString().c_str());
             Undo::StartGroupOperation(operationDescription);
         }
 
@@ -541,8 +543,6 @@ namespace DYE::DYEditor
             indexInParent = -1;
         }
 
-        std::vector<Entity> newParentAndItsChildren = EntityUtil::GetEntityAndAllChildrenPreorder(newParent);
-
         // When the offset is -1, we want to place it at the end of the parent hierarchy.
         bool const insertAtTheLastLocationInParentHierarchy = indexInParent == -1;
 
@@ -550,7 +550,7 @@ namespace DYE::DYEditor
         int flatInsertIndexOffset = 0;
         if (insertAtTheLastLocationInParentHierarchy)
         {
-            flatInsertIndexOffset = newParentAndItsChildren.size();
+            flatInsertIndexOffset = EntityUtil::CountEntityAndAllChildren(newParent);
         }
         else if (indexInParent == 0)
         {
@@ -559,15 +559,23 @@ namespace DYE::DYEditor
         else
         {
             // We start from 1 because 0 is the new parent.
-            for (flatInsertIndexOffset = 1; flatInsertIndexOffset < newParentAndItsChildren.size(); flatInsertIndexOffset++)
-            {
-                Entity child = newParentAndItsChildren[flatInsertIndexOffset];
-                if (child.TryGetGUID().value() == pNewParentEntityChildrenComponent->TryGetChildGUIDAt(indexInParent).value())
-                {
-                    // We find the flat index, break.
-                    break;
-                }
-            }
+            GUID const childGUIDAtIndexInParent = pNewParentEntityChildrenComponent->TryGetChildGUIDAt(indexInParent).value();
+            flatInsertIndexOffset = 1;
+            EntityUtil::ForEachChildPreorder
+                (
+                    newParent,
+                    [&flatInsertIndexOffset, childGUIDAtIndexInParent](Entity child)
+                    {
+                        if (child.TryGetGUID().value() == childGUIDAtIndexInParent)
+                        {
+                            // We find the flat index, stop the iteration.
+                            return false;
+                        }
+
+                        flatInsertIndexOffset++;
+                        return true;
+                    }
+                );
         }
 
         int indexToInsert = parentIndex + flatInsertIndexOffset;
@@ -734,7 +742,7 @@ namespace DYE::DYEditor
         if (!isAlreadyInGroupOperationBeforeThisFunctionCall)
         {
             char operationDescription[128] = "";
-            sprintf(operationDescription, "Move Entity '%s' at Top Hierarchy", entity.TryGetName().value().c_str());
+            sprintf(operationDescription, "Move Entity '%s' at Top Hierarchy", entity.TryGetName().value().GetString().c_str());
             Undo::StartGroupOperation(operationDescription);
         }
 
@@ -828,7 +836,7 @@ namespace DYE::DYEditor
 
         sprintf(&operation->Description[0], "Modify %s of Entity '%s' (GUID: %s)",
                 componentTypeName.c_str(),
-                entity.TryGetName().value().c_str(),
+                entity.TryGetName().value().GetString().c_str(),
                 operation->EntityGUID.ToString().c_str());
 
         auto tryGetComponentTypeDescriptor = TypeRegistry::TryGetComponentTypeDescriptor(componentTypeName);
@@ -851,7 +859,7 @@ namespace DYE::DYEditor
 
         sprintf(&operation->Description[0], "Add %s to Entity '%s' (GUID: %s)",
                 componentTypeName.c_str(),
-                entity.TryGetName().value().c_str(),
+                entity.TryGetName().value().GetString().c_str(),
                 operation->EntityGUID.ToString().c_str());
 
         operation->TypeDescriptor.Add(entity);
@@ -884,7 +892,7 @@ namespace DYE::DYEditor
 
         sprintf(&operation->Description[0], "Remove %s from Entity '%s' (GUID: %s)",
                 componentTypeName.c_str(),
-                entity.TryGetName().value().c_str(),
+                entity.TryGetName().value().GetString().c_str(),
                 operation->EntityGUID.ToString().c_str());
 
         operation->TypeDescriptor.Remove(entity);
@@ -68,7 +68,7 @@ namespace DYE::DYEditor
                 if (windowHandle.IsCreated)
                 {
                     DYE_LOG("The window handle entity '%s' has already been assigned a window, "
-                            "cannot create a new one with it.", wrappedEntity.TryGetName().value().c_str());
+                            "cannot create a new one with it.", wrappedEntity.TryGetName().value().GetString().c_str());
                     wrappedEntity.RemoveComponent<CreateWindowComponent>();
                     continue;
                 }
@@ -11,6 +11,16 @@
 
 namespace DYE::DYEditor
 {
+    namespace
+    {
+        template<typename T>
+        std::size_t getStorageBytes(entt::registry &registry)
+        {
+            // Component + packed entity + sparse entry.
+            return registry.storage<T>().size() * (sizeof(T) + 2 * sizeof(EntityIdentifier));
+        }
+    }
+
     World::World()
     {
     }
@@ -33,7 +43,7 @@ namespace DYE::DYEditor
 #endif
 
         m_EntityHandles.push_back(EntityHandle {.Identifier = entity.m_EntityIdentifier});
-        m_GUIDToEntityIdentifierMap.insert({guid, entity.m_EntityIdentifier});
+        trackGUID(guid, entity.m_EntityIdentifier);
 
         return entity;
     }
@@ -50,7 +60,7 @@ namespace DYE::DYEditor
 #endif
 
         m_EntityHandles.insert(m_EntityHandles.begin() + index, EntityHandle {.Identifier = entity.m_EntityIdentifier});
-        m_GUIDToEntityIdentifierMap.insert({guid, entity.m_EntityIdentifier});
+        trackGUID(guid, entity.m_EntityIdentifier);
 
         return entity;
     }
@@ -66,11 +76,49 @@ namespace DYE::DYEditor
 #endif
 
         m_EntityHandles.push_back(EntityHandle {.Identifier = entity.m_EntityIdentifier});
-        m_GUIDToEntityIdentifierMap.insert({guid, entity.m_EntityIdentifier});
+        trackGUID(guid, entity.m_EntityIdentifier);
 
         return entity;
     }
 
+    std::vector<EntityIdentifier> const &World::createEntities(std::size_t count, InternedName name)
+    {
+        m_CreatedEntityIdentifiers.resize(count);
+        m_Registry.create(m_CreatedEntityIdentifiers.begin(), m_CreatedEntityIdentifiers.end());
+
+        m_CreatedEntityGUIDs.resize(count);
+        m_EntityGUIDFactory.Generate(m_CreatedEntityGUIDs);
+
+        // Reserve everything that is touched up front, so nothing is reallocated or rehashed in the middle of the batch.
+        m_EntityHandles.reserve(m_EntityHandles.size() + count);
+        reserveGUIDLookup(m_EntityHandles.size() + count);
+        m_Registry.storage<IDComponent>().reserve(m_Registry.storage<IDComponent>().size() + count);
+        m_Registry.storage<NameComponent>().reserve(m_Registry.storage<NameComponent>().size() + count);
+
+        auto const first = m_CreatedEntityIdentifiers.begin();
+        auto const last = m_CreatedEntityIdentifiers.end();
+        m_Registry.insert<IDComponent>(first, last);
+        m_Registry.insert<NameComponent>(first, last, NameComponent {.Name = name});
+
+#ifdef DYE_EDITOR
+        m_Registry.storage<EntityEditorOnlyMetadata>().reserve(m_Registry.storage<EntityEditorOnlyMetadata>().size() + count);
+        m_Registry.insert<EntityEditorOnlyMetadata>(first, last);
+#endif
+
+        auto &idStorage = m_Registry.storage<IDComponent>();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            EntityIdentifier const identifier = m_CreatedEntityIdentifiers[i];
+            GUID const guid = m_CreatedEntityGUIDs[i];
+
+            idStorage.get(identifier).ID = guid;
+            m_EntityHandles.push_back(EntityHandle {.Identifier = identifier});
+            trackGUID(guid, identifier);
+        }
+
+        return m_CreatedEntityIdentifiers;
+    }
+
     Entity World::WrapIdentifierIntoEntity(EntityIdentifier identifier)
     {
         return Entity(*this, identifier);
@@ -86,7 +134,10 @@ namespace DYE::DYEditor
         auto tryGetIndex = TryGetEntityIndex(entityToDestroy);
         DYE_ASSERT(tryGetIndex.has_value());
 
-        auto allChildren = EntityUtil::GetAllChildrenPreorder(entityToDestroy);
+        // Collect the children into a pooled scratch array because they are destroyed while the array is being iterated.
+        EntityUtil::ScratchVector<Entity> scratchChildren;
+        std::vector<Entity> &allChildren = scratchChildren.Get();
+        EntityUtil::GetAllChildrenPreorder(entityToDestroy, allChildren);
 
         // Where the entity is located at in the handle array.
         // We will use the same value for children later because the child index shifts down when we remove an entity at the index.
@@ -100,7 +151,7 @@ namespace DYE::DYEditor
             auto guid = tryGetGUID.value();
 
             // Remove it from the GUID map if it has a GUID/IDComponent.
-            m_GUIDToEntityIdentifierMap.erase(guid);
+            untrackGUID(guid);
 
             // If the entity has a parent, we need to remove its GUID from the parent's children list.
             auto tryGetParentComponent = entityToDestroy.TryGetComponent<ParentComponent>();
@@ -123,7 +174,7 @@ namespace DYE::DYEditor
             if (tryGetChildGUID.has_value())
             {
                 // Remove it from the GUID map if it has a GUID/IDComponent.
-                m_GUIDToEntityIdentifierMap.erase(tryGetChildGUID.value());
+                untrackGUID(tryGetChildGUID.value());
             }
 
             m_EntityHandles.erase(m_EntityHandles.begin() + indexInHandleArray);
@@ -133,19 +184,22 @@ namespace DYE::DYEditor
 
     void World::DestroyEntityAndChildrenWithGUID(GUID entityGUID)
     {
-        auto findItr = m_GUIDToEntityIdentifierMap.find(entityGUID);
-        if (findItr == m_GUIDToEntityIdentifierMap.end())
+        auto tryGetIdentifier = tryGetTrackedIdentifier(entityGUID);
+        if (!tryGetIdentifier.has_value())
         {
             // There is no entity with the given GUID recorded in the map, skip the function.
             return;
         }
 
-        auto identifier = findItr->second;
+        auto identifier = tryGetIdentifier.value();
         Entity entityToDestroy = WrapIdentifierIntoEntity(identifier);
         auto tryGetIndex = TryGetEntityIndex(entityToDestroy);
         DYE_ASSERT(tryGetIndex.has_value());
 
-        auto allChildren = EntityUtil::GetAllChildrenPreorder(entityToDestroy);
+        // Collect the children into a pooled scratch array because they are destroyed while the array is being iterated.
+        EntityUtil::ScratchVector<Entity> scratchChildren;
+        std::vector<Entity> &allChildren = scratchChildren.Get();
+        EntityUtil::GetAllChildrenPreorder(entityToDestroy, allChildren);
 
         // Where the entity is located at in the handle array.
         // We will use the same value for children later because the child index shifts down when we remove an entity at the index.
@@ -162,7 +216,7 @@ namespace DYE::DYEditor
         }
 
         // Destroy the entity.
-        m_GUIDToEntityIdentifierMap.erase(entityGUID);
+        untrackGUID(entityGUID);
         m_EntityHandles.erase(m_EntityHandles.begin() + indexInHandleArray);
         m_Registry.destroy(entityToDestroy.m_EntityIdentifier);
 
@@ -173,7 +227,7 @@ namespace DYE::DYEditor
             if (tryGetChildGUID.has_value())
             {
                 // Remove it from the GUID map if it has a GUID/IDComponent.
-                m_GUIDToEntityIdentifierMap.erase(tryGetChildGUID.value());
+                untrackGUID(tryGetChildGUID.value());
             }
 
             m_EntityHandles.erase(m_EntityHandles.begin() + indexInHandleArray);
@@ -286,14 +340,89 @@ namespace DYE::DYEditor
 
     std::optional<Entity> World::TryGetEntityWithGUID(GUID entityGUID)
     {
-        auto findItr = m_GUIDToEntityIdentifierMap.find(entityGUID);
-        if (findItr == m_GUIDToEntityIdentifierMap.end())
+        auto tryGetIdentifier = tryGetTrackedIdentifier(entityGUID);
+        if (!tryGetIdentifier.has_value())
         {
             // There is no entity with the given GUID recorded in the map.
             return {};
         }
 
-        return Entity(*this, findItr->second);
+        return Entity(*this, tryGetIdentifier.value());
+    }
+
+    std::optional<Entity> World::TryGetEntityWithName(InternedName name)
+    {
+        if (m_pNameIndex != nullptr)
+        {
+            if (m_pNameIndex->IsDirty)
+            {
+                rebuildNameIndex();
+            }
+
+            auto findItr = m_pNameIndex->NameToEntityIdentifierMap.find(name);
+            if (findItr == m_pNameIndex->NameToEntityIdentifierMap.end())
+            {
+                return {};
+            }
+
+            return Entity(*this, findItr->second);
+        }
+
+        for (auto [identifier, nameComponent]: m_Registry.view<NameComponent>().each())
+        {
+            if (nameComponent.Name == name)
+            {
+                return Entity(*this, identifier);
+            }
+        }
+
+        return {};
+    }
+
+    void World::SetNameIndexEnabled(bool enabled)
+    {
+        if (enabled == IsNameIndexEnabled())
+        {
+            return;
+        }
+
+        if (enabled)
+        {
+            m_pNameIndex = std::make_unique<NameIndex>();
+            m_Registry.on_construct<NameComponent>().connect<&NameIndex::MarkDirty>(*m_pNameIndex);
+            m_Registry.on_update<NameComponent>().connect<&NameIndex::MarkDirty>(*m_pNameIndex);
+            m_Registry.on_destroy<NameComponent>().connect<&NameIndex::MarkDirty>(*m_pNameIndex);
+        }
+        else
+        {
+            m_Registry.on_construct<NameComponent>().disconnect<&NameIndex::MarkDirty>(*m_pNameIndex);
+            m_Registry.on_update<NameComponent>().disconnect<&NameIndex::MarkDirty>(*m_pNameIndex);
+            m_Registry.on_destroy<NameComponent>().disconnect<&NameIndex::MarkDirty>(*m_pNameIndex);
+            m_pNameIndex.reset();
+        }
+    }
+
+    WorldMemoryStatistics World::GetMemoryStatistics()
+    {
+        WorldMemoryStatistics statistics
+            {
+                .NumberOfEntities = m_EntityHandles.size(),
+                .EntityHandleBytes = m_EntityHandles.capacity() * sizeof(EntityHandle),
+                .GUIDLookupBytes = getGUIDLookupBytes()
+            };
+
+        statistics.BuiltInComponentBytes += getStorageBytes<IDComponent>(m_Registry);
+        statistics.BuiltInComponentBytes += getStorageBytes<NameComponent>(m_Registry);
+
+#ifdef DYE_EDITOR
+        statistics.BuiltInComponentBytes += getStorageBytes<EntityEditorOnlyMetadata>(m_Registry);
+        for (auto [identifier, metadata]: m_Registry.view<EntityEditorOnlyMetadata>().each())
+        {
+            statistics.BuiltInComponentBytes += metadata.SuccessfullyDeserializedComponentNames.capacity() * sizeof(std::string);
+        }
+#endif
+
+        return statistics;
     }
 
     std::optional<std::size_t> World::TryGetEntityIndex(Entity const &entity)
@@ -332,7 +461,7 @@ namespace DYE::DYEditor
     void World::Reserve(std::size_t capacity)
     {
         m_EntityHandles.reserve(capacity);
-        m_GUIDToEntityIdentifierMap.reserve(capacity);
+        reserveGUIDLookup(capacity);
         m_Registry.reserve(capacity);
         // TODO: Update syntax to EnTT 3.12.2
         //m_Registry.storage<EntityIdentifier>().reserve(capacity);
@@ -341,7 +470,7 @@ namespace DYE::DYEditor
     void World::Clear()
     {
         m_EntityHandles.clear();
-        m_GUIDToEntityIdentifierMap.clear();
+        clearGUIDLookup();
         // TODO: figure out why sometimes this registry.clear() can trigger assert error,
         //		 this only happens in EnTT 3.12.2.
         m_Registry.clear();
@@ -360,9 +489,12 @@ namespace DYE::DYEditor
         DYE_ASSERT_LOG_WARN(tryGetGUID.has_value(), "The given entity %d doesn't have a GUID (i.e. IDComponent), cannot be tracked.", entity.GetIdentifier());
 
         auto guid = tryGetGUID.value();
-        DYE_ASSERT_LOG_WARN(!m_GUIDToEntityIdentifierMap.contains(guid), "The given entity's GUID (%s) has already been tracked in the map.", guid.ToString().c_str());
+        auto tryGetTrackedEntity = tryGetTrackedIdentifier(guid);
+        // Without the GUID map, the lookup searches the IDComponent storage and therefore finds the entity itself.
+        DYE_ASSERT_LOG_WARN(!tryGetTrackedEntity.has_value() || tryGetTrackedEntity.value() == entity.m_EntityIdentifier,
+                            "The given entity's GUID (%s) has already been tracked in the map.", guid.ToString().c_str());
 
-        m_GUIDToEntityIdentifierMap.insert({tryGetGUID.value(), entity.m_EntityIdentifier});
+        trackGUID(guid, entity.m_EntityIdentifier);
     }
 
     void World::destroyEntityButNotChildren(Entity entity)
@@ -373,7 +505,7 @@ namespace DYE::DYEditor
         if (tryGetGUID.has_value())
         {
             // Remove it from the GUID map if it has a GUID/IDComponent.
-            m_GUIDToEntityIdentifierMap.erase(tryGetGUID.value());
+            untrackGUID(tryGetGUID.value());
         }
 
         // Remove the identifier from the handles array.
@@ -390,17 +522,17 @@ namespace DYE::DYEditor
 
     void World::destroyEntityByGUIDButNotChildren(DYE::GUID entityGUID)
     {
-        auto findItr = m_GUIDToEntityIdentifierMap.find(entityGUID);
-        if (findItr == m_GUIDToEntityIdentifierMap.end())
+        auto tryGetIdentifier = tryGetTrackedIdentifier(entityGUID);
+        if (!tryGetIdentifier.has_value())
         {
             // There is no entity with the given GUID recorded in the map, skip the function.
             return;
         }
 
-        auto identifier = findItr->second;
+        auto identifier = tryGetIdentifier.value();
 
         // Remove it from the GUID map.
-        m_GUIDToEntityIdentifierMap.erase(findItr);
+        untrackGUID(entityGUID);
 
         // Remove the identifier from the handles array.
         auto newEnd = std::remove_if(m_EntityHandles.begin(), m_EntityHandles.end(),
@@ -438,4 +570,214 @@ namespace DYE::DYEditor
                 }
             );
     }
+
+    void World::rebuildNameIndex()
+    {
+        auto &nameToEntityIdentifierMap = m_pNameIndex->NameToEntityIdentifierMap;
+        nameToEntityIdentifierMap.clear();
+
+        auto nameView = m_Registry.view<NameComponent>();
+        nameToEntityIdentifierMap.reserve(nameView.size());
+        for (auto [identifier, nameComponent]: nameView.each())
+        {
+            nameToEntityIdentifierMap.try_emplace(nameComponent.Name, identifier);
+        }
+
+        m_pNameIndex->IsDirty = false;
+    }
+
+#if defined(DYE_LEAN_RUNTIME_WORLD) && defined(DYE_LEAN_RUNTIME_WORLD_WITHOUT_GUID_MAP)
+    void World::trackGUID(GUID guid, EntityIdentifier identifier)
+    {
+    }
+
+    void World::untrackGUID(GUID guid)
+    {
+    }
+
+    std::optional<EntityIdentifier> World::tryGetTrackedIdentifier(GUID guid)
+    {
+        for (auto [identifier, idComponent]: m_Registry.view<IDComponent>().each())
+        {
+            if (idComponent.ID == guid)
+            {
+                return identifier;
+            }
+        }
+
+        return {};
+    }
+
+    void World::reserveGUIDLookup(std::size_t capacity)
+    {
+    }
+
+    void World::clearGUIDLookup()
+    {
+    }
+
+    std::size_t World::getGUIDLookupBytes() const
+    {
+        return 0;
+    }
+#elif defined(DYE_LEAN_RUNTIME_WORLD)
+    void World::trackGUID(GUID guid, EntityIdentifier identifier)
+    {
+        // Appended to the unsorted tail, so a batch of creation is sorted once on the next lookup.
+        m_GUIDEntries.push_back(GUIDEntry {.EntityGUID = guid, .Identifier = identifier});
+    }
+
+    void World::untrackGUID(GUID guid)
+    {
+        // Only the first untrack after a batch of creation pays for the sort,
+        // destroying a subtree or a batch of entities is a binary search per entity.
+        sortGUIDEntries();
+
+        auto const entryItr = findSortedGUIDEntry(guid);
+        if (entryItr == m_GUIDEntries.end())
+        {
+            return;
+        }
+
+        entryItr->Identifier = entt::null;
+        m_NumberOfGUIDEntryTombstones++;
+
+        if (m_NumberOfGUIDEntryTombstones * 2 > m_GUIDEntries.size())
+        {
+            removeGUIDEntryTombstones();
+        }
+    }
+
+    std::optional<EntityIdentifier> World::tryGetTrackedIdentifier(GUID guid)
+    {
+        sortGUIDEntries();
+
+        auto const entryItr = findSortedGUIDEntry(guid);
+        if (entryItr == m_GUIDEntries.end())
+        {
+            return {};
+        }
+
+        return entryItr->Identifier;
+    }
+
+    void World::reserveGUIDLookup(std::size_t capacity)
+    {
+        m_GUIDEntries.reserve(capacity);
+    }
+
+    void World::clearGUIDLookup()
+    {
+        m_GUIDEntries.clear();
+        m_NumberOfSortedGUIDEntries = 0;
+        m_NumberOfGUIDEntryTombstones = 0;
+    }
+
+    std::size_t World::getGUIDLookupBytes() const
+    {
+        return m_GUIDEntries.capacity() * sizeof(GUIDEntry);
+    }
+
+    void World::sortGUIDEntries()
+    {
+        if (m_NumberOfSortedGUIDEntries == m_GUIDEntries.size())
+        {
+            return;
+        }
+
+        auto const compareGUID = [](GUIDEntry const &lhs, GUIDEntry const &rhs)
+        {
+            return (std::uint64_t) lhs.EntityGUID < (std::uint64_t) rhs.EntityGUID;
+        };
+
+        auto const sortedEnd = m_GUIDEntries.begin() + (std::ptrdiff_t) m_NumberOfSortedGUIDEntries;
+        std::sort(sortedEnd, m_GUIDEntries.end(), compareGUID);
+        std::inplace_merge(m_GUIDEntries.begin(), sortedEnd, m_GUIDEntries.end(), compareGUID);
+
+        m_NumberOfSortedGUIDEntries = m_GUIDEntries.size();
+
+        // The merge is linear already, compact the entries while we are at it.
+        removeGUIDEntryTombstones();
+    }
+
+    void World::removeGUIDEntryTombstones()
+    {
+        if (m_NumberOfGUIDEntryTombstones == 0)
+        {
+            return;
+        }
+
+        // The tombstones are always in the sorted range, removing them keeps the relative order of the rest.
+        auto const sortedEnd = m_GUIDEntries.begin() + (std::ptrdiff_t) m_NumberOfSortedGUIDEntries;
+        auto const newSortedEnd = std::remove_if
+            (
+                m_GUIDEntries.begin(), sortedEnd,
+                [](GUIDEntry const &entry) { return entry.Identifier == entt::null; }
+            );
+        auto const newEnd = std::move(sortedEnd, m_GUIDEntries.end(), newSortedEnd);
+        m_GUIDEntries.erase(newEnd, m_GUIDEntries.end());
+
+        m_NumberOfSortedGUIDEntries = (std::size_t) (newSortedEnd - m_GUIDEntries.begin());
+        m_NumberOfGUIDEntryTombstones = 0;
+    }
+
+    std::vector<World::GUIDEntry>::iterator World::findSortedGUIDEntry(GUID guid)
+    {
+        auto const sortedEnd = m_GUIDEntries.begin() + (std::ptrdiff_t) m_NumberOfSortedGUIDEntries;
+        auto entryItr = std::lower_bound
+            (
+                m_GUIDEntries.begin(), sortedEnd, guid,
+                [](GUIDEntry const &entry, GUID guid) { return (std::uint64_t) entry.EntityGUID < (std::uint64_t) guid; }
+            );
+
+        // A GUID that has been untracked & tracked again has a tombstone next to the live entry.
+        for (; entryItr != sortedEnd && entryItr->EntityGUID == guid; ++entryItr)
+        {
+            if (entryItr->Identifier != entt::null)
+            {
+                return entryItr;
+            }
+        }
+
+        return m_GUIDEntries.end();
+    }
+#else
+    void World::trackGUID(GUID guid, EntityIdentifier identifier)
+    {
+        m_GUIDToEntityIdentifierMap.insert({guid, identifier});
+    }
+
+    void World::untrackGUID(GUID guid)
+    {
+        m_GUIDToEntityIdentifierMap.erase(guid);
+    }
+
+    std::optional<EntityIdentifier> World::tryGetTrackedIdentifier(GUID guid)
+    {
+        auto findItr = m_GUIDToEntityIdentifierMap.find(guid);
+        if (findItr == m_GUIDToEntityIdentifierMap.end())
+        {
+            return {};
+        }
+
+        return findItr->second;
+    }
+
+    void World::reserveGUIDLookup(std::size_t capacity)
+    {
+        m_GUIDToEntityIdentifierMap.reserve(capacity);
+    }
+
+    void World::clearGUIDLookup()
+    {
+        m_GUIDToEntityIdentifierMap.clear();
+    }
+
+    std::size_t World::getGUIDLookupBytes() const
+    {
+        // Each node holds the key-value pair, the next pointer & the cached hash.
+        return m_GUIDToEntityIdentifierMap.bucket_count() * sizeof(void *) +
+               m_GUIDToEntityIdentifierMap.size() * (sizeof(Map::value_type) + sizeof(void *) + sizeof(std::size_t));
+    }
+#endif
 }
\ No newline at end of file
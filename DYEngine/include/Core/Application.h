@@ -8,9 +8,12 @@
 #include "LayerStack.h"
 #include "LayerBase.h"
 #include "ImGui/ImGuiLayer.h"
+#include "Input/InputRecording.h"
+#include "Graphics/RenderThread.h"
 
 #include <memory>
 #include <vector>
+#include <filesystem>
 
 namespace DYE
 {
@@ -28,6 +31,22 @@ namespace DYE
         std::shared_ptr<LayerBase> Layer;
     };
 
+    /// Settings for running the application in headless mode, i.e. without a window, graphics context, ImGui and audio device.
+    /// Useful for running simulation & benchmarks on build servers without a display.
+    struct HeadlessRunProperties
+    {
+        /// The application quits after running the given number of frames. 0 means no limit.
+        std::uint64_t MaxNumberOfFrames = 0;
+
+        /// The application quits after running for the given number of seconds (wall-clock time). 0 means no limit.
+        double MaxDurationInSeconds = 0;
+
+        /// If true, every frame advances the game time by exactly one fixed delta time regardless of the wall-clock time,
+        /// which means the loop runs unlocked (as fast as possible) while the simulation result stays deterministic.
+        /// Otherwise the measured frame time is used like a normal run.
+        bool UseFixedDeltaTime = true;
+    };
+
     class Application : public EventHandler
     {
     public:
@@ -37,6 +56,11 @@ namespace DYE
 
         explicit Application(WindowProperties mainWindowProperties, int fixedFramePerSecond = 60);
 
+        /// Create the application in headless mode.
+        /// Render submissions go to a NullRenderPipeline which only records statistics,
+        /// and a timing summary is logged when the application quits.
+        explicit Application(HeadlessRunProperties headlessRunProperties, int fixedFramePerSecond = 60);
+
         virtual ~Application();
 
         /// App Entrypoint
@@ -48,7 +72,32 @@ namespace DYE
         void PopLayer(const std::shared_ptr<LayerBase> &layer);
         void PushOverlay(const std::shared_ptr<LayerBase> &overlay);
         void PopOverlay(const std::shared_ptr<LayerBase> &overlay);
-        ImGuiLayer &GetImGuiLayer() { return *m_ImGuiLayer; }
+        /// \return the ImGuiLayer of the application, nullptr in headless mode because there is no ImGuiLayer.
+        ImGuiLayer *TryGetImGuiLayer() { return m_ImGuiLayer.get(); }
+        bool IsHeadless() const { return m_IsHeadless; }
+
+        /// Record the input states & delta time of every frame into the file at the given path, until StopInputRecording is called.
+        /// \param guidSeed the seed the entity GUIDs of the session are generated with, see GetInputReplayGUIDSeed.
+        /// \return true if the recording has started.
+        bool StartInputRecording(std::filesystem::path const &path, std::uint64_t guidSeed);
+        void StopInputRecording();
+        bool IsRecordingInput() const { return m_InputRecorder.IsOpen(); }
+
+        /// Feed InputManager & Time with the input states & delta times recorded in the given file instead of the live devices.
+        /// The replay stops automatically when the end of the recording is reached.
+        /// \return true if the replay has started.
+        bool StartInputReplay(std::filesystem::path const &path);
+        void StopInputReplay();
+        bool IsReplayingInput() const { return m_InputReplayer.IsOpen(); }
+        /// The GUID seed of the recorded session, the replaying session should seed its worlds with it unless it is 0.
+        std::uint64_t GetInputReplayGUIDSeed() const { return m_InputReplayer.GetGUIDSeed(); }
+
+        /// Render the frame packets on a dedicated render thread while the next frame is being simulated, with one frame of latency.
+        /// The change is applied at the beginning of the next frame. It's ignored in headless mode.
+        /// While enabled, the layers must not use the render API in OnFixedUpdate, OnUpdate & OnRender (see RenderThread).
+        void SetThreadedRendering(bool enable) { m_UseThreadedRendering = enable; }
+        bool IsThreadedRendering() const { return m_RenderThread.IsRunning(); }
+        RenderThreadStatistics const &GetRenderThreadStatisticsLastFrame() const { return m_RenderThread.GetStatisticsLastFrame(); }
 
     protected:
         void pushLayerImmediate(const std::shared_ptr<LayerBase> &layer);
@@ -62,6 +111,7 @@ namespace DYE
     private:
         void handleOnApplicationQuit(ApplicationQuitEvent const &event);
         void handleOnWindowClose(const WindowCloseEvent &event);
+        void logHeadlessRunSummary(std::uint64_t numberOfFrames, double totalSeconds, double minFrameMilliseconds, double maxFrameMilliseconds) const;
 
     protected:
         /// The main event system that poll events from the framework (SDL/GLFW for instance)
@@ -72,8 +122,17 @@ namespace DYE
         LayerStack m_LayerStack;
         std::vector<ApplicationLayerOperation> m_LayerOperations;
 
+        InputRecorder m_InputRecorder;
+        InputReplayer m_InputReplayer;
+
         /// A Flag to show if the game is still running, when WindowCloseEvent is fired, it's set to false
         bool m_IsRunning = false;
+
+        bool m_IsHeadless = false;
+        HeadlessRunProperties m_HeadlessRunProperties;
+
+        bool m_UseThreadedRendering = false;
+        RenderThread m_RenderThread;
     };
 
     // To be defined in CLIENT code
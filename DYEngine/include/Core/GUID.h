@@ -2,7 +2,10 @@
 
 #include <string>
 #include <functional>
+#include <atomic>
 #include <cstdint>
+#include <optional>
+#include <span>
 
 namespace DYE
 {
@@ -31,14 +34,38 @@ namespace DYE
         std::uint64_t m_GUID = 0;
     };
 
+    /// Generate GUIDs with a splitmix64 generator: a counter that is advanced atomically & scrambled with a bijective mix function.
+    /// Therefore one factory never produces the same GUID twice (before the 2^64 period wraps around), and the GUIDs of
+    /// factories with different random seeds collide with the usual 64-bit probability.
+    /// Generate is thread-safe & lock-free.
     class GUIDFactory
     {
     public:
-        // Although this function works statically right now (i.e. all factory instance using the same random generator),
-        // it is not marked as static. Because at some point we want to support multiple factory instances for different systems
-        // instead of one static instance only.
-        // For instance, scene/prefab local identifier & asset identifier etc
+        /// Seeded with std::random_device, or derived from the deterministic seed if one is set (see SetDeterministicSeed).
+        GUIDFactory();
+        explicit GUIDFactory(std::uint64_t seed);
+
+        // Copies would generate the same sequence of GUIDs.
+        GUIDFactory(GUIDFactory const &other) = delete;
+        GUIDFactory &operator=(GUIDFactory const &other) = delete;
+        GUIDFactory(GUIDFactory &&other) noexcept;
+        GUIDFactory &operator=(GUIDFactory &&other) noexcept;
+
+        /// Restart the sequence, the same seed always produces the same sequence of GUIDs (i.e. for replays & tests).
+        void SetSeed(std::uint64_t seed);
+
         GUID Generate();
+
+        /// Fill the given range with newly generated GUIDs, cheaper than calling Generate for each of them
+        /// because the counter is only advanced once.
+        void Generate(std::span<GUID> outGUIDs);
+
+        /// Make the factories that are default-constructed afterwards deterministic, the n-th of them is seeded with a value derived from the seed & n.
+        /// Pass std::nullopt to go back to the random seeds. It should be called before the factories are created (i.e. before loading a replay).
+        static void SetDeterministicSeed(std::optional<std::uint64_t> seed);
+
+    private:
+        std::atomic<std::uint64_t> m_State;
     };
 }
 
@@ -8,10 +8,14 @@
 namespace DYE
 {
     class Application;
+    class InputRecorder;
+    class InputReplayer;
 
     class Time
     {
         friend class Application;
+        friend class InputRecorder;
+        friend class InputReplayer;
 
     public:
         static Time &GetInstance() { return s_Instance; }
@@ -22,10 +26,10 @@ namespace DYE
         Time(const Time &) = delete;
 
         /// The time in second that has passed since the last frame
-        /// \return m_DeltaTicks / 1000.0
-        double DeltaTime() const { return m_DeltaTicks / 1000.0; }
+        /// \return m_DeltaTicks / 1000.0, or the overridden delta time in headless fixed step mode
+        double DeltaTime() const { return m_DeltaTime; }
 
-        float DeltaTimeF() const { return m_DeltaTicks / 1000.0f; }
+        float DeltaTimeF() const { return static_cast<float>(m_DeltaTime); }
 
         /// A fixed delta time in second for Physics Simulation, const value
         /// \return 1 / m_Fps
@@ -35,13 +39,19 @@ namespace DYE
 
         uint32_t FixedFramePerSecond() const { return m_FixedFramePerSecond; }
 
+        /// How far the current frame is between the last FixedUpdate and the next one, in the range of [0, 1).
+        /// Use it to blend the state of the last two fixed updates when rendering, see InterpolateTransformComponent.
+        double FixedUpdateInterpolationAlpha() const { return m_FixedUpdateInterpolationAlpha; }
+
+        float FixedUpdateInterpolationAlphaF() const { return static_cast<float>(m_FixedUpdateInterpolationAlpha); }
+
     private:
 
         Time() = default;
 
         /// The created Time instance is assigned as the singleton instance
         /// \param fixedFps The number of frames per second in FixedUpdate event, used to determine FixedDeltaTime()
-        explicit Time(uint32_t fixedFps) : m_FixedFramePerSecond(fixedFps), m_LastTicks(0), m_TicksSinceStart(0), m_DeltaTicks(0)
+        explicit Time(uint32_t fixedFps) : m_FixedFramePerSecond(fixedFps), m_LastTicks(0), m_TicksSinceStart(0), m_DeltaTicks(0), m_DeltaTime(0)
         {
         }
 
@@ -60,10 +70,26 @@ namespace DYE
         /// Get updated everytime tickUpdate() is called
         uint32_t m_DeltaTicks;
 
+        /// The delta time in second, normally m_DeltaTicks / 1000.0.
+        /// Stored separately so a delta time that is not a whole number of ticks (i.e. 1 / 60 second) can be represented exactly.
+        double m_DeltaTime;
+
+        /// The leftover of the fixed update accumulator divided by FixedDeltaTime, set after the fixed updates of each frame.
+        double m_FixedUpdateInterpolationAlpha = 0;
+
         /// Initialize tick variable, called at the start of the game loop
         void tickInit();
 
         /// Update deltaTime, called at the end of each frame
         void tickUpdate();
+
+        /// Replace the delta ticks of the current frame, used to replay a recorded sequence of frame times.
+        void overrideDeltaTicks(uint32_t deltaTicks);
+
+        /// Replace the delta time of the current frame with the given seconds, used to step the game loop at a fixed rate.
+        void overrideDeltaTime(double deltaTime);
+
+        /// Store the leftover of the fixed update accumulator, called after the fixed updates of each frame.
+        void setFixedUpdateAccumulator(double deltaTimeAccumulator);
     };
 }
\ No newline at end of file
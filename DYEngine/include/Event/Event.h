@@ -45,8 +45,9 @@ namespace DYE
     /// Every derived final class should have this.
     /// \param type: EventType. For instance, EventType::KeyDown
 #define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::type; }\
+                                static constexpr char const *GetStaticName() { return #type; }\
                                 virtual EventType GetEventType() const override { return GetStaticType(); }\
-                                virtual std::string GetName() const override { return #type; }\
+                                virtual char const *GetName() const override { return GetStaticName(); }\
 
 
     /// Event data structure
@@ -72,6 +73,23 @@ namespace DYE
         bool IsUsed = false;
     };
 
+    /// Call the given function with the event downcast to TEvent if the event is of type TEvent.
+    /// The type check compares EventType values, no RTTI or name comparison is involved.
+    /// \return true if the event is of type TEvent and the function has been called.
+    template<typename TEvent, typename TFunction>
+    bool DispatchEventAs(Event &event, TFunction &&function)
+    {
+        static_assert(std::is_base_of<Event, TEvent>::value, "TEvent must inherit from Event.");
+
+        if (event.GetEventType() != TEvent::GetStaticType())
+        {
+            return false;
+        }
+
+        function(static_cast<TEvent &>(event));
+        return true;
+    }
+
     /// EventHandleFunction handles all the Events emit by an EventSystemBase
     class EventHandler : public MessageHandlerBase<Event>
     {
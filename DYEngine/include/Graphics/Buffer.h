@@ -162,6 +162,11 @@ namespace DYE
         std::uint32_t m_Stride = 0;
     };
 
+    /// Passed to the buffer constructors to wrap a buffer object that is owned by something else (i.e. StreamingBuffer).
+    struct BufferViewTag
+    {
+    };
+
     /// Vertex Buffer class wrapper.
     /// Current implementation is in OpenGL
     class VertexBuffer
@@ -186,6 +191,10 @@ namespace DYE
         /// Avoid using this constructor, use IndexBuffer::Create instead.
         VertexBuffer(void *vertices, std::uint32_t size, BufferUsageHint usage);
 
+        /// Wrap a buffer object owned by something else, the buffer object is not created nor reallocated by this instance.
+        /// Avoid using this constructor, use StreamingBuffer::CreateVertexBufferView instead.
+        VertexBuffer(BufferViewTag, BufferID id) : m_ID(id) {}
+
         virtual ~VertexBuffer() = default;
 
         virtual void Bind() const;
@@ -209,6 +218,8 @@ namespace DYE
         /// Set the vertex attribute/element layout
         /// \param layout
         virtual void SetLayout(const VertexLayout &layout) { m_Layout = layout; }
+
+        BufferID GetID() const { return m_ID; }
     private:
         BufferID m_ID {};
         VertexLayout m_Layout;
@@ -238,6 +249,10 @@ namespace DYE
         /// Avoid using this constructor, use IndexBuffer::Create instead
         IndexBuffer(std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage);
 
+        /// Wrap a buffer object owned by something else, the buffer object is not created nor reallocated by this instance.
+        /// Avoid using this constructor, use StreamingBuffer::CreateIndexBufferView instead.
+        IndexBuffer(BufferViewTag, BufferID id) : m_ID(id) {}
+
         virtual ~IndexBuffer() = default;
 
         virtual void Bind() const;
@@ -246,6 +261,7 @@ namespace DYE
         void ResetData(std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage = BufferUsageHint::StaticDraw);
 
         std::uint32_t GetCount() const { return m_IndicesCount; };
+        BufferID GetID() const { return m_ID; }
 
     private:
         BufferID m_ID {};
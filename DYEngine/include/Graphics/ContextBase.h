@@ -31,6 +31,9 @@ namespace DYE
         /// Make the context as the current context for rendering on the given window.
         virtual void MakeCurrentForWindow(WindowBase const &window) = 0;
 
+        /// Detach the context from the calling thread, so that it can be made current on another thread (i.e. the render thread).
+        virtual void ReleaseCurrentForWindow(WindowBase const &window) = 0;
+
     protected:
         /// Since we need to make the default ctor trivial (to avoid throwing exceptions),
         /// init() is used to initialize the internal context state instead.
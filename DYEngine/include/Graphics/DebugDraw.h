@@ -3,9 +3,11 @@
 #include "Graphics/Camera.h"
 
 #include <glm/glm.hpp>
-#include <glm/gtc/type_ptr.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace DYE
@@ -16,69 +18,158 @@ namespace DYE
 
     class ShaderProgram;
 
+    class StreamingBuffer;
+
+    enum class PrimitiveType;
+
+    struct DebugDrawStatistics
+    {
+        std::uint32_t NumberOfLines = 0;
+        std::uint32_t NumberOfGeometryInstances = 0;
+
+        /// The number of primitives that are not rendered because the per-frame budget (or the streaming buffer) is exhausted.
+        std::uint32_t NumberOfDroppedPrimitives = 0;
+    };
+
+    /// Immediate mode gizmo drawing, the gizmos are rendered on top of every camera at the end of the frame.
+    ///
+    /// The draw functions can be called from any thread (i.e. worker threads of a parallel system),
+    /// each thread records into its own buffers which are merged at render time.
+    /// The draw data is captured into the frame packet at the end of the frame, so it's safe to draw while the previous frame is being rendered.
+    /// The capture doesn't synchronize with the threads that are still drawing: the parallel work of the frame has to be joined
+    /// before the frame packet is captured, which is asserted in debug builds.
     class DebugDraw
     {
         friend RenderPipelineManager;
 
     private:
-        struct GeometryInstancedArrays
+        struct LineVertex
         {
-            int NumberOfInstances = 0;
-            std::vector<float> Colors;
-            std::vector<float> ModelMatrices;
+            glm::vec3 Position;
+            glm::vec4 Color;
+        };
+        static_assert(sizeof(LineVertex) == sizeof(float) * 7, "LineVertex should be tightly packed to match the vertex layout.");
 
-            /// The VBO which stores per-instance color is located at index 2 in Geometry VAO.
-            constexpr const static std::uint32_t ColorVBOIndex = 1;
+        struct GeometryInstance
+        {
+            glm::vec4 Color;
+            glm::mat4 ModelMatrix;
+        };
+        static_assert(sizeof(GeometryInstance) == sizeof(float) * 20, "GeometryInstance should be tightly packed to match the vertex layout.");
 
-            /// The VBO which stores per-instance model matrix is located at index 1 in Geometry VAO.
-            constexpr const static std::uint32_t ModelMatrixVBOIndex = 2;
+        /// The draw data recorded by one thread.
+        /// The vectors are cleared (not deallocated) every frame, so the capacity is retained across frames.
+        struct ThreadBuffers
+        {
+            std::vector<LineVertex> LineVertices;
+            std::vector<GeometryInstance> CubeInstances;
+            std::vector<GeometryInstance> WireCubeInstances;
+            std::vector<GeometryInstance> CircleInstances;
 
-            void AddInstance(glm::vec4 color, glm::mat4 modelMatrix)
+            void Append(ThreadBuffers const &other)
             {
-                Colors.insert(Colors.end(), glm::value_ptr(color), glm::value_ptr(color) + 4);
-                ModelMatrices.insert(ModelMatrices.end(), glm::value_ptr(modelMatrix), glm::value_ptr(modelMatrix) + 16);
-                NumberOfInstances++;
+                LineVertices.insert(LineVertices.end(), other.LineVertices.begin(), other.LineVertices.end());
+                CubeInstances.insert(CubeInstances.end(), other.CubeInstances.begin(), other.CubeInstances.end());
+                WireCubeInstances.insert(WireCubeInstances.end(), other.WireCubeInstances.begin(), other.WireCubeInstances.end());
+                CircleInstances.insert(CircleInstances.end(), other.CircleInstances.begin(), other.CircleInstances.end());
             }
 
             void Clear()
             {
-                ModelMatrices.clear();
-                Colors.clear();
-                NumberOfInstances = 0;
+                LineVertices.clear();
+                CubeInstances.clear();
+                WireCubeInstances.clear();
+                CircleInstances.clear();
             }
         };
 
+        /// The range of the data merged into the streaming buffer this frame.
+        struct StreamedRange
+        {
+            std::uint32_t FirstIndex = 0;
+            std::int32_t BaseVertex = 0;
+            std::uint32_t BaseInstance = 0;
+
+            /// The number of indices for the batched lines, the number of instances for the geometries.
+            std::uint32_t Count = 0;
+        };
+
+        /// The default budget fits in the streaming buffer even if every primitive is a cube (2 instances).
+        constexpr const static std::uint32_t DefaultPrimitiveBudgetPerFrame = 32768;
+
+        /// The size of the streaming buffer region used by debug draw in a frame.
+        constexpr const static std::uint32_t StreamingBufferCapacityPerFrame = 8 * 1024 * 1024;
+
         static std::shared_ptr<ShaderProgram> s_LineGizmoShaderProgram;
         static std::shared_ptr<ShaderProgram> s_GeometryGizmoShaderProgram;
 
+        /// All the per-frame vertex, index & instance data are written into this buffer,
+        /// the VAOs refer to it through buffer views.
+        static std::shared_ptr<StreamingBuffer> s_StreamingBuffer;
+        static bool s_IsStreamedThisFrame;
+
+        /// The buffers of the live threads that have called the draw functions.
+        /// A thread's buffers are unregistered when the thread exits, so transient threads don't leak them.
+        static std::mutex s_ThreadBuffersMutex;
+        static std::vector<std::unique_ptr<ThreadBuffers>> s_ThreadBuffers;
+        /// The draw data of the exited threads that hasn't been captured yet, guarded by s_ThreadBuffersMutex.
+        static ThreadBuffers s_ExitedThreadBuffers;
+
+        /// The buffers of all the threads merged when the frame packet is captured, this is what's streamed & rendered.
+        /// It's separated from the thread buffers so that the next frame can be recorded while this one is being rendered.
+        static ThreadBuffers s_FramePacketBuffers;
+
+        static std::uint32_t s_PrimitiveBudgetPerFrame;
+        static std::atomic<std::uint32_t> s_NumberOfPrimitivesThisFrame;
+        static std::atomic<std::uint32_t> s_NumberOfDroppedPrimitivesThisFrame;
+        static DebugDrawStatistics s_StatisticsLastFrame;
+
         static std::shared_ptr<VertexArray> s_BatchedLineVAO;
-        static std::vector<float> s_BatchedLineVertices;
-        static std::vector<std::uint32_t> s_BatchedLineIndices;
+        static StreamedRange s_BatchedLineRange;
 
         static std::shared_ptr<VertexArray> s_CubeVAO;
-        static GeometryInstancedArrays s_CubeInstancedArrays;
+        static StreamedRange s_CubeRange;
 
         static std::shared_ptr<VertexArray> s_WireCubeVAO;
-        static GeometryInstancedArrays s_WireCubeInstancedArrays;
+        static StreamedRange s_WireCubeRange;
 
         static std::shared_ptr<VertexArray> s_CircleVAO;
-        static GeometryInstancedArrays s_CircleInstancedArrays;
+        static StreamedRange s_CircleRange;
 
         static void initialize();
         static std::shared_ptr<VertexArray> createBatchedLineVAO();
         static std::shared_ptr<VertexArray> createCubeVAO();
         static std::shared_ptr<VertexArray> createWireCubeVAO();
         static std::shared_ptr<VertexArray> createWireCircleVAO();
+        static void addInstancedVertexBufferView(VertexArray &vao);
+
+        /// \return the buffers of the calling thread, created & registered on the first call of the thread and unregistered on its exit.
+        static ThreadBuffers &getThreadBuffers();
+
+        /// Count the primitives towards the per-frame budget.
+        /// \return false if the budget is exhausted, in which case the primitives should be dropped.
+        static bool tryConsumePrimitiveBudget(std::uint32_t numberOfPrimitives);
+
+        /// Move the draw data recorded by all the threads in this frame into the frame packet buffers.
+        static void captureFramePacket();
+
+        static void streamDebugDrawData();
+        static void streamBatchedLines();
+        static void streamGeometryInstances(std::vector<GeometryInstance> const &instances, StreamedRange &range);
 
         static void renderDebugDrawOnCamera(const Camera &camera);
         static void renderBatchedLineVAO(const Camera &camera);
-        static void renderLineGeometryVAO(VertexArray const &vao, GeometryInstancedArrays &instancedArrays);
-        static void renderTriangleGeometryVAO(const VertexArray &vao, DebugDraw::GeometryInstancedArrays &instancedArrays);
+        static void renderGeometryVAO(VertexArray const &vao, StreamedRange const &range, PrimitiveType primitiveType);
 
         static void clearDebugDraw();
 
     public:
-        [[deprecated("Line function is still buggy, avoid calling it more than 100 times a frame.")]]
+        /// Set the maximum number of primitives (a line, a cube or a circle) that can be drawn in a frame.
+        /// The primitives drawn after the budget is exhausted are dropped & counted in DebugDrawStatistics.
+        static void SetPrimitiveBudgetPerFrame(std::uint32_t budget) { s_PrimitiveBudgetPerFrame = budget; }
+        static std::uint32_t GetPrimitiveBudgetPerFrame() { return s_PrimitiveBudgetPerFrame; }
+        static DebugDrawStatistics const &GetStatisticsLastFrame() { return s_StatisticsLastFrame; }
+
         static void Line(glm::vec3 start, glm::vec3 end, glm::vec4 color);
         static void Cube(glm::vec3 center, glm::vec3 size, glm::vec4 color);
         static void AABB(glm::vec3 min, glm::vec3 max, glm::vec4 color);
@@ -86,4 +177,3 @@ namespace DYE
         static void Sphere(glm::vec3 center, float radius, glm::vec4 color);
     };
 }
-
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Graphics/UniformType.h"
+#include "Graphics/Shader.h"
 
 #include <string>
 #include <memory>
@@ -14,25 +15,36 @@ namespace DYE
 {
     class Texture;
 
-    class ShaderProgram;
-
     class RenderCommand;
 
+    class RenderCommandBuffer;
+
     class Material
     {
         friend RenderCommand;
+        friend RenderCommandBuffer;
 
     public:
         Material(std::string name, const std::shared_ptr<ShaderProgram> &shaderProgram);
         ~Material() = default;
 
         /// A factory function that creates a material from a shader program
-        /// \param shader
+        /// \param shader the program should be ready (see ShaderProgram::IsReady), because the material properties are reflected from its uniforms.
         /// \return a shared pointer to the newly created Material, return shared_ptr(nullptr) if failed
         static std::shared_ptr<Material> CreateFromShader(const std::string &name, std::shared_ptr<ShaderProgram> const &shader);
 
         std::string GetName() const { return m_Name; }
-        ShaderProgram &GetShaderProgram() const { return *m_Shader; }
+
+        /// \return the variant of the shader program with the enabled keywords of this material, it's compiled on first use.
+        /// While the variant is being compiled asynchronously, the base program (or the fallback shader program) is returned instead.
+        ShaderProgram &GetShaderProgram() const;
+
+        /// Enable a keyword declared in the shader ('#pragma keywords'), which selects another variant of the shader.
+        /// \return false if the shader doesn't declare the keyword.
+        bool EnableKeyword(const std::string &keyword);
+        bool DisableKeyword(const std::string &keyword);
+        bool IsKeywordEnabled(const std::string &keyword) const;
+        ShaderKeywordMask GetEnabledKeywordMask() const { return m_EnabledKeywordMask; }
 
         float GetFloat(const std::string &name) const;
         glm::vec2 GetFloat2(const std::string &name) const;
@@ -57,10 +69,11 @@ namespace DYE
     private:
         // Update the values of uniform variables based on property values.
         // Called during RenderCommand to bind values to shader program.
-        void updateUniformValuesToGPU() const;
+        void updateUniformValuesToGPU(RenderCommand &renderCommand) const;
 
     private:
         std::shared_ptr<ShaderProgram> m_Shader;
+        ShaderKeywordMask m_EnabledKeywordMask = 0;
 
         // Data to be serialized goes below here :)) for now
     private:
@@ -17,9 +17,12 @@ namespace DYE
 
     class RenderCommand;
 
+    class RenderCommandBuffer;
+
     class MaterialPropertyBlock
     {
         friend RenderCommand;
+        friend RenderCommandBuffer;
     public:
         float GetFloat(const std::string &name) const;
         glm::vec2 GetFloat2(const std::string &name) const;
@@ -41,10 +44,13 @@ namespace DYE
         void SetBool(const std::string &name, bool value);
         void SetTexture(const std::string &name, const std::shared_ptr<Texture> &texture);
 
+        /// \return true if no property has been set in the block.
+        bool IsEmpty() const;
+
     private:
         // Update the values of properties for the given shader.
         // Called in RenderCommand to bind values to shader program.
-        void updatePropertyValuesToGPU(ShaderProgram const &shaderProgram) const;
+        void updatePropertyValuesToGPU(RenderCommand &renderCommand, ShaderProgram const &shaderProgram) const;
 
     private:
         std::vector<std::pair<std::string, GLfloat>> m_FloatProperties {};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Graphics/RenderPipelineBase.h"
+
+#include <cstdint>
+
+namespace DYE
+{
+    /// A render pipeline that doesn't render anything but records statistics of the submissions.
+    /// It is used as the active pipeline when the application runs in headless mode (no window & graphics context).
+    class NullRenderPipeline final : public RenderPipelineBase
+    {
+    public:
+        struct Statistics
+        {
+            std::uint64_t NumberOfFrames = 0;
+            std::uint64_t NumberOfSubmissions = 0;
+            std::uint64_t NumberOfRenderedCameras = 0;
+            std::uint32_t MaxNumberOfSubmissionsPerFrame = 0;
+        };
+
+        void Submit(const std::shared_ptr<VertexArray> &vertexArray, const std::shared_ptr<Material> &material,
+                    glm::mat4 objectToWorldMatrix, MaterialPropertyBlock materialPropertyBlock) override;
+
+        Statistics const &GetStatistics() const { return m_Statistics; }
+        std::uint32_t GetNumberOfSubmissionsLastFrame() const { return m_NumberOfSubmissionsLastFrame; }
+
+    protected:
+        void onCaptureFramePacket() override;
+        void onPreRender() override;
+        void renderCamera(const Camera &camera) override;
+        void onPostRender() override;
+
+    private:
+        Statistics m_Statistics;
+        std::uint32_t m_NumberOfSubmissionsThisFrame = 0;
+        std::uint32_t m_NumberOfSubmissionsInFramePacket = 0;
+        std::uint32_t m_NumberOfSubmissionsLastFrame = 0;
+    };
+}
@@ -9,6 +9,10 @@ namespace DYE
 {
     std::string glGetErrorMessage();
     bool glCheckError(const char *functionName);
+
+    /// Whether OpenGL function pointers have been loaded, i.e. a graphics context has been created & made current.
+    /// It's false when the application runs in headless mode, in which case no GPU resources should be created.
+    bool IsOpenGLLoaded();
 }
 
 #ifdef DYE_DEBUG
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Graphics/RenderCommand.h"
+
+namespace DYE
+{
+    /// The render backend that issues the commands to OpenGL immediately.
+    class OpenGLRenderCommand final : public RenderCommand
+    {
+    public:
+        OpenGLRenderCommand();
+
+        glm::vec<2, std::uint32_t> GetMaxFramebufferSize() const override;
+
+        void SwapWindowBuffer(WindowBase const &windowBase) override;
+
+        using RenderCommand::SetViewport;
+        void SetViewport(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height) override;
+        void SetClearColor(const glm::vec4 &color) override;
+        void SetLinePrimitiveWidth(float width) override;
+
+        void Clear() override;
+        void ClearDepthStencilOnly() override;
+
+        void SetUniformFloat(UniformLocation location, float value) override;
+        void SetUniformFloat2(UniformLocation location, glm::vec2 const &value) override;
+        void SetUniformFloat3(UniformLocation location, glm::vec3 const &value) override;
+        void SetUniformFloat4(UniformLocation location, glm::vec4 const &value) override;
+        void SetUniformMat3(UniformLocation location, glm::mat3 const &value) override;
+        void SetUniformMat4(UniformLocation location, glm::mat4 const &value) override;
+        void SetUniformInt(UniformLocation location, std::int32_t value) override;
+
+        void ResetVertexBufferData(VertexBuffer &vertexBuffer, const void *data, std::uint32_t size, BufferUsageHint usage) override;
+        void ResetIndexBufferData(IndexBuffer &indexBuffer, std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage) override;
+
+        using RenderCommand::DrawIndexed;
+        void DrawIndexed(PrimitiveType primitiveType, std::uint32_t indexCount, int numberOfInstances, DrawIndexedOffsets const &offsets) override;
+
+    protected:
+        void applyRenderState(RenderState renderState) override;
+        void useShaderProgram(ShaderProgram const &shaderProgram) override;
+        void bindTexture(Texture &texture, std::uint32_t textureUnitSlot) override;
+        void bindVertexArray(VertexArray const &vertexArray) override;
+    };
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Graphics/ShaderProcessorBase.h"
+
+namespace DYE::ShaderProcessor
+{
+    /// Process the keywords declared with '#pragma keywords KEYWORD_A KEYWORD_B ...'.
+    /// Each combination of keywords is a variant of the shader, the enabled keywords of a variant are '#define'd in every shader stage.
+    /// Variants are compiled on first use, see ShaderProgram::GetVariant.
+    class ShaderKeywordProcessor : public ShaderProcessorBase
+    {
+        constexpr static const char *PragmaDirective = "#pragma";
+        constexpr static const char *KeywordsPragmaName = "keywords";
+
+    public:
+        explicit ShaderKeywordProcessor(ShaderKeywordMask enabledKeywordMask) :
+            ShaderProcessorBase("Shader Keyword Processor"), m_EnabledKeywordMask(enabledKeywordMask) {}
+
+        void OnBegin(DYE::ShaderProgram &shaderProgram) override;
+        void OnPreShaderTypeParse(std::string &programSource) override;
+        void OnPreShaderCompilation(ShaderType shaderType, std::string &shaderSource) override;
+        void OnEnd(DYE::ShaderProgram &shaderProgram) override;
+
+    private:
+        ShaderKeywordMask m_EnabledKeywordMask = 0;
+        std::vector<std::string> m_KeywordsCache;
+    };
+}
@@ -24,6 +24,10 @@ namespace DYE::ShaderProcessor
     private:
         std::vector<UniformInfo> getAllActiveUniformInfoFromShaderProgram(ShaderProgram &shaderProgram);
 
+        /// Used when there is no graphics context to query the active uniforms from (i.e. headless mode).
+        /// Uniforms are reflected from the declarations in the source with sequential locations instead.
+        std::vector<UniformInfo> getAllDeclaredUniformInfoFromSource() const;
+
     private:
         std::string m_ShaderProgramSourceCache;
     };
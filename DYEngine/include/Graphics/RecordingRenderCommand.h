@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Graphics/RenderCommand.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace DYE
+{
+    enum class RecordedRenderCommandType : std::uint8_t
+    {
+        SwapWindowBuffer,
+        SetViewport,
+        SetClearColor,
+        SetLinePrimitiveWidth,
+        Clear,
+        ClearDepthStencilOnly,
+        ApplyRenderState,
+        UseShaderProgram,
+        SetUniform,
+        BindTexture,
+        BindVertexArray,
+        ResetBufferData,
+        DrawIndexed
+    };
+
+    /// A command captured by RecordingRenderCommand.
+    /// The payload is intentionally small: an object id/location and a count, the actual values are not kept.
+    struct RecordedRenderCommand
+    {
+        RecordedRenderCommandType Type;
+
+        /// The id of the shader program, texture or vertex array, or the location of the uniform.
+        std::uint32_t ObjectID = 0;
+
+        /// The number of indices of a draw call, or the size of the data in bytes of a buffer update.
+        std::uint32_t Count = 0;
+
+        /// The number of instances of a draw call.
+        std::int32_t NumberOfInstances = 0;
+    };
+
+    struct RenderCommandStatistics
+    {
+        std::uint64_t NumberOfDrawCalls = 0;
+        std::uint64_t NumberOfDrawnIndices = 0;
+        std::uint64_t NumberOfRenderStateChanges = 0;
+        std::uint64_t NumberOfShaderProgramBinds = 0;
+        std::uint64_t NumberOfUniformUploads = 0;
+        std::uint64_t NumberOfTextureBinds = 0;
+        std::uint64_t NumberOfVertexArrayBinds = 0;
+        std::uint64_t NumberOfBufferUpdates = 0;
+        std::uint64_t NumberOfUpdatedBufferBytes = 0;
+        std::uint64_t NumberOfClears = 0;
+    };
+
+    /// A render backend that doesn't talk to the GPU, but captures the commands into a list and counts them.
+    /// It's used to measure & validate the CPU-side cost of the renderer on machines without a GPU.
+    /// Note that buffer updates are only recorded, the contents of the buffers are left untouched.
+    class RecordingRenderCommand final : public RenderCommand
+    {
+    public:
+        /// \param keepCommandList if false, only the statistics are updated and no command is stored in the list.
+        explicit RecordingRenderCommand(bool keepCommandList = true);
+
+        std::vector<RecordedRenderCommand> const &GetRecordedCommands() const { return m_RecordedCommands; }
+        RenderCommandStatistics const &GetStatistics() const { return m_Statistics; }
+
+        /// Clear the recorded commands & reset the statistics.
+        void Reset();
+
+        glm::vec<2, std::uint32_t> GetMaxFramebufferSize() const override;
+
+        void SwapWindowBuffer(WindowBase const &windowBase) override;
+
+        using RenderCommand::SetViewport;
+        void SetViewport(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height) override;
+        void SetClearColor(const glm::vec4 &color) override;
+        void SetLinePrimitiveWidth(float width) override;
+
+        void Clear() override;
+        void ClearDepthStencilOnly() override;
+
+        void SetUniformFloat(UniformLocation location, float value) override;
+        void SetUniformFloat2(UniformLocation location, glm::vec2 const &value) override;
+        void SetUniformFloat3(UniformLocation location, glm::vec3 const &value) override;
+        void SetUniformFloat4(UniformLocation location, glm::vec4 const &value) override;
+        void SetUniformMat3(UniformLocation location, glm::mat3 const &value) override;
+        void SetUniformMat4(UniformLocation location, glm::mat4 const &value) override;
+        void SetUniformInt(UniformLocation location, std::int32_t value) override;
+
+        void ResetVertexBufferData(VertexBuffer &vertexBuffer, const void *data, std::uint32_t size, BufferUsageHint usage) override;
+        void ResetIndexBufferData(IndexBuffer &indexBuffer, std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage) override;
+
+        using RenderCommand::DrawIndexed;
+        void DrawIndexed(PrimitiveType primitiveType, std::uint32_t indexCount, int numberOfInstances, DrawIndexedOffsets const &offsets) override;
+
+    protected:
+        void applyRenderState(RenderState renderState) override;
+        void useShaderProgram(ShaderProgram const &shaderProgram) override;
+        void bindTexture(Texture &texture, std::uint32_t textureUnitSlot) override;
+        void bindVertexArray(VertexArray const &vertexArray) override;
+
+    private:
+        void record(RecordedRenderCommand command);
+        void recordUniformUpload(UniformLocation location);
+
+    private:
+        bool m_KeepCommandList = true;
+        std::vector<RecordedRenderCommand> m_RecordedCommands;
+        RenderCommandStatistics m_Statistics;
+    };
+}
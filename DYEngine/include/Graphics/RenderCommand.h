@@ -2,11 +2,17 @@
 
 #include "Graphics/Camera.h"
 #include "Graphics/MaterialPropertyBlock.h"
+#include "Graphics/RenderState.h"
+#include "Graphics/UniformType.h"
+#include "Graphics/Buffer.h"
 #include "Math/Rect.h"
+#include "Util/TypeUtil.h"
 
 #include <glm/glm.hpp>
 
 #include <memory>
+#include <array>
+#include <optional>
 
 namespace DYE
 {
@@ -16,6 +22,8 @@ namespace DYE
 
     class ShaderProgram;
 
+    class Texture;
+
     class WindowBase;
 
     struct RenderParameters
@@ -25,6 +33,43 @@ namespace DYE
         MaterialPropertyBlock PropertyBlock;
     };
 
+    enum class PrimitiveType
+    {
+        Triangles,
+        Lines
+    };
+
+    /// The offsets of a draw call into the buffers bound to the vertex array,
+    /// used to draw a range of data that has been streamed into a shared buffer (see StreamingBuffer).
+    struct DrawIndexedOffsets
+    {
+        /// The index of the first index in the index buffer.
+        std::uint32_t FirstIndex = 0;
+        /// The value added to each index before fetching the per-vertex attributes.
+        std::int32_t BaseVertex = 0;
+        /// The value added to the instance id before fetching the per-instance attributes.
+        std::uint32_t BaseInstance = 0;
+    };
+
+    /// The number of state changes issued to the backend vs. the ones skipped by the state cache.
+    struct RenderStateCacheStatistics
+    {
+        std::uint32_t NumberOfIssuedRenderStateChanges = 0;
+        std::uint32_t NumberOfElidedRenderStateChanges = 0;
+        std::uint32_t NumberOfIssuedShaderProgramBinds = 0;
+        std::uint32_t NumberOfElidedShaderProgramBinds = 0;
+        std::uint32_t NumberOfIssuedTextureBinds = 0;
+        std::uint32_t NumberOfElidedTextureBinds = 0;
+        std::uint32_t NumberOfIssuedVertexArrayBinds = 0;
+        std::uint32_t NumberOfElidedVertexArrayBinds = 0;
+    };
+
+    /// The render backend interface, every render API call goes through the active RenderCommand instance.
+    /// Derived classes implement the backend primitives (state changes, uniform uploads, buffer updates & draw calls),
+    /// higher level commands such as DrawIndexedNow are composed from these primitives in the base class.
+    ///
+    /// Binding states (render state, shader program, textures & vertex array) go through a state cache.
+    /// Between BeginStateCaching & EndStateCaching, a state change is skipped if the same state is already bound.
     class RenderCommand
     {
     private:
@@ -33,26 +78,82 @@ namespace DYE
     public:
         static RenderCommand &GetInstance();
 
-        /// Initialize internal render command instance based on the platform.
+        /// Initialize internal render command instance based on the platform (i.e. OpenGL).
         static void InitSingleton();
 
-        RenderCommand() = default; // TODO: delete default constructor, because eventually the base class will become abstract/interface.
+        /// Initialize the render command instance with the given backend (i.e. RecordingRenderCommand).
+        static void InitSingleton(std::unique_ptr<RenderCommand> renderCommand);
+
+        /// Replace the current render command instance with the given backend.
+        /// \return the previous render command instance, so it can be restored later.
+        static std::unique_ptr<RenderCommand> ReplaceInstance(std::unique_ptr<RenderCommand> renderCommand);
+
+        /// \return the render command instance if it is of type T, otherwise nullptr.
+        template<class T>
+        requires TypeUtil::DerivedFrom<T, RenderCommand>
+        static T *TryGetTypedInstancePtr()
+        {
+            return dynamic_cast<T *>(s_Instance.get());
+        }
+
+        RenderCommand() = default;
         RenderCommand(const RenderCommand &) = delete;
+        virtual ~RenderCommand() = default;
 
-        glm::vec<2, std::uint32_t> GetMaxFramebufferSize() const;
+        virtual glm::vec<2, std::uint32_t> GetMaxFramebufferSize() const = 0;
 
         /// Before calling this function, you have to call window.MakeCurrent() first.
-        void SwapWindowBuffer(WindowBase const &windowBase);
+        virtual void SwapWindowBuffer(WindowBase const &windowBase) = 0;
 
-        void SetViewport(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height);
+        virtual void SetViewport(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height) = 0;
         void SetViewport(Math::Rect viewportRect);
-        void SetClearColor(const glm::vec4 &color);
-        void SetLinePrimitiveWidth(float width);
+        virtual void SetClearColor(const glm::vec4 &color) = 0;
+        virtual void SetLinePrimitiveWidth(float width) = 0;
 
         /// Clear currently bound draw buffer (color, depth, stencil)
-        void Clear();
-
-        void ClearDepthStencilOnly();
+        virtual void Clear() = 0;
+
+        virtual void ClearDepthStencilOnly() = 0;
+
+        /// Start tracking the bound states to skip redundant state changes.
+        /// The cache starts empty, so the first state change of each kind is always issued.
+        /// Nothing else should modify the bound states of the backend until EndStateCaching is called (i.e. ImGui rendering).
+        void BeginStateCaching();
+        void EndStateCaching();
+        bool IsStateCaching() const { return m_IsStateCaching; }
+
+        RenderStateCacheStatistics const &GetStateCacheStatistics() const { return m_StateCacheStatistics; }
+        void ResetStateCacheStatistics() { m_StateCacheStatistics = {}; }
+
+        void ApplyRenderState(RenderState const &renderState);
+        /// \return true if the shader program was bound to the backend, false if it has already been bound.
+        bool UseShaderProgram(ShaderProgram const &shaderProgram);
+
+        /// Upload a value to the uniform at the given location of the shader program currently in use.
+        virtual void SetUniformFloat(UniformLocation location, float value) = 0;
+        virtual void SetUniformFloat2(UniformLocation location, glm::vec2 const &value) = 0;
+        virtual void SetUniformFloat3(UniformLocation location, glm::vec3 const &value) = 0;
+        virtual void SetUniformFloat4(UniformLocation location, glm::vec4 const &value) = 0;
+        virtual void SetUniformMat3(UniformLocation location, glm::mat3 const &value) = 0;
+        virtual void SetUniformMat4(UniformLocation location, glm::mat4 const &value) = 0;
+        virtual void SetUniformInt(UniformLocation location, std::int32_t value) = 0;
+
+        void BindTexture(Texture &texture, std::uint32_t textureUnitSlot);
+        void BindVertexArray(VertexArray const &vertexArray);
+
+        /// Replace the whole data store of the buffer.
+        virtual void ResetVertexBufferData(VertexBuffer &vertexBuffer, const void *data, std::uint32_t size, BufferUsageHint usage) = 0;
+        virtual void ResetIndexBufferData(IndexBuffer &indexBuffer, std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage) = 0;
+
+        /// Draw the vertex array currently bound.
+        /// \param primitiveType
+        /// \param indexCount the number of indices to be drawn
+        /// \param numberOfInstances the number of instances to be drawn, 1 means a non-instanced draw call
+        void DrawIndexed(PrimitiveType primitiveType, std::uint32_t indexCount, int numberOfInstances) { DrawIndexed(primitiveType, indexCount, numberOfInstances, {}); }
+
+        /// Draw a range of the vertex array currently bound.
+        /// \param offsets the offsets into the index, per-vertex & per-instance data.
+        virtual void DrawIndexed(PrimitiveType primitiveType, std::uint32_t indexCount, int numberOfInstances, DrawIndexedOffsets const &offsets) = 0;
 
         /// Draw VAO as line primitives.
         /// \param vertexArray
@@ -77,5 +178,31 @@ namespace DYE
         /// \param vertexArray
         /// \param objectToWorldMatrix
         void DrawIndexedNow(RenderParameters const &renderParameters, VertexArray const &vertexArray, glm::mat4 objectToWorldMatrix);
+
+        /// Upload the view & projection matrices of the camera to the shader program currently in use.
+        void SetCameraUniforms(ShaderProgram const &shaderProgram, Camera const &camera);
+
+    protected:
+        virtual void applyRenderState(RenderState renderState) = 0;
+        virtual void useShaderProgram(ShaderProgram const &shaderProgram) = 0;
+        virtual void bindTexture(Texture &texture, std::uint32_t textureUnitSlot) = 0;
+        virtual void bindVertexArray(VertexArray const &vertexArray) = 0;
+
+    private:
+        void invalidateStateCache();
+
+    public:
+        constexpr static std::uint32_t MaxNumberOfCachedTextureUnits = 32;
+
+    private:
+        bool m_IsStateCaching = false;
+        RenderStateCacheStatistics m_StateCacheStatistics;
+
+        // The states are identified by address instead of ID,
+        // because resources created without a graphics context share the same ID (0).
+        std::optional<RenderState> m_CachedRenderState;
+        ShaderProgram const *m_pCachedShaderProgram = nullptr;
+        VertexArray const *m_pCachedVertexArray = nullptr;
+        std::array<Texture const *, MaxNumberOfCachedTextureUnits> m_CachedTextures = {nullptr};
     };
-}
\ No newline at end of file
+}
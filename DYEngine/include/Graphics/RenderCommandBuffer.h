@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Graphics/Camera.h"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace DYE
+{
+    class RenderCommand;
+
+    class VertexArray;
+
+    class Material;
+
+    class MaterialPropertyBlock;
+
+    /// A list of draw commands recorded by a render pipeline & executed later in one go.
+    /// The commands are compact PODs that only point to the resources, therefore the resources have to outlive the execution.
+    class RenderCommandBuffer
+    {
+    public:
+        struct DrawIndexedCommand
+        {
+            VertexArray const *pVertexArray;
+            Material const *pMaterial;
+            MaterialPropertyBlock const *pPropertyBlock;
+            glm::mat4 ObjectToWorldMatrix;
+
+            /// The key used to sort the commands, i.e. the depth in view space.
+            float SortKey;
+        };
+
+        void Reserve(std::size_t numberOfCommands) { m_DrawIndexedCommands.reserve(numberOfCommands); }
+        void Clear() { m_DrawIndexedCommands.clear(); }
+
+        void RecordDrawIndexed(DrawIndexedCommand command) { m_DrawIndexedCommands.push_back(command); }
+
+        std::vector<DrawIndexedCommand> &GetDrawIndexedCommands() { return m_DrawIndexedCommands; }
+        std::vector<DrawIndexedCommand> const &GetDrawIndexedCommands() const { return m_DrawIndexedCommands; }
+
+        /// Stable sort the commands by the sort key (from low to high).
+        void SortByKey();
+
+        /// Execute the recorded commands in order with the given camera.
+        /// Redundant state changes between consecutive commands are skipped through the state cache of the render command.
+        void Execute(RenderCommand &renderCommand, Camera const &camera) const;
+
+    private:
+        std::vector<DrawIndexedCommand> m_DrawIndexedCommands;
+    };
+}
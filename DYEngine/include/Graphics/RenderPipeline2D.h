@@ -2,13 +2,29 @@
 
 #include "Graphics/RenderPipelineBase.h"
 #include "Graphics/MaterialPropertyBlock.h"
+#include "Graphics/RenderCommand.h"
+#include "Graphics/RenderCommandBuffer.h"
+#include "Math/AABB.h"
 
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace DYE
 {
     class Texture2D;
 
+    /// The number of submissions that pass/fail the frustum culling, summed over all the cameras rendered in a frame.
+    struct CullingStatistics
+    {
+        std::uint32_t NumberOfVisibleSubmissions = 0;
+        std::uint32_t NumberOfCulledSubmissions = 0;
+
+        /// The number of cameras that reuse the culling result of a previous camera with the same view & projection.
+        std::uint32_t NumberOfReusedCullingResults = 0;
+    };
+
     class RenderPipeline2D : public RenderPipelineBase
     {
     public:
@@ -29,18 +45,89 @@ namespace DYE
         std::shared_ptr<VertexArray> GetDefaultQuadSpriteVAO() const { return m_DefaultSpriteVAO; }
         std::shared_ptr<Material> GetDefaultSpriteMaterial() const { return m_DefaultSpriteMaterial; }
 
+        /// The number of issued vs. skipped state changes when the submissions were rendered in the last frame.
+        RenderStateCacheStatistics const &GetStateCacheStatisticsLastFrame() const { return m_StateCacheStatisticsLastFrame; }
+
+        /// The number of visible vs. culled submissions in the last frame.
+        CullingStatistics const &GetCullingStatisticsLastFrame() const { return m_CullingStatisticsLastFrame; }
+
         [[deprecated("Use Submit & GetDefaultQuadSpriteVAO to submit a quad sprite instead.")]]
         void SubmitSprite(const std::shared_ptr<Texture2D> &texture, glm::vec4 color, glm::mat4 objectToWorldMatrix);
         [[deprecated("Use Submit & GetDefaultQuadSpriteVAO to submit a quad sprite instead.")]]
         void SubmitTiledSprite(const std::shared_ptr<Texture2D> &texture, glm::vec4 tilingOffset, glm::vec4 color, glm::mat4 objectToWorldMatrix);
 
     protected:
+        void onCaptureFramePacket() override;
         void onPreRender() override;
+        void prepareCameras(const std::vector<Camera> &cameras) override;
         void renderCamera(const Camera &camera) override;
+        void renderPreparedCamera(const Camera &camera, std::size_t cameraIndex) override;
         void onPostRender() override;
 
     private:
+        /// The world-space bounds of the submissions in structure of arrays (indexed the same as m_Submissions),
+        /// so that the visibility test of all the submissions can be vectorized.
+        struct SubmissionBounds
+        {
+            std::vector<float> MinX;
+            std::vector<float> MinY;
+            std::vector<float> MinZ;
+            std::vector<float> MaxX;
+            std::vector<float> MaxY;
+            std::vector<float> MaxZ;
+
+            void Clear();
+            void Reserve(std::size_t size);
+            void Add(Math::AABB const &bounds);
+            std::size_t Size() const { return MinX.size(); }
+        };
+
+        /// The visible & sorted draw commands of a view, prepared on a worker thread & executed on the render thread.
+        /// Cameras sharing the same view & projection in a frame share the prepared view.
+        struct PreparedView
+        {
+            glm::mat4 ViewMatrix;
+            glm::mat4 ProjectionMatrix;
+            std::vector<std::uint8_t> VisibilityMask;
+            std::vector<std::uint32_t> VisibleSubmissionIndices;
+            RenderCommandBuffer CommandBuffer;
+        };
+
+        /// Calculate the world-space bounds of the frame packet submissions if they haven't been calculated in this frame.
+        /// Submissions with unknown geometry bounds get infinite bounds & are never culled.
+        void computeSubmissionBounds();
+
+        /// Find the view prepared for the camera's view & projection in this frame, or add a new (unprepared) one.
+        /// \return the index of the view in m_PreparedViews & whether the view is newly added.
+        std::pair<std::size_t, bool> findOrAddPreparedView(Camera const &camera);
+
+        /// Cull the submissions against the view frustum, then record & sort the visible submissions into the view's command buffer.
+        /// It only writes into the given view, so different views can be prepared on different threads.
+        void prepareView(PreparedView &view) const;
+
+        void accumulateCullingStatistics(PreparedView const &view, bool isReused);
+
+        /// The submissions of the frame being simulated.
         std::vector<RenderSubmission2D> m_Submissions;
+        /// The submissions of the frame being rendered, all the render phases only read from this buffer.
+        /// Their materials are snapshots taken when the packet is captured, so the frame being simulated can change the materials.
+        std::vector<RenderSubmission2D> m_FramePacketSubmissions;
+        /// The snapshot of each material in the packet being captured, kept to retain the capacity.
+        std::unordered_map<Material const *, std::shared_ptr<Material>> m_MaterialSnapshots;
+        RenderStateCacheStatistics m_StateCacheStatisticsLastFrame;
+
+        SubmissionBounds m_SubmissionBounds;
+
+        /// The views are kept across frames to retain the capacity of their buffers,
+        /// only the first m_NumberOfPreparedViewsThisFrame of them are valid in the current frame.
+        std::vector<PreparedView> m_PreparedViews;
+        std::size_t m_NumberOfPreparedViewsThisFrame = 0;
+
+        /// The prepared view index of each camera passed to prepareCameras in this frame, indexed by the camera index.
+        std::vector<std::size_t> m_CameraPreparedViewIndices;
+
+        CullingStatistics m_CullingStatisticsThisFrame;
+        CullingStatistics m_CullingStatisticsLastFrame;
 
         std::shared_ptr<VertexArray> m_DefaultSpriteVAO;
         std::shared_ptr<Material> m_DefaultSpriteMaterial;
@@ -28,8 +28,22 @@ namespace DYE
                             glm::mat4 objectToWorldMatrix, MaterialPropertyBlock materialPropertyBlock) = 0;
 
     protected:
+        /// Called at the end of the simulation of a frame. The submissions recorded so far become the frame packet that is rendered,
+        /// while the new submissions are recorded into a separate buffer (i.e. the next frame, when rendering on a render thread).
+        virtual void onCaptureFramePacket() = 0;
+
         virtual void onPreRender() = 0;
+
+        /// Called after onPreRender with all the cameras that are going to be rendered in this frame, in rendering order.
+        /// The per-camera work that doesn't touch the render API (i.e. culling, sorting & recording commands)
+        /// can be done here on worker threads, renderCamera is then called for each camera on the render thread.
+        virtual void prepareCameras(const std::vector<Camera> &cameras) {}
+
         virtual void renderCamera(const Camera &camera) = 0;
+
+        /// Called instead of renderCamera for the cameras passed to prepareCameras.
+        /// \param cameraIndex the index of the camera in the list passed to prepareCameras in this frame.
+        virtual void renderPreparedCamera(const Camera &camera, std::size_t cameraIndex) { renderCamera(camera); }
         virtual void onPostRender() = 0;
     };
 }
\ No newline at end of file
@@ -17,12 +17,31 @@ namespace DYE
     private:
         static std::shared_ptr<RenderPipelineBase> s_ActiveRenderPipeline;
         static std::vector<Camera> s_Cameras;
+        static bool s_IsHeadless;
+
+        /// The cameras of the frame packet, s_Cameras is moved into it when the packet is captured.
+        static std::vector<Camera> s_FramePacketCameras;
 
     public:
         static void Initialize();
 
+        /// Initialize without touching any graphics API, used when the application runs without a window & graphics context.
+        /// In headless mode, cameras are passed to the active pipeline but no render target is bound and no debug draw is rendered.
+        static void InitializeHeadless();
+        static bool IsHeadless() { return s_IsHeadless; }
+
+        /// Capture the frame packet & render it right away, equivalent to CaptureFramePacket followed by RenderFramePacket.
         static void RenderWithActivePipeline();
 
+        /// Move the cameras, the pipeline submissions & the debug draws of the frame into the frame packet.
+        /// Everything registered/submitted after this call goes to the next packet.
+        /// It must not be called while the previous packet is being rendered.
+        static void CaptureFramePacket();
+
+        /// Render the captured frame packet with the active pipeline, the graphics context has to be current on the calling thread.
+        /// It can be called on a render thread while the next frame is being simulated.
+        static void RenderFramePacket();
+
         template<class T>
         requires TypeUtil::DerivedFrom<T, RenderPipelineBase>
         static T *GetTypedActiveRenderPipelinePtr()
@@ -30,6 +49,14 @@ namespace DYE
             return static_cast<T *>(s_ActiveRenderPipeline.get());
         }
 
+        /// \return the active render pipeline if it is of type T, otherwise nullptr.
+        template<class T>
+        requires TypeUtil::DerivedFrom<T, RenderPipelineBase>
+        static T *TryGetTypedActiveRenderPipelinePtr()
+        {
+            return dynamic_cast<T *>(s_ActiveRenderPipeline.get());
+        }
+
         static RenderPipelineBase &GetActiveRenderPipeline();
         static void SetActiveRenderPipeline(std::shared_ptr<RenderPipelineBase> renderPipeline);
 
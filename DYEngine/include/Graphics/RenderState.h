@@ -25,6 +25,8 @@ namespace DYE
         bool IsEnabled = true;
         bool IsWriteEnabled = true;
         CompareFunction CompareFunction = CompareFunction::Less;
+
+        bool operator==(DepthState const &other) const = default;
     };
 
     struct BlendState
@@ -47,6 +49,8 @@ namespace DYE
         BlendFactor SourceFactor = BlendFactor::SrcAlpha;
         BlendFactor DestinationFactor = BlendFactor::OneMinusSrcAlpha;
 
+        bool operator==(BlendState const &other) const = default;
+
         // TODO: Add more option such as BlendOp etc
     };
 
@@ -57,6 +61,8 @@ namespace DYE
         BlendState BlendState;
         // TODO: Add more command such as Stencil Test, Cull etc
 
+        bool operator==(RenderState const &other) const = default;
+
         void Apply();
 
     private:
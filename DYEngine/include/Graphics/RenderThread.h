@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace DYE
+{
+    class WindowBase;
+
+    struct RenderThreadStatistics
+    {
+        /// The time the render thread spent on rendering the last frame packet.
+        double RenderMilliseconds = 0;
+
+        /// The time the simulation thread was blocked at the sync point, waiting for the last frame packet to be rendered.
+        double WaitMilliseconds = 0;
+    };
+
+    /// Render the frame packets (see RenderPipelineManager::CaptureFramePacket) on a dedicated thread,
+    /// so that the driver work of a frame overlaps with the simulation of the next frame, with one frame of latency.
+    ///
+    /// The graphics context of the main window is handed over between the threads:
+    /// it's current on the render thread from KickFrame to WaitForFrame, and current on the calling thread otherwise.
+    /// Therefore, the render API must not be used by the calling thread in between (i.e. creating textures in OnUpdate).
+    /// The render pipeline snapshots the materials of the packet when it's captured, so the material properties can still be changed;
+    /// the textures, shader programs & vertex arrays are shared with the packet, but they can only be modified through the render API.
+    class RenderThread
+    {
+    public:
+        RenderThread() = default;
+        RenderThread(RenderThread const &other) = delete;
+        ~RenderThread();
+
+        /// \param mainWindow the window whose context is used to render the frame packets.
+        void Start(WindowBase &mainWindow);
+
+        /// Wait for the frame in flight to be rendered, then join the thread. The context stays current on the calling thread.
+        void Stop();
+
+        bool IsRunning() const { return m_Thread.joinable(); }
+
+        /// Capture the frame packet & start rendering it on the render thread.
+        /// The context is released from the calling thread, it's given back in WaitForFrame.
+        void KickFrame();
+
+        /// The sync point: block until the kicked frame has been rendered, then make the context current on the calling thread.
+        /// It returns immediately if no frame has been kicked since the last call.
+        void WaitForFrame();
+
+        RenderThreadStatistics const &GetStatisticsLastFrame() const { return m_StatisticsLastFrame; }
+
+    private:
+        void run();
+
+        WindowBase *m_pMainWindow = nullptr;
+        std::thread m_Thread;
+
+        std::mutex m_Mutex;
+        std::condition_variable m_ConditionVariable;
+        bool m_HasFrameToRender = false;
+        bool m_IsStopRequested = false;
+
+        /// Whether the context has been handed over to the render thread & not yet taken back.
+        bool m_IsFrameInFlight = false;
+
+        double m_RenderMillisecondsInFlight = 0;
+        RenderThreadStatistics m_StatisticsLastFrame;
+    };
+}
@@ -14,6 +14,7 @@ namespace DYE
 
         void *GetNativeContextPtr() const override;
         void MakeCurrentForWindow(WindowBase const &window) override;
+        void ReleaseCurrentForWindow(WindowBase const &window) override;
 
     protected:
         void init(WindowBase *pWindow) override;
@@ -8,12 +8,16 @@
 #include <vector>
 #include <filesystem>
 #include <optional>
+#include <unordered_map>
 
 namespace DYE
 {
     using ShaderProgramID = std::uint32_t;
     using ShaderID = std::uint32_t;
 
+    /// The n-th bit is set if the n-th keyword of the shader program is enabled.
+    using ShaderKeywordMask = std::uint32_t;
+
     namespace ShaderProcessor
     {
         class ShaderProcessorBase;
@@ -23,12 +27,15 @@ namespace DYE
         class BlendStateCommandProcessor;
 
         class DepthStateCommandProcessor;
+
+        class ShaderKeywordProcessor;
     }
 
     namespace ShaderConstants
     {
         constexpr int NumberOfShaderTypes = 3; // Vertex, Fragment, Geometry
         constexpr const char *ShaderTypeSpecifier = "#Shader";
+        constexpr int MaxNumberOfKeywords = sizeof(ShaderKeywordMask) * 8;
     }
 
     enum class ShaderType
@@ -38,6 +45,15 @@ namespace DYE
         Fragment,
     };
 
+    enum class ShaderCompileMode
+    {
+        /// Wait for the driver to finish compiling & linking the program before returning.
+        Blocking = 0,
+        /// Return right after the compilation is issued, the program is finished in ShaderProgram::PollPendingCompilations
+        /// once the driver reports completion (KHR_parallel_shader_compile).
+        Async,
+    };
+
     /// A Shader Program wraps the GL ShaderProgramID and functions.
     /// Current implementation is in OpenGL
     class ShaderProgram
@@ -45,6 +61,7 @@ namespace DYE
         friend ShaderProcessor::UniformPropertyProcessor;
         friend ShaderProcessor::BlendStateCommandProcessor;
         friend ShaderProcessor::DepthStateCommandProcessor;
+        friend ShaderProcessor::ShaderKeywordProcessor;
 
     public:
         struct ShaderTypeParseResult
@@ -65,13 +82,33 @@ namespace DYE
 
         /// A factory function that creates a shader program with the given shader source file
         /// \param filepath
+        /// \param compileMode when async, the program cannot be used before IsReady() returns true.
         /// \return a shared pointer to the newly created ShaderProgram, return shared_ptr(nullptr) if failed
-        static std::shared_ptr<ShaderProgram> CreateFromFile(const std::string &name, const std::filesystem::path &filepath);
+        static std::shared_ptr<ShaderProgram> CreateFromFile(const std::string &name, const std::filesystem::path &filepath,
+                                                             ShaderCompileMode compileMode = ShaderCompileMode::Blocking);
+
+        /// Finish the async compilations that have been completed by the driver, should be called once per frame.
+        static void PollPendingCompilations();
+        static std::size_t GetNumberOfPendingCompilations() { return s_ProgramsPendingCompilation.size(); }
+
+        /// The compile mode used by GetVariant when a variant is requested for the first time.
+        static void SetVariantCompileMode(ShaderCompileMode compileMode) { s_VariantCompileMode = compileMode; }
+        static ShaderCompileMode GetVariantCompileMode() { return s_VariantCompileMode; }
+
+        /// A program that is always ready to be used (blocking compiled on the first call),
+        /// used in place of the programs that are still being compiled.
+        static ShaderProgram &GetFallbackShaderProgram();
 
         ShaderProgramID GetID() const { return m_ID; }
         std::string GetName() const { return m_Name; }
         inline bool HasCompileError() const { return m_HasCompileError; }
 
+        /// Whether the compilation of the program has finished, always true for programs compiled in blocking mode.
+        bool IsReady() const { return m_pPendingCompilation == nullptr; }
+
+        /// Whether the program was linked from a binary in ShaderProgramBinaryCache instead of being compiled from source.
+        bool IsLoadedFromBinaryCache() const { return m_IsLoadedFromBinaryCache; }
+
         /// Use the shader program to the rendering pipeline
         void Use() const;
         void Unbind() const;
@@ -82,26 +119,60 @@ namespace DYE
         std::optional<UniformInfo> TryGetUniformInfo(const std::string &name) const;
         std::optional<UniformInfo> TryGetUniformInfoFromLocation(UniformLocation location) const;
         bool HasUniform(const std::string &name) const;
+
+        /// The keywords declared with '#pragma keywords' in the shader source.
+        const std::vector<std::string> &GetKeywords() const { return m_Keywords; }
+        std::optional<std::uint32_t> TryGetKeywordIndex(const std::string &keyword) const;
+
+        /// The keywords enabled in this program, 0 for the base program.
+        ShaderKeywordMask GetKeywordMask() const { return m_KeywordMask; }
+
+        /// Get the variant of this (base) program with the given keywords enabled.
+        /// A variant is compiled from the same source the first time it's requested, & cached for later use.
+        /// \param keywordMask the keywords to be enabled, the bits of undeclared keywords are ignored.
+        /// \return the variant, or this program if the mask is the same as this program's.
+        ShaderProgram &GetVariant(ShaderKeywordMask keywordMask);
+        std::size_t GetNumberOfCompiledVariants() const { return m_Variants.size(); }
     private:
+        /// The shaders & processors of an async compilation, kept alive until the compilation is finished.
+        struct PendingCompilation;
+
+        static std::vector<ShaderProgram *> s_ProgramsPendingCompilation;
+        static ShaderCompileMode s_VariantCompileMode;
+
         /// A raw pointer to the shader program that is currently used/bound to the GPU
         //static ShaderProgram* s_pCurrentShaderProgramInUse;
 
         /// Compile and create shader program in the GPU driver
         /// \param source the source code of the shader
+        /// \param compileMode when async, the compilation is only issued & finished later in PollPendingCompilations.
+        /// \return true if no compile error (or no parse error in async mode), else false
+        bool initializeProgramFromSource(std::string source,
+                                         std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> shaderProcessors,
+                                         ShaderCompileMode compileMode);
+
+        /// Query the compile & link results of the pending compilation, then run the post-compilation processors.
         /// \return true if no compile error, else false
-        bool initializeProgramFromSource(std::string source, const std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> &shaderProcessors);
+        bool finishCompilation();
+
+        /// \return the processors every shader program source goes through.
+        static std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> createShaderProcessors(ShaderKeywordMask enabledKeywordMask);
 
         /// Parse the given shader program source code into multiple shader sources.
         /// \param programSource
         /// \return If .Success is true, the result is a vector of pair (ShaderType -> ShaderSource), with all the shader sources stored in it.
         static ShaderTypeParseResult parseShaderProgramSourceIntoShaderSources(const std::string &programSource, const std::vector<std::string> &directivesToIgnore);
 
-        /// Compile a shader of the given type with the given source code and attach it to the given shader program.
-        /// \param programId The id of the shader program to attach the compiled shader to.
+        /// Create a shader of the given type with the given source code and issue the compilation.
+        /// The compile status is not queried so that the driver can compile the shader in the background.
         /// \param type Shader type.
         /// \param source Shader source code.
+        /// \return the id of the created shader.
+        static ShaderID issueShaderCompilation(ShaderType type, const std::string &source);
+
+        /// Query the compile status of the shader, block until the compilation is done.
         /// \return result. When .Success is false, ShaderID is set to 0 (which also means the default shader in the render API).
-        static ShaderCompilationResult compileShaderForProgram(ShaderProgramID programId, ShaderType type, const std::string &source);
+        static ShaderCompilationResult checkShaderCompilation(ShaderType type, ShaderID shaderID);
 
         void setDefaultRenderState(RenderState renderState) { m_DefaultRenderState = renderState; }
 
@@ -112,6 +183,12 @@ namespace DYE
         void addPropertyInfo(const PropertyInfo &propertyInfo) { m_Properties.emplace_back(propertyInfo); }
         void clearPropertyInfo() { m_Properties.clear(); }
 
+        void setKeywords(std::vector<std::string> keywords, ShaderKeywordMask keywordMask)
+        {
+            m_Keywords = std::move(keywords);
+            m_KeywordMask = keywordMask;
+        }
+
     private:
         /// ShaderProgramName (debugging)
         std::string m_Name;
@@ -124,5 +201,14 @@ namespace DYE
         std::vector<PropertyInfo> m_Properties {};
 
         bool m_HasCompileError = false;
+        bool m_IsLoadedFromBinaryCache = false;
+
+        /// The unprocessed program source, variants are compiled from it.
+        std::string m_ProgramSource;
+        std::vector<std::string> m_Keywords {};
+        ShaderKeywordMask m_KeywordMask = 0;
+        std::unordered_map<ShaderKeywordMask, std::unique_ptr<ShaderProgram>> m_Variants {};
+
+        std::unique_ptr<PendingCompilation> m_pPendingCompilation;
     };
 }
\ No newline at end of file
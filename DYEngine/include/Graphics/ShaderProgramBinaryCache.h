@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Graphics/Shader.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace DYE
+{
+    struct ShaderProgramBinaryCacheStatistics
+    {
+        std::uint32_t NumberOfHits = 0;
+        std::uint32_t NumberOfMisses = 0;
+        std::uint32_t NumberOfStores = 0;
+    };
+
+    /// Store linked shader programs on disk (glGetProgramBinary) so that they don't have to be compiled & linked again on the next launch.
+    /// The binaries are keyed by the processed shader sources & the driver (vendor, renderer & version),
+    /// a binary that cannot be loaded (i.e. driver update) is treated as a cache miss & the program is compiled from source.
+    class ShaderProgramBinaryCache
+    {
+    public:
+        static constexpr char const *BinaryExtension = ".dyshaderbin";
+
+        /// Set the folder where the binaries are stored, the cache is disabled if the path is empty.
+        static void SetCacheDirectory(std::filesystem::path cacheDirectory) { s_CacheDirectory = std::move(cacheDirectory); }
+        static std::filesystem::path const &GetCacheDirectory() { return s_CacheDirectory; }
+
+        /// \return true if the cache directory is set and the driver supports at least one program binary format.
+        static bool IsAvailable();
+
+        /// Delete all the binaries in the cache directory.
+        static void Clear();
+
+        /// \param shaderSources the sources that are passed to the shader compiler (after being processed by the shader processors).
+        /// \return the key of the program, also includes the driver identification.
+        static std::uint64_t ComputeKey(std::vector<std::pair<ShaderType, std::string>> const &shaderSources);
+
+        /// Load the binary of the given key into the program.
+        /// \return true if the binary exists & the program is successfully linked with it.
+        static bool TryLoad(ShaderProgramID programID, std::uint64_t key);
+
+        /// Retrieve the binary of the linked program & write it into the cache.
+        /// The program should be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set to true.
+        static bool Store(ShaderProgramID programID, std::uint64_t key);
+
+        static ShaderProgramBinaryCacheStatistics const &GetStatistics() { return s_Statistics; }
+        static void ResetStatistics() { s_Statistics = {}; }
+
+    private:
+        static std::filesystem::path getBinaryPath(std::uint64_t key);
+
+        static std::filesystem::path s_CacheDirectory;
+        static ShaderProgramBinaryCacheStatistics s_Statistics;
+    };
+}
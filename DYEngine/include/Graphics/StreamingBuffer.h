@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Graphics/Buffer.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace DYE
+{
+    /// A chunk of memory allocated from a StreamingBuffer, only valid until the end of the frame.
+    struct StreamingBufferAllocation
+    {
+        /// Write the data directly into this pointer, it is mapped to the buffer object.
+        void *pData = nullptr;
+
+        /// The offset (in byte) from the start of the buffer object.
+        std::uint32_t Offset = 0;
+        std::uint32_t Size = 0;
+
+        bool IsValid() const { return pData != nullptr; }
+    };
+
+    /// A buffer object that is persistently mapped & split into NumberOfFramesInFlight regions,
+    /// each frame writes into its own region while the GPU might still be reading the regions of the previous frames.
+    /// A fence is inserted at the end of each frame, and waited on before the region is written again.
+    ///
+    /// Per-frame vertex/index/instance data should be written into the allocations directly,
+    /// instead of being re-uploaded with glNamedBufferData (which reallocates the buffer storage every call).
+    class StreamingBuffer
+    {
+    public:
+        constexpr static std::uint32_t NumberOfFramesInFlight = 3;
+
+        /// \param capacityPerFrame the size (in byte) that can be allocated in a frame.
+        static std::shared_ptr<StreamingBuffer> Create(std::uint32_t capacityPerFrame);
+
+        StreamingBuffer() = delete;
+
+        /// Avoid using this constructor, use StreamingBuffer::Create instead.
+        explicit StreamingBuffer(std::uint32_t capacityPerFrame);
+        ~StreamingBuffer();
+
+        StreamingBuffer(StreamingBuffer const &other) = delete;
+        StreamingBuffer &operator=(StreamingBuffer const &other) = delete;
+
+        /// Wait until the GPU has finished reading the region of this frame (from NumberOfFramesInFlight frames ago),
+        /// after that allocations can be made.
+        void BeginFrame();
+
+        /// Insert a fence for the region of this frame, and move on to the next region.
+        void EndFrame();
+
+        bool IsInFrame() const { return m_IsInFrame; }
+
+        /// Allocate a chunk of memory from the region of the current frame.
+        /// \param size the size of the allocation (in byte).
+        /// \param alignment the offset of the allocation (from the start of the buffer) will be a multiple of alignment.
+        /// It doesn't have to be a power of two: pass the vertex stride so that (Offset / stride) can be used as the base vertex/instance of a draw call.
+        /// \return the allocation, invalid if the region of this frame is full or the function is called outside of Begin/EndFrame.
+        StreamingBufferAllocation Allocate(std::uint32_t size, std::uint32_t alignment = 4);
+
+        /// Create a vertex buffer that refers to the buffer object of this streaming buffer, so that it can be added to a VertexArray.
+        std::shared_ptr<VertexBuffer> CreateVertexBufferView(VertexLayout const &layout) const;
+
+        /// Create an index buffer that refers to the buffer object of this streaming buffer, so that it can be set to a VertexArray.
+        std::shared_ptr<IndexBuffer> CreateIndexBufferView() const;
+
+        BufferID GetID() const { return m_ID; }
+        std::uint32_t GetCapacityPerFrame() const { return m_CapacityPerFrame; }
+        std::uint32_t GetUsedSizeThisFrame() const { return m_Cursor; }
+
+    private:
+        BufferID m_ID {};
+        std::uint32_t m_CapacityPerFrame = 0;
+
+        /// The persistently mapped pointer to the whole buffer (or the CPU fallback storage when running headless).
+        std::uint8_t *m_pMappedData = nullptr;
+        std::vector<std::uint8_t> m_HeadlessStorage;
+
+        std::array<GLsync, NumberOfFramesInFlight> m_Fences {};
+        std::uint32_t m_FrameIndex = 0;
+        std::uint32_t m_Cursor = 0;
+        bool m_IsInFrame = false;
+    };
+}
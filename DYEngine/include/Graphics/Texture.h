@@ -8,6 +8,8 @@
 
 namespace DYE
 {
+    struct CookedTexture;
+
     using TextureID = std::uint32_t;
     using TextureFormat = std::uint32_t;
 
@@ -60,10 +62,15 @@ namespace DYE
 
         static std::shared_ptr<Texture2D> Create(glm::vec4 color, std::uint32_t width, std::uint32_t height);
 
-        /// Create a Texture2D loaded from the given file path
+        /// Create a Texture2D loaded from the given file path.
+        /// If the file is a cooked texture (.dytex), the mip levels are uploaded directly without decoding.
         /// \return
         static std::shared_ptr<Texture2D> Create(const std::filesystem::path &path);
 
+        /// Create a Texture2D with all the mip levels of the cooked texture.
+        /// \return
+        static std::shared_ptr<Texture2D> Create(CookedTexture const &cookedTexture);
+
         /// \return a 1x1 white Texture2D
         static std::shared_ptr<Texture2D> GetWhiteTexture();
 
@@ -75,6 +82,7 @@ namespace DYE
 
         explicit Texture2D(std::uint32_t width, std::uint32_t height);
         explicit Texture2D(const std::filesystem::path &path);
+        explicit Texture2D(CookedTexture const &cookedTexture);
         ~Texture2D() override;
 
         std::uint32_t GetWidth() const override { return m_Width; }
@@ -94,6 +102,9 @@ namespace DYE
     public:
         std::uint32_t PixelsPerUnit {100};
 
+    private:
+        void initializeFromCookedTexture(CookedTexture const &cookedTexture);
+
     private:
         std::filesystem::path m_Path {};
         std::uint32_t m_Width {0}, m_Height {0};
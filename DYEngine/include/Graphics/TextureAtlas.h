@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Graphics/Texture.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace DYE
+{
+    /// A named rectangle of sprite pixels on an atlas page.
+    /// The origin is at the bottom-left corner of the page, same as the texture coordinates.
+    struct TextureAtlasRegion
+    {
+        std::string Name;
+        std::uint32_t X = 0;
+        std::uint32_t Y = 0;
+        std::uint32_t Width = 0;
+        std::uint32_t Height = 0;
+    };
+
+    /// A texture page that contains multiple sprites, each of which is referenced by a region name.
+    /// Sprites on the same atlas share one texture, therefore consecutive draws don't have to switch texture bindings.
+    class TextureAtlas
+    {
+    public:
+        static std::shared_ptr<TextureAtlas> Create(std::shared_ptr<Texture2D> texture, std::vector<TextureAtlasRegion> regions);
+
+        TextureAtlas() = delete;
+        TextureAtlas(std::shared_ptr<Texture2D> texture, std::vector<TextureAtlasRegion> regions);
+
+        std::shared_ptr<Texture2D> GetTexture() const { return m_Texture; }
+        std::vector<TextureAtlasRegion> const &GetRegions() const { return m_Regions; }
+
+        /// \return a pointer to the region with the given name, nullptr if there is no such region.
+        TextureAtlasRegion const *TryGetRegion(std::string const &name) const;
+
+        /// Convert the pixel rect of the given region into a tiling-offset vector (xy: scale, zw: offset) in texture coordinates,
+        /// which can be fed to the shader through '_MainTex_TilingOffset'.
+        glm::vec4 GetRegionTilingOffset(TextureAtlasRegion const &region) const;
+
+    private:
+        std::shared_ptr<Texture2D> m_Texture;
+        std::vector<TextureAtlasRegion> m_Regions;
+    };
+}
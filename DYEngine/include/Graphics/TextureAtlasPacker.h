@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Graphics/TextureAtlas.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace DYE
+{
+    struct TextureAtlasPackerSettings
+    {
+        std::uint32_t PageWidth = 2048;
+        std::uint32_t PageHeight = 2048;
+
+        /// The number of empty pixels between regions & around the page border, to prevent sampling bleeding from neighbouring sprites.
+        std::uint32_t Padding = 2;
+    };
+
+    struct TextureAtlasPage
+    {
+        std::uint32_t Width = 0;
+        std::uint32_t Height = 0;
+
+        /// RGBA8 pixels, the rows are stored from bottom to top.
+        std::vector<std::uint8_t> Pixels;
+        std::vector<TextureAtlasRegion> Regions;
+    };
+
+    /// Pack multiple sprite images into atlas pages offline.
+    class TextureAtlasPacker
+    {
+    public:
+        static constexpr std::uint32_t InvalidPageIndex = std::numeric_limits<std::uint32_t>::max();
+
+        struct PackedRect
+        {
+            /// InvalidPageIndex if the rect is too large to fit in an empty page.
+            std::uint32_t PageIndex = InvalidPageIndex;
+            std::uint32_t X = 0;
+            std::uint32_t Y = 0;
+        };
+
+        /// Pack the rects with the given sizes into pages with a shelf packer:
+        /// the rects are sorted by height & placed row by row, a new page is started when the current one is full.
+        /// \return the packed position of each rect, in the same order as the given sizes.
+        static std::vector<PackedRect> PackRects(std::vector<glm::u32vec2> const &sizes, TextureAtlasPackerSettings const &settings);
+
+        /// Load all the images (.png, .jpg, .jpeg, .tga, .bmp, .psd) directly under the given folder & pack them into pages.
+        /// The name of a region is the file name of the image without the extension.
+        static std::vector<TextureAtlasPage> PackFolder(std::filesystem::path const &folderPath, TextureAtlasPackerSettings const &settings);
+
+        /// Write the pixels of the page into an uncompressed 32-bit TGA image file.
+        /// \return true if the file is written successfully.
+        static bool WritePageImageToTGA(TextureAtlasPage const &page, std::filesystem::path const &path);
+    };
+}
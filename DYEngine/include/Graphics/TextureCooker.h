@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace DYE
+{
+    enum class CookedTextureFormat : std::uint32_t
+    {
+        /// Uncompressed, 4 bytes per texel.
+        RGBA8 = 0,
+        /// Block compressed without alpha (a.k.a. DXT1), 0.5 byte per texel.
+        BC1,
+        /// Block compressed with interpolated alpha (a.k.a. DXT5), 1 byte per texel.
+        BC3
+    };
+
+    struct TextureCookSettings
+    {
+        CookedTextureFormat Format = CookedTextureFormat::RGBA8;
+        bool GenerateMipmaps = true;
+    };
+
+    /// A decoded RGBA8 image, the rows are stored from bottom to top (same as the texture data uploaded to OpenGL).
+    struct TextureImage
+    {
+        std::uint32_t Width = 0;
+        std::uint32_t Height = 0;
+        std::vector<std::uint8_t> Pixels;
+    };
+
+    /// Texture data with a full mip chain encoded in the target format, it can be uploaded without any decoding.
+    struct CookedTexture
+    {
+        struct MipLevel
+        {
+            std::uint32_t Width = 0;
+            std::uint32_t Height = 0;
+            std::uint64_t Offset = 0;
+            std::uint64_t Size = 0;
+        };
+
+        CookedTextureFormat Format = CookedTextureFormat::RGBA8;
+        std::uint32_t Width = 0;
+        std::uint32_t Height = 0;
+        std::uint64_t SourceHash = 0;
+
+        /// The first level is the base level.
+        std::vector<MipLevel> MipLevels;
+
+        /// The data of all the mip levels packed together.
+        std::vector<std::uint8_t> Data;
+    };
+
+    /// Convert source images (.png, .jpg etc) into cooked textures (.dytex) offline.
+    /// Everything here runs on the CPU, therefore it doesn't need a GPU or an OpenGL context.
+    class TextureCooker
+    {
+    public:
+        static constexpr char const *CookedTextureExtension = ".dytex";
+
+        /// Decode the source image into RGBA8 with stb_image (the same way Texture2D loads an image).
+        static std::optional<TextureImage> DecodeSourceImage(std::filesystem::path const &sourcePath);
+
+        /// Generate the mip chain (2x2 box filter) of the image & encode each level into the format of the settings.
+        static CookedTexture Cook(TextureImage const &image, TextureCookSettings const &settings);
+
+        /// Hash the content of the source file together with the cook settings,
+        /// so that a cooked texture is invalidated whenever the source or the settings change.
+        static std::uint64_t HashSource(std::filesystem::path const &sourcePath, TextureCookSettings const &settings);
+
+        /// Cook the source image into the cache folder if it hasn't been cooked with the same content & settings before.
+        /// The cooked file is named '{stem}_{hash}.dytex'.
+        /// \return the path to the cooked texture, or nullopt if the source cannot be decoded.
+        static std::optional<std::filesystem::path> CookToCache(std::filesystem::path const &sourcePath,
+                                                                std::filesystem::path const &cacheFolderPath,
+                                                                TextureCookSettings const &settings);
+
+        static bool WriteCookedTexture(CookedTexture const &cookedTexture, std::filesystem::path const &path);
+        static std::optional<CookedTexture> ReadCookedTexture(std::filesystem::path const &path);
+    };
+}
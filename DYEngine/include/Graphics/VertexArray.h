@@ -25,6 +25,8 @@ namespace DYE
 
         virtual const std::vector<std::shared_ptr<VertexBuffer>> &GetVertexBuffers() const { return m_VertexBuffers; }
         virtual const std::shared_ptr<IndexBuffer> &GetIndexBuffer() const { return m_IndexBuffer; }
+
+        VertexArrayID GetID() const { return m_ID; }
     private:
         VertexArrayID m_ID {0};
         /// The latest index of the vertex array attributes
@@ -107,6 +107,9 @@ namespace DYE
 
         void MakeCurrent();
 
+        /// Detach the window's context from the calling thread.
+        void ReleaseCurrent();
+
     protected:
         /// The underlying GraphicsContext
         std::shared_ptr<ContextBase> m_Context;
@@ -20,9 +20,15 @@
 
 namespace DYE
 {
+    class InputRecorder;
+    class InputReplayer;
+
     // Inherit from EventHandler to receive device connect/disconnect events from EventSystem.
     class InputManager
     {
+        friend InputRecorder;
+        friend InputReplayer;
+
     private:
         struct GamepadState
         {
@@ -93,6 +99,24 @@ namespace DYE
         void DrawInputManagerImGui(bool *pIsOpen = nullptr) const;
 
     private:
+        /// A copy of the connected gamepad sparse set.
+        /// InputReplayer puts the live gamepads aside in it while the recorded gamepads are being replayed.
+        struct ConnectedGamepads
+        {
+            std::int32_t NumberOfConnectedGamepads = 0;
+            std::array<GamepadState, MaxNumberOfUniqueGamepads> GamepadStates;
+            std::array<std::int32_t, MaxNumberOfUniqueGamepads> GamepadStateIndices = {0};
+        };
+
+        /// Copy the current input states into the previous input states, called at the beginning of every input state update.
+        void bufferInputStates();
+
+        ConnectedGamepads captureConnectedGamepads() const;
+
+        /// Replace the connected gamepads with the given ones.
+        /// The gamepads that have been unplugged since they were captured are closed & not restored.
+        void restoreConnectedGamepads(ConnectedGamepads const &gamepads);
+
         void handleOnGamepadConnected(GamepadConnectEvent const &connectEvent);
         void handleOnGamepadDisconnected(GamepadDisconnectEvent const &disconnectEvent);
 
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Input/InputManager.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace DYE
+{
+    class Time;
+
+    /// The header at the beginning of a recorded input stream.
+    /// The device state counts are stored so a stream recorded with a different layout is rejected on replay.
+    struct InputRecordingHeader
+    {
+        /// 'DYEI' in little-endian.
+        static constexpr std::uint32_t Signature = 0x49455944;
+        static constexpr std::uint16_t CurrentVersion = 2;
+
+        std::uint32_t FileSignature = Signature;
+        std::uint16_t Version = CurrentVersion;
+        std::uint16_t NumberOfKeys = 0;
+        std::uint16_t NumberOfMouseButtons = 0;
+        std::uint16_t NumberOfGamepadButtons = 0;
+        std::uint16_t NumberOfGamepadAxes = 0;
+        std::uint16_t Padding = 0;
+        std::uint32_t FixedFramePerSecond = 0;
+        std::uint32_t Reserved = 0;
+        /// The seed of the entity GUIDs of the recorded session, so the entities created at runtime get the same GUIDs on replay.
+        /// 0 if the GUIDs of the recorded session were not seeded.
+        std::uint64_t GUIDSeed = 0;
+    };
+
+    /// Serialize per-frame input states (keyboard, mouse & gamepads) and frame delta times into a compact binary stream.
+    /// Each frame is stored as:
+    /// delta ticks (u32), keyboard key bits, mouse position (2 x i32), mouse button bits (u8),
+    /// number of connected gamepads (u8) followed by [device id (i32), button bits (u16), axes (i16 each)] per gamepad.
+    class InputRecorder
+    {
+    public:
+        InputRecorder() = default;
+        InputRecorder(InputRecorder const &) = delete;
+
+        /// Create (or overwrite) the file at the given path and write the stream header into it.
+        /// \param guidSeed the seed the entity GUIDs of the session are generated with, it's stored in the header for the replay.
+        /// \return true if the file has been opened successfully.
+        bool Open(std::filesystem::path const &path, Time const &time, std::uint64_t guidSeed);
+        void Close();
+        bool IsOpen() const { return m_Stream.is_open(); }
+
+        /// Write the current input states & delta time into the stream.
+        /// Call this after InputManager::UpdateInputState() every frame.
+        void RecordFrame(InputManager const &inputManager, Time const &time);
+
+        std::uint32_t GetNumberOfRecordedFrames() const { return m_NumberOfRecordedFrames; }
+
+    private:
+        std::ofstream m_Stream;
+        std::uint32_t m_NumberOfRecordedFrames = 0;
+    };
+
+    /// Read a stream written by InputRecorder and feed the recorded states into InputManager & Time frame by frame,
+    /// so that a session can be reproduced deterministically (i.e. to compare frame timings between builds).
+    class InputReplayer
+    {
+    public:
+        InputReplayer() = default;
+        InputReplayer(InputReplayer const &) = delete;
+
+        /// Open the recorded file at the given path and validate its header.
+        /// The live gamepads of the input manager are put aside during the replay, and restored when the replayer is closed.
+        /// \return true if the file has been opened successfully and is compatible with the current build.
+        bool Open(std::filesystem::path const &path, InputManager &inputManager);
+        void Close();
+        bool IsOpen() const { return m_Stream.is_open(); }
+
+        /// Read the next recorded frame and replace the current input states & delta time with it.
+        /// Call this instead of InputManager::UpdateInputState() every frame.
+        /// \return false if the end of the stream has been reached (or the stream is corrupted), in which case nothing is changed.
+        bool ReplayNextFrame(InputManager &inputManager, Time &time);
+
+        std::uint32_t GetNumberOfReplayedFrames() const { return m_NumberOfReplayedFrames; }
+
+        /// The seed of the entity GUIDs stored in the header of the opened recording.
+        std::uint64_t GetGUIDSeed() const { return m_GUIDSeed; }
+
+    private:
+        /// Move the gamepads that have been plugged in since the last replayed frame into the live gamepads.
+        void putPluggedInGamepadsAside(InputManager &inputManager);
+
+    private:
+        std::ifstream m_Stream;
+        std::uint32_t m_FixedFramePerSecond = 0;
+        std::uint64_t m_GUIDSeed = 0;
+        std::uint32_t m_NumberOfReplayedFrames = 0;
+
+        InputManager *m_pInputManager = nullptr;
+        InputManager::ConnectedGamepads m_LiveGamepads;
+    };
+}
@@ -42,5 +42,11 @@ namespace DYE::Math
 
     bool MovingCircleAABBIntersect(glm::vec2 center, float radius, glm::vec2 direction, AABB const &aabb, DynamicTestResult2D &testResult);
 
+    /// \param maxTime the circle fails the test if it could only hit the AABB after moving farther than (direction * maxTime).
+    bool MovingCircleAABBIntersect(glm::vec2 center, float radius, glm::vec2 direction, float maxTime, AABB const &aabb, DynamicTestResult2D &testResult);
+
     bool MovingAABBAABBIntersect2D(AABB const &aabb, glm::vec2 direction, AABB const &otherAABB, DynamicTestResult2D &testResult);
+
+    /// \param maxTime the AABB fails the test if it could only hit the other AABB after moving farther than (direction * maxTime).
+    bool MovingAABBAABBIntersect2D(AABB const &aabb, glm::vec2 direction, float maxTime, AABB const &otherAABB, DynamicTestResult2D &testResult);
 }
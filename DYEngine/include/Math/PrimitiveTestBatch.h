@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Math/AABB.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace DYE::Math
+{
+    /// 2D AABBs stored as a structure of arrays, so that the batch tests can load several of them into one SIMD register.
+    struct AABBBatch2D
+    {
+        std::vector<float> MinX;
+        std::vector<float> MinY;
+        std::vector<float> MaxX;
+        std::vector<float> MaxY;
+
+        std::size_t Size() const { return MinX.size(); }
+        void Reserve(std::size_t capacity);
+        void Clear();
+        void Add(AABB const &aabb);
+    };
+
+    /// Circles stored as a structure of arrays, see AABBBatch2D.
+    struct CircleBatch2D
+    {
+        std::vector<float> CenterX;
+        std::vector<float> CenterY;
+        std::vector<float> Radius;
+
+        std::size_t Size() const { return CenterX.size(); }
+        void Reserve(std::size_t capacity);
+        void Clear();
+        void Add(glm::vec2 center, float radius);
+    };
+
+    enum class BatchTestKernel
+    {
+        Scalar,
+        /// The widest instruction set enabled at compile time (AVX2, SSE2 or NEON), falls back to Scalar if there is none.
+        /// The shapes that don't fill a whole register are tested with the scalar kernel.
+        SIMD
+    };
+
+    /// \return the name of the instruction set used by BatchTestKernel::SIMD, i.e. "AVX2".
+    char const *GetSIMDBatchTestKernelName();
+
+    // The batch tests give the same results as their one-pair versions in PrimitiveTest.h.
+    // outHits[i] is set to 1 if the i-th shape is hit, 0 otherwise, and the outHits span should be at least as long as the batch.
+    // outHitTimes[i] is only valid if outHits[i] is 1.
+    // They return the number of the hit shapes.
+
+    std::size_t AABBAABBIntersect2D(AABB const &aabb, AABBBatch2D const &batch, std::span<std::uint8_t> outHits,
+                                    BatchTestKernel kernel = BatchTestKernel::SIMD);
+
+    std::size_t AABBCircleIntersect(AABBBatch2D const &batch, glm::vec2 center, float radius, std::span<std::uint8_t> outHits,
+                                    BatchTestKernel kernel = BatchTestKernel::SIMD);
+
+    std::size_t CircleCircleIntersect(glm::vec2 center, float radius, CircleBatch2D const &batch, std::span<std::uint8_t> outHits,
+                                      BatchTestKernel kernel = BatchTestKernel::SIMD);
+
+    /// \param outHitTimes the normalized hit times based on rayDirection length, see RayAABBIntersect2D in PrimitiveTest.h.
+    std::size_t RayAABBIntersect2D(glm::vec2 rayOrigin, glm::vec2 rayDirection, float maxDistance, AABBBatch2D const &batch,
+                                   std::span<std::uint8_t> outHits, std::span<float> outHitTimes,
+                                   BatchTestKernel kernel = BatchTestKernel::SIMD);
+
+    /// \param outHitTimes the normalized hit times based on rayDirection length, 0 if the ray starts inside the circle.
+    std::size_t RayCircleIntersect(glm::vec2 rayOrigin, glm::vec2 rayDirection, CircleBatch2D const &batch,
+                                   std::span<std::uint8_t> outHits, std::span<float> outHitTimes,
+                                   BatchTestKernel kernel = BatchTestKernel::SIMD);
+
+    /// \param maxTime the AABB fails the test if it could only hit the other AABB after moving farther than (direction * maxTime).
+    /// \param outHitTimes the normalized hit times based on direction length, 0 if the AABBs are initially overlapping.
+    std::size_t MovingAABBAABBIntersect2D(AABB const &aabb, glm::vec2 direction, float maxTime, AABBBatch2D const &batch,
+                                          std::span<std::uint8_t> outHits, std::span<float> outHitTimes,
+                                          BatchTestKernel kernel = BatchTestKernel::SIMD);
+
+    /// \param maxTime the circle fails the test if it could only hit the AABB after moving farther than (direction * maxTime).
+    /// \param outHitTimes the normalized hit times based on direction length.
+    std::size_t MovingCircleAABBIntersect(glm::vec2 center, float radius, glm::vec2 direction, float maxTime, AABBBatch2D const &batch,
+                                          std::span<std::uint8_t> outHits, std::span<float> outHitTimes,
+                                          BatchTestKernel kernel = BatchTestKernel::SIMD);
+}
\ No newline at end of file
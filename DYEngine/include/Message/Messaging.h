@@ -6,13 +6,15 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <utility>
 
 namespace DYE
 {
     struct MessageData
     {
-        /// Return the debug name of the MessageData
-        virtual std::string GetName() const = 0;
+        /// Return the debug name of the MessageData.
+        /// The name is expected to be a string literal, so no string is constructed when querying it.
+        virtual char const *GetName() const = 0;
 
         virtual ~MessageData() = default;
     };
@@ -69,6 +71,17 @@ namespace DYE
             }
         }
 
+        /// Construct a message of the given concrete type in place and broadcast it to the registered handlers.
+        /// The message only lives on the stack for the duration of the broadcast, therefore no heap allocation is involved.
+        template<typename TConcreteMessageData, typename... Args>
+        void emplaceBroadcast(Args &&... args)
+        {
+            static_assert(std::is_base_of<TMessageData, TConcreteMessageData>::value, "TConcreteMessageData must inherit from TMessageData.");
+
+            TConcreteMessageData messageData(std::forward<Args>(args)...);
+            broadcast(messageData);
+        }
+
     private:
         std::vector<MessageHandlerBase<TMessageData> *> m_MessageHandlers {};
     };
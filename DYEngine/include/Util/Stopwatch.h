@@ -0,0 +1,24 @@
+#pragma once
+
+#include <chrono>
+
+namespace DYE
+{
+    /// A simple high resolution stopwatch for measuring elapsed wall-clock time,
+    /// mostly used for profiling & benchmarking.
+    class Stopwatch
+    {
+    public:
+        /// Create a stopwatch that starts measuring immediately.
+        Stopwatch();
+
+        /// Reset the start point of the stopwatch to now.
+        void Restart();
+
+        double GetElapsedSeconds() const;
+        double GetElapsedMilliseconds() const;
+
+    private:
+        std::chrono::steady_clock::time_point m_StartTimePoint;
+    };
+}
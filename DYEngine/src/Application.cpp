@@ -9,10 +9,15 @@
 #include "Graphics/RenderCommand.h"
 #include "Graphics/RenderPipelineManager.h"
 #include "Graphics/RenderPipeline2D.h"
+#include "Graphics/NullRenderPipeline.h"
+#include "Graphics/RecordingRenderCommand.h"
+#include "Event/SDLEventSystem.h"
+#include "Util/Stopwatch.h"
 
 #include <SDL.h>
 
 #include <ranges>
+#include <limits>
 
 namespace DYE
 {
@@ -96,10 +101,49 @@ namespace DYE
         pushOverlayImmediate(m_ImGuiLayer);
     }
 
+    Application::Application(HeadlessRunProperties headlessRunProperties, int fixedFramePerSecond)
+        : m_IsHeadless(true), m_HeadlessRunProperties(headlessRunProperties)
+    {
+        SDL_Init(0);
+        // Only events subsystem is needed, no video (window & context), audio or game controller.
+        SDL_InitSubSystem(SDL_INIT_EVENTS);
+
+        SDL_version sdlVersion;
+        SDL_GetVersion(&sdlVersion);
+        DYE_LOG("Init SDL (headless): %d.%d.%d", sdlVersion.major, sdlVersion.minor, sdlVersion.patch);
+        DYE_LOG("OS: %s", SDL_GetPlatform());
+        DYE_LOG("CPU cores: %d", SDL_GetCPUCount());
+
+        // Initialize core systems: time, input etc
+        Time::InitSingleton(fixedFramePerSecond);
+        Screen::InitSingleton();
+        InputManager::InitSingleton();
+
+        // Render commands & submissions only record statistics.
+        RenderCommand::InitSingleton(std::make_unique<RecordingRenderCommand>(false));
+        RenderPipelineManager::InitializeHeadless();
+        RenderPipelineManager::SetActiveRenderPipeline(std::make_shared<NullRenderPipeline>());
+
+        // There is no ImGui context in headless mode, so the events are not passed to ImGui.
+        auto eventSystem = std::make_unique<SDLEventSystem>();
+        eventSystem->SetPreProcessImGuiEvent(false);
+        m_EventSystem = std::move(eventSystem);
+        m_EventSystem->Register(this);
+
+        DYE_LOG("Run headless: max number of frames - %llu, max duration - %.2f seconds, fixed delta time - %s",
+                (unsigned long long) m_HeadlessRunProperties.MaxNumberOfFrames,
+                m_HeadlessRunProperties.MaxDurationInSeconds,
+                m_HeadlessRunProperties.UseFixedDeltaTime ? "true" : "false");
+    }
+
     Application::~Application()
     {
+        m_RenderThread.Stop();
         m_EventSystem->Unregister(this);
-        AudioManager::Close();
+        if (!m_IsHeadless)
+        {
+            AudioManager::Close();
+        }
         SDL_Quit();
     }
 
@@ -116,13 +160,57 @@ namespace DYE
             layer->OnPreApplicationRun();
         }
 
+        // Frame timing statistics, only used in headless mode.
+        std::uint64_t numberOfFrames = 0;
+        double minFrameMilliseconds = std::numeric_limits<double>::max();
+        double maxFrameMilliseconds = 0;
+        Stopwatch runStopwatch;
+        Stopwatch frameStopwatch;
+
         while (m_IsRunning)
         {
+            frameStopwatch.Restart();
+
+            // Switch the rendering mode between frames, when there is no frame in flight.
+            bool const useThreadedRendering = m_UseThreadedRendering && !m_IsHeadless;
+            if (useThreadedRendering && !m_RenderThread.IsRunning())
+            {
+                m_RenderThread.Start(*WindowManager::GetMainWindow());
+            }
+            else if (!useThreadedRendering && m_RenderThread.IsRunning())
+            {
+                m_RenderThread.Stop();
+            }
+
             // Poll system events
             m_EventSystem->PollEvent();
 
-            // Update input states
-            INPUT.UpdateInputState();
+            // Update input states, either from the input devices or from the replayed input stream.
+            if (m_InputReplayer.IsOpen())
+            {
+                bool const hasReplayedFrame = m_InputReplayer.ReplayNextFrame(INPUT, TIME);
+                if (!hasReplayedFrame)
+                {
+                    // Reach the end of the recording, switch back to the input devices.
+                    m_InputReplayer.Close();
+                    INPUT.UpdateInputState();
+                }
+            }
+            else
+            {
+                INPUT.UpdateInputState();
+            }
+
+            if (m_IsHeadless && m_HeadlessRunProperties.UseFixedDeltaTime && !m_InputReplayer.IsOpen())
+            {
+                // Step the game loop at exactly one fixed delta time per frame. Replayed delta times have the priority though.
+                TIME.overrideDeltaTime(TIME.FixedDeltaTime());
+            }
+
+            if (m_InputRecorder.IsOpen())
+            {
+                m_InputRecorder.RecordFrame(INPUT, TIME);
+            }
 
             // Game logic fixed update
             deltaTimeAccumulator += TIME.DeltaTime();
@@ -135,6 +223,7 @@ namespace DYE
 
                 deltaTimeAccumulator -= TIME.FixedDeltaTime();
             }
+            TIME.setFixedUpdateAccumulator(deltaTimeAccumulator);
 
             // Game logic update
             for (auto &layer: m_LayerStack)
@@ -143,7 +232,10 @@ namespace DYE
             }
 
             // Update AudioStreams
-            AudioManager::UpdateRegisteredAudioStreams();
+            if (!m_IsHeadless)
+            {
+                AudioManager::UpdateRegisteredAudioStreams();
+            }
 
             // Game logic render
             // Normally you would populate render data to the render pipeline in this phase
@@ -152,10 +244,18 @@ namespace DYE
             {
                 layer->OnRender();
             }
-            glEnable(GL_CULL_FACE);
-            glCullFace(GL_BACK);
-            // Execute draw-calls on GPU
-            RenderPipelineManager::RenderWithActivePipeline();
+
+            if (m_RenderThread.IsRunning())
+            {
+                // Sync point: the previous frame packet has to be rendered before ImGui is drawn on top of it & the window is swapped.
+                // The packet of this frame is kicked after the swap.
+                m_RenderThread.WaitForFrame();
+            }
+            else
+            {
+                // Execute draw-calls on GPU
+                RenderPipelineManager::RenderWithActivePipeline();
+            }
 
             for (auto &layer: m_LayerStack)
             {
@@ -163,29 +263,34 @@ namespace DYE
             }
 
 
-            // ImGui
-            m_ImGuiLayer->BeginImGui();
-            for (auto &layer: m_LayerStack)
+            if (!m_IsHeadless)
             {
-                layer->OnImGui();
+                // ImGui
+                m_ImGuiLayer->BeginImGui();
+                for (auto &layer: m_LayerStack)
+                {
+                    layer->OnImGui();
+                }
+                m_ImGuiLayer->EndImGui();
+
+                // Swap the buffer of the main application window
+                // We swap the main window here instead of in the render pipeline manager
+                // because some imgui viewports are rendered inside main window, and we want to do those first before the swap.
+                // FIXME: right now we call swap buffer directly because EndImGui() call already set
+                //  the main window context as current. Otherwise we will have to call
+                // 	mainWindow->GetContext()->MakeCurrentForWindow(mainWindow) first.
+                //  At some point we want to fix this cuz it's kinda awkward and non-explicit enough
+                //  and might lead to complex bugs in the future.
+                RenderCommand::GetInstance().SwapWindowBuffer(*WindowManager::GetMainWindow());
+
+                // Update all registered Windows
+                // For now, it does nothing.
+                WindowManager::UpdateWindows();
             }
-            m_ImGuiLayer->EndImGui();
-
-            // Swap the buffer of the main application window
-            // We swap the main window here instead of in the render pipeline manager
-            // because some imgui viewports are rendered inside main window, and we want to do those first before the swap.
-            // FIXME: right now we call swap buffer directly because EndImGui() call already set
-            //  the main window context as current. Otherwise we will have to call
-            // 	mainWindow->GetContext()->MakeCurrentForWindow(mainWindow) first.
-            //  At some point we want to fix this cuz it's kinda awkward and non-explicit enough
-            //  and might lead to complex bugs in the future.
-            RenderCommand::GetInstance().SwapWindowBuffer(*WindowManager::GetMainWindow());
-
-            // Update all registered Windows
-            // For now, it does nothing.
-            WindowManager::UpdateWindows();
 
             // End of frame.
+            // The layers might still use the render API here (i.e. reading back the picking framebuffer, loading a scene),
+            // therefore the frame packet is kicked after the end of frame work.
             for (auto &layer: m_LayerStack)
             {
                 layer->OnEndOfFrame();
@@ -212,12 +317,95 @@ namespace DYE
             }
             m_LayerOperations.clear();
 
+            if (m_RenderThread.IsRunning())
+            {
+                // Render the packet of this frame while the next frame is being simulated.
+                m_RenderThread.KickFrame();
+            }
+
+            if (m_IsHeadless)
+            {
+                double const frameMilliseconds = frameStopwatch.GetElapsedMilliseconds();
+                minFrameMilliseconds = std::min(minFrameMilliseconds, frameMilliseconds);
+                maxFrameMilliseconds = std::max(maxFrameMilliseconds, frameMilliseconds);
+                numberOfFrames++;
+
+                bool const reachMaxNumberOfFrames = m_HeadlessRunProperties.MaxNumberOfFrames > 0 && numberOfFrames >= m_HeadlessRunProperties.MaxNumberOfFrames;
+                bool const reachMaxDuration = m_HeadlessRunProperties.MaxDurationInSeconds > 0 && runStopwatch.GetElapsedSeconds() >= m_HeadlessRunProperties.MaxDurationInSeconds;
+                if (reachMaxNumberOfFrames || reachMaxDuration)
+                {
+                    m_IsRunning = false;
+                }
+            }
+
             TIME.tickUpdate();
         }
 
+        m_RenderThread.Stop();
+
+        if (m_IsHeadless)
+        {
+            logHeadlessRunSummary(numberOfFrames, runStopwatch.GetElapsedSeconds(), minFrameMilliseconds, maxFrameMilliseconds);
+        }
+
         DYE_LOG("Exit Game Loop");
     }
 
+    void Application::logHeadlessRunSummary(std::uint64_t numberOfFrames, double totalSeconds, double minFrameMilliseconds, double maxFrameMilliseconds) const
+    {
+        if (numberOfFrames == 0)
+        {
+            DYE_LOG("Headless run summary: no frame has been run.");
+            return;
+        }
+
+        double const averageFrameMilliseconds = totalSeconds * 1000.0 / (double) numberOfFrames;
+        DYE_LOG("Headless run summary:\n"
+                "\tFrames - %llu\n"
+                "\tTotal Time - %.3f seconds\n"
+                "\tFrame Time (avg / min / max) - %.4f / %.4f / %.4f ms\n"
+                "\tAverage FPS - %.2f",
+                (unsigned long long) numberOfFrames,
+                totalSeconds,
+                averageFrameMilliseconds, minFrameMilliseconds, maxFrameMilliseconds,
+                (double) numberOfFrames / totalSeconds);
+
+        auto *pNullPipeline = RenderPipelineManager::TryGetTypedActiveRenderPipelinePtr<NullRenderPipeline>();
+        if (pNullPipeline != nullptr)
+        {
+            auto const &statistics = pNullPipeline->GetStatistics();
+            DYE_LOG("Headless render statistics:\n"
+                    "\tRendered Frames - %llu\n"
+                    "\tSubmissions (total / avg per frame / max per frame) - %llu / %.2f / %u\n"
+                    "\tRendered Cameras - %llu",
+                    (unsigned long long) statistics.NumberOfFrames,
+                    (unsigned long long) statistics.NumberOfSubmissions,
+                    statistics.NumberOfFrames > 0 ? (double) statistics.NumberOfSubmissions / (double) statistics.NumberOfFrames : 0.0,
+                    statistics.MaxNumberOfSubmissionsPerFrame,
+                    (unsigned long long) statistics.NumberOfRenderedCameras);
+        }
+    }
+
+    bool Application::StartInputRecording(std::filesystem::path const &path, std::uint64_t guidSeed)
+    {
+        return m_InputRecorder.Open(path, TIME, guidSeed);
+    }
+
+    void Application::StopInputRecording()
+    {
+        m_InputRecorder.Close();
+    }
+
+    bool Application::StartInputReplay(std::filesystem::path const &path)
+    {
+        return m_InputReplayer.Open(path, INPUT);
+    }
+
+    void Application::StopInputReplay()
+    {
+        m_InputReplayer.Close();
+    }
+
     void Application::Handle(Event &event)
     {
         auto const &eventType = event.GetEventType();
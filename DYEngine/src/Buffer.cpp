@@ -15,12 +15,24 @@ namespace DYE
 
     VertexBuffer::VertexBuffer(std::uint32_t size, BufferUsageHint usage)
     {
+        if (!IsOpenGLLoaded())
+        {
+            // Headless, the buffer stays as an empty handle.
+            return;
+        }
+
         glCall(glCreateBuffers(1, &m_ID));
         glCall(glNamedBufferData(m_ID, size, nullptr, static_cast<GLenum>(usage)));
     }
 
     VertexBuffer::VertexBuffer(void *vertices, std::uint32_t size, BufferUsageHint usage)
     {
+        if (!IsOpenGLLoaded())
+        {
+            // Headless, the buffer stays as an empty handle.
+            return;
+        }
+
         glCall(glCreateBuffers(1, &m_ID));
         glCall(glNamedBufferData(m_ID, size, vertices, static_cast<GLenum>(usage)));
     }
@@ -59,6 +71,12 @@ namespace DYE
 
     IndexBuffer::IndexBuffer(std::uint32_t count, BufferUsageHint usage) : m_IndicesCount(count)
     {
+        if (!IsOpenGLLoaded())
+        {
+            // Headless, only the count is kept.
+            return;
+        }
+
         glCall(glCreateBuffers(1, &m_ID));
 
         // GL_ELEMENT_ARRAY_BUFFER is not valid without an actively bound VAO
@@ -68,6 +86,12 @@ namespace DYE
 
     IndexBuffer::IndexBuffer(std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage) : m_IndicesCount(count)
     {
+        if (!IsOpenGLLoaded())
+        {
+            // Headless, only the count is kept.
+            return;
+        }
+
         glCall(glCreateBuffers(1, &m_ID));
 
         // GL_ELEMENT_ARRAY_BUFFER is not valid without an actively bound VAO
@@ -87,7 +111,10 @@ namespace DYE
 
     void IndexBuffer::ResetData(std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage)
     {
-        glCall(glNamedBufferData(m_ID, count * sizeof(std::uint32_t), indices, static_cast<GLenum>(usage)));
+        if (m_ID != 0)
+        {
+            glCall(glNamedBufferData(m_ID, count * sizeof(std::uint32_t), indices, static_cast<GLenum>(usage)));
+        }
         m_IndicesCount = count;
     }
 }
\ No newline at end of file
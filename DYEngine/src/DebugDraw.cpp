@@ -5,6 +5,8 @@
 #include "Graphics/VertexArray.h"
 #include "Graphics/Buffer.h"
 #include "Graphics/RenderCommand.h"
+#include "Graphics/StreamingBuffer.h"
+#include "Util/Macro.h"
 
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtx/quaternion.hpp>
@@ -12,30 +14,62 @@
 #include <array>
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 namespace DYE
 {
+    namespace
+    {
+#ifdef DYE_DEBUG
+        /// The number of draw calls that are recording into the thread buffers, see DebugDraw::captureFramePacket.
+        std::atomic<std::uint32_t> s_NumberOfRecordingDraws {0};
+#endif
+
+        /// Count the draw call as recording while it's in scope, only in debug builds.
+        struct RecordingDrawScope
+        {
+#ifdef DYE_DEBUG
+            RecordingDrawScope() { s_NumberOfRecordingDraws.fetch_add(1, std::memory_order_relaxed); }
+            ~RecordingDrawScope() { s_NumberOfRecordingDraws.fetch_sub(1, std::memory_order_release); }
+#endif
+        };
+    }
+
     std::shared_ptr<ShaderProgram> DebugDraw::s_LineGizmoShaderProgram {};
     std::shared_ptr<ShaderProgram> DebugDraw::s_GeometryGizmoShaderProgram {};
 
+    std::shared_ptr<StreamingBuffer> DebugDraw::s_StreamingBuffer {};
+    bool DebugDraw::s_IsStreamedThisFrame = false;
+
+    std::mutex DebugDraw::s_ThreadBuffersMutex {};
+    std::vector<std::unique_ptr<DebugDraw::ThreadBuffers>> DebugDraw::s_ThreadBuffers {};
+    DebugDraw::ThreadBuffers DebugDraw::s_ExitedThreadBuffers {};
+    DebugDraw::ThreadBuffers DebugDraw::s_FramePacketBuffers {};
+
+    std::uint32_t DebugDraw::s_PrimitiveBudgetPerFrame = DebugDraw::DefaultPrimitiveBudgetPerFrame;
+    std::atomic<std::uint32_t> DebugDraw::s_NumberOfPrimitivesThisFrame = 0;
+    std::atomic<std::uint32_t> DebugDraw::s_NumberOfDroppedPrimitivesThisFrame = 0;
+    DebugDrawStatistics DebugDraw::s_StatisticsLastFrame {};
+
     std::shared_ptr<VertexArray> DebugDraw::s_BatchedLineVAO {};
-    std::vector<float> DebugDraw::s_BatchedLineVertices = {};
-    std::vector<std::uint32_t> DebugDraw::s_BatchedLineIndices = {};
+    DebugDraw::StreamedRange DebugDraw::s_BatchedLineRange {};
 
     std::shared_ptr<VertexArray> DebugDraw::s_CubeVAO {};
-    DebugDraw::GeometryInstancedArrays DebugDraw::s_CubeInstancedArrays {};
+    DebugDraw::StreamedRange DebugDraw::s_CubeRange {};
 
     std::shared_ptr<VertexArray> DebugDraw::s_WireCubeVAO {};
-    DebugDraw::GeometryInstancedArrays DebugDraw::s_WireCubeInstancedArrays {};
+    DebugDraw::StreamedRange DebugDraw::s_WireCubeRange {};
 
     std::shared_ptr<VertexArray> DebugDraw::s_CircleVAO {};
-    DebugDraw::GeometryInstancedArrays DebugDraw::s_CircleInstancedArrays {};
+    DebugDraw::StreamedRange DebugDraw::s_CircleRange {};
 
     void DebugDraw::initialize()
     {
         s_LineGizmoShaderProgram = ShaderProgram::CreateFromFile("Shader_DebugLineGizmo", "assets\\default\\DebugLineGizmo.shader");
         s_GeometryGizmoShaderProgram = ShaderProgram::CreateFromFile("Shader_DebugGeometryGizmo", "assets\\default\\DebugGeometryGizmo.shader");
 
+        s_StreamingBuffer = StreamingBuffer::Create(StreamingBufferCapacityPerFrame);
+
         s_BatchedLineVAO = createBatchedLineVAO();
         s_CubeVAO = createCubeVAO();
         s_WireCubeVAO = createWireCubeVAO();
@@ -46,18 +80,15 @@ namespace DYE
     {
         auto vao = VertexArray::Create();
         {
-            auto vertexBufferObject = VertexBuffer::Create(0, BufferUsageHint::StreamDraw);
+            // Both vertices & indices are streamed into the streaming buffer every frame.
             VertexLayout const vertexLayout
                 {
                     VertexAttribute(VertexAttributeType::Float3, "position", false),
                     VertexAttribute(VertexAttributeType::Float4, "color", false)
                 };
 
-            vertexBufferObject->SetLayout(vertexLayout);
-            vao->AddVertexBuffer(vertexBufferObject);
-
-            auto indexBufferObject = IndexBuffer::Create(0, BufferUsageHint::StreamDraw);
-            vao->SetIndexBuffer(indexBufferObject);
+            vao->AddVertexBuffer(s_StreamingBuffer->CreateVertexBufferView(vertexLayout));
+            vao->SetIndexBuffer(s_StreamingBuffer->CreateIndexBufferView());
         }
 
         return std::move(vao);
@@ -121,33 +152,7 @@ namespace DYE
             vao->SetIndexBuffer(indexBufferObject);
         }
 
-        // Create vertex buffer object for per instance color
-        {
-            auto instancedVertexBufferObject = VertexBuffer::Create(0, BufferUsageHint::StreamDraw);
-
-            // We set the divisor to 1, so the vertex attribute only strides when a new instance is being rendered.
-            VertexLayout const vertexLayout
-                {
-                    VertexAttribute(VertexAttributeType::Float4, "perInstanceColor", false, 1)
-                };
-
-            instancedVertexBufferObject->SetLayout(vertexLayout);
-            vao->AddVertexBuffer(instancedVertexBufferObject);
-        }
-
-        // Create vertex buffer object for per instance model matrix
-        {
-            auto instancedVertexBufferObject = VertexBuffer::Create(0, BufferUsageHint::StreamDraw);
-
-            // We set the divisor to 1, so the vertex attribute only strides when a new instance is being rendered.
-            VertexLayout const vertexLayout
-                {
-                    VertexAttribute(VertexAttributeType::Mat4, "perInstanceModelMatrix", false, 1)
-                };
-
-            instancedVertexBufferObject->SetLayout(vertexLayout);
-            vao->AddVertexBuffer(instancedVertexBufferObject);
-        }
+        addInstancedVertexBufferView(*vao);
 
         return std::move(vao);
     }
@@ -207,33 +212,7 @@ namespace DYE
             vao->SetIndexBuffer(indexBufferObject);
         }
 
-        // Create vertex buffer object for per instance color
-        {
-            auto instancedVertexBufferObject = VertexBuffer::Create(0, BufferUsageHint::StreamDraw);
-
-            // We set the divisor to 1, so the vertex attribute only strides when a new instance is being rendered.
-            VertexLayout const vertexLayout
-                {
-                    VertexAttribute(VertexAttributeType::Float4, "perInstanceColor", false, 1)
-                };
-
-            instancedVertexBufferObject->SetLayout(vertexLayout);
-            vao->AddVertexBuffer(instancedVertexBufferObject);
-        }
-
-        // Create vertex buffer object for per instance model matrix
-        {
-            auto instancedVertexBufferObject = VertexBuffer::Create(0, BufferUsageHint::StreamDraw);
-
-            // We set the divisor to 1, so the vertex attribute only strides when a new instance is being rendered.
-            VertexLayout const vertexLayout
-                {
-                    VertexAttribute(VertexAttributeType::Mat4, "perInstanceModelMatrix", false, 1)
-                };
-
-            instancedVertexBufferObject->SetLayout(vertexLayout);
-            vao->AddVertexBuffer(instancedVertexBufferObject);
-        }
+        addInstancedVertexBufferView(*vao);
 
         return std::move(vao);
     }
@@ -276,180 +255,282 @@ namespace DYE
             vao->SetIndexBuffer(indexBufferObject);
         }
 
-        // Create vertex buffer object for per instance color
+        addInstancedVertexBufferView(*vao);
+
+        return std::move(vao);
+    }
+
+    void DebugDraw::addInstancedVertexBufferView(VertexArray &vao)
+    {
+        // Per instance color & model matrix are interleaved in the streaming buffer.
+        // We set the divisor to 1, so the vertex attributes only stride when a new instance is being rendered.
+        VertexLayout const vertexLayout
+            {
+                VertexAttribute(VertexAttributeType::Float4, "perInstanceColor", false, 1),
+                VertexAttribute(VertexAttributeType::Mat4, "perInstanceModelMatrix", false, 1)
+            };
+
+        vao.AddVertexBuffer(s_StreamingBuffer->CreateVertexBufferView(vertexLayout));
+    }
+
+    DebugDraw::ThreadBuffers &DebugDraw::getThreadBuffers()
+    {
+        struct ThreadBuffersOwner
         {
-            auto instancedVertexBufferObject = VertexBuffer::Create(0, BufferUsageHint::StreamDraw);
+            ThreadBuffers *pThreadBuffers = nullptr;
 
-            // We set the divisor to 1, so the vertex attribute only strides when a new instance is being rendered.
-            VertexLayout const vertexLayout
+            ~ThreadBuffersOwner()
+            {
+                if (pThreadBuffers == nullptr)
                 {
-                    VertexAttribute(VertexAttributeType::Float4, "perInstanceColor", false, 1)
-                };
+                    return;
+                }
 
-            instancedVertexBufferObject->SetLayout(vertexLayout);
-            vao->AddVertexBuffer(instancedVertexBufferObject);
+                // Keep the draw data of this frame until the next capture.
+                std::scoped_lock lock(s_ThreadBuffersMutex);
+                s_ExitedThreadBuffers.Append(*pThreadBuffers);
+                std::erase_if(s_ThreadBuffers, [this](auto const &pRegistered) { return pRegistered.get() == pThreadBuffers; });
+            }
+        };
+
+        thread_local ThreadBuffersOwner owner;
+        if (owner.pThreadBuffers == nullptr)
+        {
+            std::scoped_lock lock(s_ThreadBuffersMutex);
+            owner.pThreadBuffers = s_ThreadBuffers.emplace_back(std::make_unique<ThreadBuffers>()).get();
         }
 
-        // Create vertex buffer object for per instance model matrix
+        return *owner.pThreadBuffers;
+    }
+
+    bool DebugDraw::tryConsumePrimitiveBudget(std::uint32_t numberOfPrimitives)
+    {
+        std::uint32_t const numberOfPrimitivesBefore = s_NumberOfPrimitivesThisFrame.fetch_add(numberOfPrimitives, std::memory_order_relaxed);
+        if (numberOfPrimitivesBefore + numberOfPrimitives > s_PrimitiveBudgetPerFrame)
         {
-            auto instancedVertexBufferObject = VertexBuffer::Create(0, BufferUsageHint::StreamDraw);
+            s_NumberOfDroppedPrimitivesThisFrame.fetch_add(numberOfPrimitives, std::memory_order_relaxed);
+            return false;
+        }
 
-            // We set the divisor to 1, so the vertex attribute only strides when a new instance is being rendered.
-            VertexLayout const vertexLayout
-                {
-                    VertexAttribute(VertexAttributeType::Mat4, "perInstanceModelMatrix", false, 1)
-                };
+        return true;
+    }
+
+    void DebugDraw::captureFramePacket()
+    {
+        s_FramePacketBuffers.Clear();
+        s_StatisticsLastFrame = {};
+
+        // The mutex only guards the registration, the thread buffers themselves are written without a lock.
+        DYE_ASSERT(s_NumberOfRecordingDraws.load() == 0 && "DebugDraw: the frame packet is captured while a thread is still drawing, join the parallel work first.");
 
-            instancedVertexBufferObject->SetLayout(vertexLayout);
-            vao->AddVertexBuffer(instancedVertexBufferObject);
+        {
+            std::scoped_lock lock(s_ThreadBuffersMutex);
+            s_FramePacketBuffers.Append(s_ExitedThreadBuffers);
+            s_ExitedThreadBuffers.Clear();
+
+            for (auto const &pThreadBuffers: s_ThreadBuffers)
+            {
+                s_FramePacketBuffers.Append(*pThreadBuffers);
+                pThreadBuffers->Clear();
+            }
         }
 
-        return std::move(vao);
+        s_StatisticsLastFrame.NumberOfLines = s_FramePacketBuffers.LineVertices.size() / 2;
+        s_StatisticsLastFrame.NumberOfGeometryInstances = s_FramePacketBuffers.CubeInstances.size() +
+                                                          s_FramePacketBuffers.WireCubeInstances.size() +
+                                                          s_FramePacketBuffers.CircleInstances.size();
+
+        // The budget is per simulated frame. Primitives dropped when streaming the previous packet are counted in this frame.
+        s_StatisticsLastFrame.NumberOfDroppedPrimitives = s_NumberOfDroppedPrimitivesThisFrame.exchange(0);
+        s_NumberOfPrimitivesThisFrame = 0;
     }
 
-    void DebugDraw::renderDebugDrawOnCamera(Camera const &camera)
+    void DebugDraw::streamDebugDrawData()
     {
-        if (!s_LineGizmoShaderProgram || !s_GeometryGizmoShaderProgram)
+        s_StreamingBuffer->BeginFrame();
+        s_IsStreamedThisFrame = true;
+
+        streamBatchedLines();
+        streamGeometryInstances(s_FramePacketBuffers.CubeInstances, s_CubeRange);
+        streamGeometryInstances(s_FramePacketBuffers.WireCubeInstances, s_WireCubeRange);
+        streamGeometryInstances(s_FramePacketBuffers.CircleInstances, s_CircleRange);
+    }
+
+    void DebugDraw::streamBatchedLines()
+    {
+        auto const &lineVertices = s_FramePacketBuffers.LineVertices;
+        auto const numberOfVertices = (std::uint32_t) lineVertices.size();
+        if (numberOfVertices == 0)
         {
-            DYE_ASSERT_RELEASE(false && "Debug Gizmo's VAO or Shader have not been created, did you forget to call DebugDraw::initialize()?");
             return;
         }
 
-        renderBatchedLineVAO(camera);
+        // Align the vertex allocation to the stride, so the offset can be converted to the base vertex.
+        auto const vertexAllocation = s_StreamingBuffer->Allocate(numberOfVertices * sizeof(LineVertex), sizeof(LineVertex));
+        auto const indexAllocation = s_StreamingBuffer->Allocate(numberOfVertices * sizeof(std::uint32_t), sizeof(std::uint32_t));
+        if (!vertexAllocation.IsValid() || !indexAllocation.IsValid())
+        {
+            s_NumberOfDroppedPrimitivesThisFrame += numberOfVertices / 2;
+            DYE_LOG("DebugDraw streaming buffer is full, %u debug lines are skipped this frame.", numberOfVertices / 2);
+            return;
+        }
+
+        std::memcpy(vertexAllocation.pData, lineVertices.data(), numberOfVertices * sizeof(LineVertex));
+
+        // Every line has its own 2 vertices, therefore the indices are simply sequential (relative to the base vertex).
+        auto *pIndices = static_cast<std::uint32_t *>(indexAllocation.pData);
+        for (std::uint32_t i = 0; i < numberOfVertices; i++)
+        {
+            pIndices[i] = i;
+        }
+
+        s_BatchedLineRange = StreamedRange
+            {
+                .FirstIndex = indexAllocation.Offset / (std::uint32_t) sizeof(std::uint32_t),
+                .BaseVertex = (std::int32_t) (vertexAllocation.Offset / sizeof(LineVertex)),
+                .Count = numberOfVertices
+            };
+    }
 
-        s_GeometryGizmoShaderProgram->GetDefaultRenderState().Apply();
-        s_GeometryGizmoShaderProgram->Use();
+    void DebugDraw::streamGeometryInstances(std::vector<GeometryInstance> const &instances, StreamedRange &range)
+    {
+        auto const numberOfInstances = (std::uint32_t) instances.size();
+        if (numberOfInstances == 0)
+        {
+            return;
+        }
 
-        // View matrix
-        glm::mat4 viewMatrix = camera.ViewMatrix;
-        auto viewMatrixLoc = glGetUniformLocation(s_GeometryGizmoShaderProgram->GetID(), DefaultUniformNames::ViewMatrix);
-        glCall(glUniformMatrix4fv(viewMatrixLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix)));
+        auto const allocation = s_StreamingBuffer->Allocate(numberOfInstances * sizeof(GeometryInstance), sizeof(GeometryInstance));
+        if (!allocation.IsValid())
+        {
+            s_NumberOfDroppedPrimitivesThisFrame += numberOfInstances;
+            DYE_LOG("DebugDraw streaming buffer is full, %u debug geometry instances are skipped this frame.", numberOfInstances);
+            return;
+        }
 
-        // Projection matrix
-        float const aspectRatio = camera.Properties.GetAspectRatio();
-        glm::mat4 projectionMatrix = camera.Properties.GetProjectionMatrix(aspectRatio);
-        auto projectionMatrixLoc = glGetUniformLocation(s_GeometryGizmoShaderProgram->GetID(), DefaultUniformNames::ProjectionMatrix);
-        glCall(glUniformMatrix4fv(projectionMatrixLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix)));
+        std::memcpy(allocation.pData, instances.data(), numberOfInstances * sizeof(GeometryInstance));
 
-        renderTriangleGeometryVAO(*s_CubeVAO, s_CubeInstancedArrays);
-        renderLineGeometryVAO(*s_WireCubeVAO, s_WireCubeInstancedArrays);
-        renderLineGeometryVAO(*s_CircleVAO, s_CircleInstancedArrays);
+        range = StreamedRange
+            {
+                .BaseInstance = allocation.Offset / (std::uint32_t) sizeof(GeometryInstance),
+                .Count = numberOfInstances
+            };
     }
 
-    void DebugDraw::renderBatchedLineVAO(const Camera &camera)
+    void DebugDraw::renderDebugDrawOnCamera(Camera const &camera)
     {
-        if (s_BatchedLineVertices.empty() || s_BatchedLineIndices.empty())
+        if (!s_LineGizmoShaderProgram || !s_GeometryGizmoShaderProgram)
         {
+            DYE_ASSERT_RELEASE(false && "Debug Gizmo's VAO or Shader have not been created, did you forget to call DebugDraw::initialize()?");
             return;
         }
 
-        s_LineGizmoShaderProgram->GetDefaultRenderState().Apply();
-        s_LineGizmoShaderProgram->Use();
+        // The data is streamed once per frame, and shared by all the cameras.
+        if (!s_IsStreamedThisFrame)
+        {
+            streamDebugDrawData();
+        }
 
-        // View matrix
-        glm::mat4 viewMatrix = camera.ViewMatrix;
-        auto viewMatrixLoc = glGetUniformLocation(s_LineGizmoShaderProgram->GetID(), DefaultUniformNames::ViewMatrix);
-        glCall(glUniformMatrix4fv(viewMatrixLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix)));
+        renderBatchedLineVAO(camera);
 
-        // Projection matrix
-        float const aspectRatio = camera.Properties.GetAspectRatio();
-        glm::mat4 projectionMatrix = camera.Properties.GetProjectionMatrix(aspectRatio);
-        auto projectionMatrixLoc = glGetUniformLocation(s_LineGizmoShaderProgram->GetID(), DefaultUniformNames::ProjectionMatrix);
-        glCall(glUniformMatrix4fv(projectionMatrixLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix)));
+        RenderCommand &renderCommand = RenderCommand::GetInstance();
+        renderCommand.ApplyRenderState(s_GeometryGizmoShaderProgram->GetDefaultRenderState());
+        renderCommand.UseShaderProgram(*s_GeometryGizmoShaderProgram);
 
-        // Pass vertices & indices to VBO/EBO.
-        auto const vertexDataSize = s_BatchedLineVertices.size() * sizeof(float) * 7;  // pos + color = 3 floats + 4 floats = 7 floats
-        s_BatchedLineVAO->GetVertexBuffers()[0]->ResetData(s_BatchedLineVertices.data(), vertexDataSize, BufferUsageHint::StreamDraw);
-        s_BatchedLineVAO->GetIndexBuffer()->ResetData(s_BatchedLineIndices.data(), s_BatchedLineIndices.size(), BufferUsageHint::StreamDraw);
+        // View & projection matrix
+        renderCommand.SetCameraUniforms(*s_GeometryGizmoShaderProgram, camera);
 
-        RenderCommand::GetInstance().DrawIndexedLinesNow(*s_BatchedLineVAO);
+        renderGeometryVAO(*s_CubeVAO, s_CubeRange, PrimitiveType::Triangles);
+        renderGeometryVAO(*s_WireCubeVAO, s_WireCubeRange, PrimitiveType::Lines);
+        renderGeometryVAO(*s_CircleVAO, s_CircleRange, PrimitiveType::Lines);
     }
 
-    void DebugDraw::renderLineGeometryVAO(const VertexArray &vao, DebugDraw::GeometryInstancedArrays &instancedArrays)
+    void DebugDraw::renderBatchedLineVAO(const Camera &camera)
     {
-        if (instancedArrays.NumberOfInstances == 0)
+        if (s_BatchedLineRange.Count == 0)
         {
             return;
         }
 
-        // Set per instance data: Color & Model Matrix
-        auto const &perInstanceColorVBO = vao.GetVertexBuffers()[GeometryInstancedArrays::ColorVBOIndex];
-        perInstanceColorVBO->ResetData
-            (
-                instancedArrays.Colors.data(),
-                instancedArrays.Colors.size() * sizeof(float),
-                BufferUsageHint::StreamDraw
-            );
+        RenderCommand &renderCommand = RenderCommand::GetInstance();
+        renderCommand.ApplyRenderState(s_LineGizmoShaderProgram->GetDefaultRenderState());
+        renderCommand.UseShaderProgram(*s_LineGizmoShaderProgram);
 
-        auto const &perInstanceModelMatrixVBO = vao.GetVertexBuffers()[GeometryInstancedArrays::ModelMatrixVBOIndex];
-        perInstanceModelMatrixVBO->ResetData
+        // View & projection matrix
+        renderCommand.SetCameraUniforms(*s_LineGizmoShaderProgram, camera);
+
+        renderCommand.BindVertexArray(*s_BatchedLineVAO);
+        renderCommand.DrawIndexed
             (
-                instancedArrays.ModelMatrices.data(),
-                instancedArrays.ModelMatrices.size() * sizeof(float),
-                BufferUsageHint::StreamDraw
+                PrimitiveType::Lines,
+                s_BatchedLineRange.Count,
+                1,
+                DrawIndexedOffsets {.FirstIndex = s_BatchedLineRange.FirstIndex, .BaseVertex = s_BatchedLineRange.BaseVertex}
             );
-
-        RenderCommand::GetInstance().DrawIndexedLinesInstancedNow(vao, instancedArrays.NumberOfInstances);
     }
 
-    void DebugDraw::renderTriangleGeometryVAO(const VertexArray &vao, DebugDraw::GeometryInstancedArrays &instancedArrays)
+    void DebugDraw::renderGeometryVAO(VertexArray const &vao, StreamedRange const &range, PrimitiveType primitiveType)
     {
-        if (instancedArrays.NumberOfInstances == 0)
+        if (range.Count == 0)
         {
             return;
         }
 
-        // Set per instance data: Color & Model Matrix
-        auto const &perInstanceColorVBO = vao.GetVertexBuffers()[GeometryInstancedArrays::ColorVBOIndex];
-        perInstanceColorVBO->ResetData
+        RenderCommand &renderCommand = RenderCommand::GetInstance();
+        renderCommand.BindVertexArray(vao);
+        renderCommand.DrawIndexed
             (
-                instancedArrays.Colors.data(),
-                instancedArrays.Colors.size() * sizeof(float),
-                BufferUsageHint::StreamDraw
+                primitiveType,
+                vao.GetIndexBuffer()->GetCount(),
+                (int) range.Count,
+                DrawIndexedOffsets {.BaseInstance = range.BaseInstance}
             );
-
-        auto const &perInstanceModelMatrixVBO = vao.GetVertexBuffers()[GeometryInstancedArrays::ModelMatrixVBOIndex];
-        perInstanceModelMatrixVBO->ResetData
-            (
-                instancedArrays.ModelMatrices.data(),
-                instancedArrays.ModelMatrices.size() * sizeof(float),
-                BufferUsageHint::StreamDraw
-            );
-
-        RenderCommand::GetInstance().DrawIndexedInstancedNow(vao, instancedArrays.NumberOfInstances);
     }
 
     void DebugDraw::clearDebugDraw()
     {
-        s_BatchedLineVertices.clear();
-        s_BatchedLineIndices.clear();
+        if (s_IsStreamedThisFrame)
+        {
+            s_StreamingBuffer->EndFrame();
+            s_IsStreamedThisFrame = false;
+        }
 
-        s_CubeInstancedArrays.Clear();
-        s_WireCubeInstancedArrays.Clear();
-        s_CircleInstancedArrays.Clear();
+        s_FramePacketBuffers.Clear();
+
+        s_BatchedLineRange = {};
+        s_CubeRange = {};
+        s_WireCubeRange = {};
+        s_CircleRange = {};
     }
 
     void DebugDraw::Line(glm::vec3 start, glm::vec3 end, glm::vec4 color)
     {
-        std::uint32_t const startIndex = s_BatchedLineVertices.size() / 7;
-
-        s_BatchedLineVertices.insert(s_BatchedLineVertices.end(), glm::value_ptr(start), glm::value_ptr(start) + 3);
-        s_BatchedLineVertices.insert(s_BatchedLineVertices.end(), glm::value_ptr(color), glm::value_ptr(color) + 4);
-
-        s_BatchedLineVertices.insert(s_BatchedLineVertices.end(), glm::value_ptr(end), glm::value_ptr(end) + 3);
-        s_BatchedLineVertices.insert(s_BatchedLineVertices.end(), glm::value_ptr(color), glm::value_ptr(color) + 4);
+        [[maybe_unused]] RecordingDrawScope const recordingScope;
+        if (!tryConsumePrimitiveBudget(1))
+        {
+            return;
+        }
 
-        s_BatchedLineIndices.insert(s_BatchedLineIndices.end(), {startIndex, startIndex + 1});
+        ThreadBuffers &threadBuffers = getThreadBuffers();
+        threadBuffers.LineVertices.push_back(LineVertex {.Position = start, .Color = color});
+        threadBuffers.LineVertices.push_back(LineVertex {.Position = end, .Color = color});
     }
 
     void DebugDraw::Cube(glm::vec3 center, glm::vec3 size, glm::vec4 color)
     {
+        [[maybe_unused]] RecordingDrawScope const recordingScope;
+        if (!tryConsumePrimitiveBudget(1))
+        {
+            return;
+        }
+
         glm::mat4 modelMatrix = glm::mat4 {1.0f};
         modelMatrix = glm::translate(modelMatrix, center);
         modelMatrix = glm::scale(modelMatrix, size);
 
-        s_CubeInstancedArrays.AddInstance(color * 0.4f, modelMatrix);
-        s_WireCubeInstancedArrays.AddInstance(color, modelMatrix);
+        ThreadBuffers &threadBuffers = getThreadBuffers();
+        threadBuffers.CubeInstances.push_back(GeometryInstance {.Color = color * 0.4f, .ModelMatrix = modelMatrix});
+        threadBuffers.WireCubeInstances.push_back(GeometryInstance {.Color = color, .ModelMatrix = modelMatrix});
     }
 
     void DebugDraw::AABB(glm::vec3 min, glm::vec3 max, glm::vec4 color)
@@ -462,6 +543,12 @@ namespace DYE
 
     void DebugDraw::Circle(glm::vec3 center, float radius, glm::vec3 up, glm::vec4 color)
     {
+        [[maybe_unused]] RecordingDrawScope const recordingScope;
+        if (!tryConsumePrimitiveBudget(1))
+        {
+            return;
+        }
+
         float const scale = radius;
 
         glm::vec3 const defaultUp = glm::vec3 {0, 0, 1};
@@ -472,7 +559,7 @@ namespace DYE
         modelMatrix = modelMatrix * glm::toMat4(rotation);
         modelMatrix = glm::scale(modelMatrix, {scale, scale, scale});
 
-        s_CircleInstancedArrays.AddInstance(color, modelMatrix);
+        getThreadBuffers().CircleInstances.push_back(GeometryInstance {.Color = color, .ModelMatrix = modelMatrix});
     }
 
     void DebugDraw::Sphere(glm::vec3 center, float radius, glm::vec4 color)
@@ -1,21 +1,95 @@
 #include "Core/GUID.h"
 
+#include <mutex>
 #include <random>
 
 namespace DYE
 {
-    static std::random_device s_RandomDevice;
-    static std::mt19937_64 s_Engine(s_RandomDevice());
-    static std::uniform_int_distribution<std::uint64_t> s_UniformDistribution;
+    namespace
+    {
+        constexpr std::uint64_t SplitMix64Increment = 0x9e3779b97f4a7c15ull;
+
+        /// The output function of splitmix64, a bijection of 64-bit integers.
+        constexpr std::uint64_t mixSplitMix64(std::uint64_t state)
+        {
+            state = (state ^ (state >> 30)) * 0xbf58476d1ce4e5b9ull;
+            state = (state ^ (state >> 27)) * 0x94d049bb133111ebull;
+            return state ^ (state >> 31);
+        }
+
+        std::mutex s_DeterministicSeedMutex;
+        std::optional<std::uint64_t> s_DeterministicSeed;
+        std::uint64_t s_NumberOfDeterministicFactories = 0;
+
+        std::uint64_t generateDefaultSeed()
+        {
+            {
+                std::scoped_lock lock(s_DeterministicSeedMutex);
+                if (s_DeterministicSeed.has_value())
+                {
+                    // Mix the index so the factories don't produce overlapping sequences.
+                    return mixSplitMix64(s_DeterministicSeed.value() + (++s_NumberOfDeterministicFactories) * SplitMix64Increment);
+                }
+            }
+
+            std::random_device randomDevice;
+            return (static_cast<std::uint64_t>(randomDevice()) << 32) ^ static_cast<std::uint64_t>(randomDevice());
+        }
+    }
+
+    GUIDFactory::GUIDFactory() : m_State(generateDefaultSeed())
+    {
+    }
+
+    GUIDFactory::GUIDFactory(std::uint64_t seed) : m_State(seed)
+    {
+    }
+
+    GUIDFactory::GUIDFactory(GUIDFactory &&other) noexcept : m_State(other.m_State.load(std::memory_order_relaxed))
+    {
+    }
+
+    GUIDFactory &GUIDFactory::operator=(GUIDFactory &&other) noexcept
+    {
+        m_State.store(other.m_State.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    void GUIDFactory::SetSeed(std::uint64_t seed)
+    {
+        m_State.store(seed, std::memory_order_relaxed);
+    }
 
     GUID GUIDFactory::Generate()
     {
-        auto newGUID = s_UniformDistribution(s_Engine);
+        auto newGUID = mixSplitMix64(m_State.fetch_add(SplitMix64Increment, std::memory_order_relaxed) + SplitMix64Increment);
         if (newGUID == 0)
         {
-            // Regenerate once to lower the chance of it being 0.
-            newGUID = s_UniformDistribution(s_Engine);
+            // 0 is the invalid GUID, it is produced at most once per period.
+            newGUID = mixSplitMix64(m_State.fetch_add(SplitMix64Increment, std::memory_order_relaxed) + SplitMix64Increment);
         }
         return GUID(newGUID);
     }
+
+    void GUIDFactory::Generate(std::span<GUID> outGUIDs)
+    {
+        // Reserve the whole range of the counter at once, the GUIDs are then computed without touching the shared state.
+        std::uint64_t state = m_State.fetch_add(SplitMix64Increment * outGUIDs.size(), std::memory_order_relaxed);
+        for (GUID &guid: outGUIDs)
+        {
+            state += SplitMix64Increment;
+            guid.m_GUID = mixSplitMix64(state);
+            if (guid.m_GUID == 0)
+            {
+                guid = Generate();
+            }
+        }
+    }
+
+    void GUIDFactory::SetDeterministicSeed(std::optional<std::uint64_t> seed)
+    {
+        std::scoped_lock lock(s_DeterministicSeedMutex);
+        s_DeterministicSeed = seed;
+        s_NumberOfDeterministicFactories = 0;
+    }
 }
\ No newline at end of file
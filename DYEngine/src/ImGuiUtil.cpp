@@ -1261,6 +1261,23 @@ namespace DYE::ImGuiUtil
             isValueChanged |= isPropertyValueChanged;
         }
 
+        // Copy the keywords because toggling a keyword switches the material to another shader variant.
+        std::vector<std::string> const keywords = shader.GetKeywords();
+        for (auto const &keyword: keywords)
+        {
+            bool isKeywordEnabled = material.IsKeywordEnabled(keyword);
+            bool const isKeywordChanged = DrawBoolControl(keyword + uiId, isKeywordEnabled);
+            lastControlActivated |= ImGuiUtil::IsControlActivated();
+            lastControlDeactivated |= ImGuiUtil::IsControlDeactivated();
+            lastControlDeactivatedAfterEdit |= ImGuiUtil::IsControlDeactivatedAfterEdit();
+            if (isKeywordChanged)
+            {
+                isKeywordEnabled ? material.EnableKeyword(keyword) : material.DisableKeyword(keyword);
+            }
+
+            isValueChanged |= isKeywordChanged;
+        }
+
         s_Context.IsLastControlActivated = lastControlActivated;
         s_Context.IsLastControlDeactivated = lastControlDeactivated;
         s_Context.IsLastControlDeactivatedAfterEdit = lastControlDeactivatedAfterEdit;
@@ -28,17 +28,12 @@ namespace DYE
 
     void InputManager::HandleSystemEvent(Event &event)
     {
-        auto const eventType = event.GetEventType();
-        if (eventType == EventType::GamepadConnect)
+        if (DispatchEventAs<GamepadConnectEvent>(event, [this](GamepadConnectEvent const &connectEvent) { handleOnGamepadConnected(connectEvent); }))
         {
-            auto const &controllerEvent = static_cast<const GamepadConnectEvent &>(event);
-            handleOnGamepadConnected(controllerEvent);
-        }
-        else if (eventType == EventType::GamepadDisconnect)
-        {
-            auto const &controllerEvent = static_cast<const GamepadDisconnectEvent &>(event);
-            handleOnGamepadDisconnected(controllerEvent);
+            return;
         }
+
+        DispatchEventAs<GamepadDisconnectEvent>(event, [this](GamepadDisconnectEvent const &disconnectEvent) { handleOnGamepadDisconnected(disconnectEvent); });
     }
 
     void InputManager::ResetInputState()
@@ -54,9 +49,9 @@ namespace DYE
 
     void InputManager::UpdateInputState()
     {
-        // Buffer & update keyboard key states.
-        std::copy(m_KeyboardKeys.begin(), m_KeyboardKeys.end(), m_PreviousKeyboardKeys.begin());
+        bufferInputStates();
 
+        // Update keyboard key states.
         const Uint8 *states = SDL_GetKeyboardState(nullptr);
         auto const &firstKeyScanIndex = SDL_SCANCODE_A;
         for (int i = firstKeyScanIndex; i < NumberOfKeys; i++)
@@ -64,24 +59,17 @@ namespace DYE
             m_KeyboardKeys[i] = states[i];
         }
 
-        // Buffer & update mouse button states.
-        std::copy(m_MouseButtons.begin(), m_MouseButtons.end(), m_PreviousMouseButtons.begin());
-        m_PreviousMouseX = m_MouseX;
-        m_PreviousMouseY = m_MouseY;
-
+        // Update mouse button states.
         std::uint32_t const buttonState = SDL_GetGlobalMouseState(&m_MouseX, &m_MouseY);
         for (int i = 0; i < NumberOfMouseButtons; i++)
         {
             m_MouseButtons[i] = buttonState & SDL_BUTTON(i + 1);
         }
 
-        // Buffer & update gamepad states.
+        // Update gamepad states.
         for (int gamepadStateIndex = 0; gamepadStateIndex < m_NumberOfConnectedGamepads; gamepadStateIndex++)
         {
             GamepadState &gamepadState = m_GamepadStates[gamepadStateIndex];
-            std::copy(gamepadState.Buttons.begin(), gamepadState.Buttons.end(), gamepadState.PreviousButtons.begin());
-            std::copy(gamepadState.Axes.begin(), gamepadState.Axes.end(), gamepadState.PreviousAxes.begin());
-
             auto *pSDLGameController = static_cast<SDL_GameController *>(gamepadState.NativeGamepadObject);
             for (int i = 0; i < static_cast<int>(NumberOfGamepadButtons); i++)
             {
@@ -106,6 +94,22 @@ namespace DYE
         }
     }
 
+    void InputManager::bufferInputStates()
+    {
+        std::copy(m_KeyboardKeys.begin(), m_KeyboardKeys.end(), m_PreviousKeyboardKeys.begin());
+
+        std::copy(m_MouseButtons.begin(), m_MouseButtons.end(), m_PreviousMouseButtons.begin());
+        m_PreviousMouseX = m_MouseX;
+        m_PreviousMouseY = m_MouseY;
+
+        for (int gamepadStateIndex = 0; gamepadStateIndex < m_NumberOfConnectedGamepads; gamepadStateIndex++)
+        {
+            GamepadState &gamepadState = m_GamepadStates[gamepadStateIndex];
+            std::copy(gamepadState.Buttons.begin(), gamepadState.Buttons.end(), gamepadState.PreviousButtons.begin());
+            std::copy(gamepadState.Axes.begin(), gamepadState.Axes.end(), gamepadState.PreviousAxes.begin());
+        }
+    }
+
     bool InputManager::GetKey(KeyCode keyCode) const
     {
         auto const scanCode = SDL_GetScancodeFromKey(static_cast<SDL_KeyCode>(keyCode));
@@ -391,6 +395,46 @@ namespace DYE
         DYE_LOG("Gamepad Disconnected - %s, Gamepad Count = %d", m_RegisteredDeviceDescriptors[deviceId].ToString().c_str(), m_NumberOfConnectedGamepads);
     }
 
+    InputManager::ConnectedGamepads InputManager::captureConnectedGamepads() const
+    {
+        return ConnectedGamepads
+            {
+                .NumberOfConnectedGamepads = m_NumberOfConnectedGamepads,
+                .GamepadStates = m_GamepadStates,
+                .GamepadStateIndices = m_GamepadStateIndices
+            };
+    }
+
+    void InputManager::restoreConnectedGamepads(ConnectedGamepads const &gamepads)
+    {
+        m_NumberOfConnectedGamepads = 0;
+        for (int i = 0; i < gamepads.NumberOfConnectedGamepads; i++)
+        {
+            GamepadState gamepadState = gamepads.GamepadStates[i];
+            auto *pSDLGameController = static_cast<SDL_GameController *>(gamepadState.NativeGamepadObject);
+            if (pSDLGameController == nullptr)
+            {
+                continue;
+            }
+
+            if (!SDL_GameControllerGetAttached(pSDLGameController))
+            {
+                // The gamepad has been unplugged while it was not in the connected set,
+                // its disconnect event couldn't free the controller object therefore we free it here.
+                SDL_GameControllerClose(pSDLGameController);
+                continue;
+            }
+
+            // The button states are outdated, reset them so they don't trigger any button down/up.
+            gamepadState.Reset();
+
+            int const denseArrayIndex = m_NumberOfConnectedGamepads;
+            m_GamepadStates[denseArrayIndex] = gamepadState;
+            m_GamepadStateIndices[gamepadState.DeviceID] = denseArrayIndex;
+            m_NumberOfConnectedGamepads++;
+        }
+    }
+
     InputManager::GamepadState const *InputManager::getGamepadState(DeviceID deviceId) const
     {
         int const denseArrayIndex = m_GamepadStateIndices[deviceId];
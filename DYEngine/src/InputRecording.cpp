@@ -0,0 +1,330 @@
+#include "Input/InputRecording.h"
+
+#include "Input/InputManager.h"
+#include "Core/Time.h"
+#include "Util/Macro.h"
+
+#include <cmath>
+#include <array>
+#include <algorithm>
+
+namespace DYE
+{
+    namespace
+    {
+        constexpr int NumberOfKeyBitBytes = (NumberOfKeys + 7) / 8;
+
+        struct RecordedGamepadState
+        {
+            DeviceID DeviceID = 0;
+            std::uint16_t ButtonBits = 0;
+            std::array<std::int16_t, NumberOfGamepadAxes> Axes = {0};
+        };
+
+        template<typename T>
+        void writeValue(std::ofstream &stream, T const &value)
+        {
+            stream.write(reinterpret_cast<char const *>(&value), sizeof(T));
+        }
+
+        template<typename T>
+        bool readValue(std::ifstream &stream, T &value)
+        {
+            stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+            return stream.gcount() == sizeof(T);
+        }
+    }
+
+    bool InputRecorder::Open(std::filesystem::path const &path, Time const &time, std::uint64_t guidSeed)
+    {
+        Close();
+
+        m_Stream.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_Stream.is_open())
+        {
+            DYE_LOG_ERROR("InputRecorder::Open: Failed to open '%s' for writing.", path.string().c_str());
+            return false;
+        }
+
+        InputRecordingHeader const header
+            {
+                .NumberOfKeys = NumberOfKeys,
+                .NumberOfMouseButtons = NumberOfMouseButtons,
+                .NumberOfGamepadButtons = NumberOfGamepadButtons,
+                .NumberOfGamepadAxes = NumberOfGamepadAxes,
+                .FixedFramePerSecond = time.m_FixedFramePerSecond,
+                .GUIDSeed = guidSeed
+            };
+        writeValue(m_Stream, header);
+
+        m_NumberOfRecordedFrames = 0;
+        DYE_LOG("Start recording input to '%s'.", path.string().c_str());
+        return true;
+    }
+
+    void InputRecorder::Close()
+    {
+        if (!m_Stream.is_open())
+        {
+            return;
+        }
+
+        m_Stream.close();
+        DYE_LOG("Stop recording input, %d frames recorded.", m_NumberOfRecordedFrames);
+    }
+
+    void InputRecorder::RecordFrame(InputManager const &inputManager, Time const &time)
+    {
+        if (!m_Stream.is_open())
+        {
+            return;
+        }
+
+        writeValue(m_Stream, time.m_DeltaTicks);
+
+        std::array<std::uint8_t, NumberOfKeyBitBytes> keyBits = {0};
+        for (int i = 0; i < NumberOfKeys; i++)
+        {
+            if (inputManager.m_KeyboardKeys[i])
+            {
+                keyBits[i / 8] |= static_cast<std::uint8_t>(1 << (i % 8));
+            }
+        }
+        writeValue(m_Stream, keyBits);
+
+        writeValue(m_Stream, inputManager.m_MouseX);
+        writeValue(m_Stream, inputManager.m_MouseY);
+
+        std::uint8_t mouseButtonBits = 0;
+        for (int i = 0; i < NumberOfMouseButtons; i++)
+        {
+            if (inputManager.m_MouseButtons[i])
+            {
+                mouseButtonBits |= static_cast<std::uint8_t>(1 << i);
+            }
+        }
+        writeValue(m_Stream, mouseButtonBits);
+
+        auto const numberOfGamepads = static_cast<std::uint8_t>(inputManager.m_NumberOfConnectedGamepads);
+        writeValue(m_Stream, numberOfGamepads);
+        for (int gamepadStateIndex = 0; gamepadStateIndex < numberOfGamepads; gamepadStateIndex++)
+        {
+            auto const &gamepadState = inputManager.m_GamepadStates[gamepadStateIndex];
+
+            RecordedGamepadState recordedState {.DeviceID = gamepadState.DeviceID};
+            for (int i = 0; i < NumberOfGamepadButtons; i++)
+            {
+                if (gamepadState.Buttons[i])
+                {
+                    recordedState.ButtonBits |= static_cast<std::uint16_t>(1 << i);
+                }
+            }
+
+            for (int i = 0; i < NumberOfGamepadAxes; i++)
+            {
+                // Axes are polled as (raw / 32767), quantizing them back to the raw range is lossless.
+                recordedState.Axes[i] = static_cast<std::int16_t>(std::lround(gamepadState.Axes[i] * 32767.f));
+            }
+
+            writeValue(m_Stream, recordedState.DeviceID);
+            writeValue(m_Stream, recordedState.ButtonBits);
+            writeValue(m_Stream, recordedState.Axes);
+        }
+
+        m_NumberOfRecordedFrames++;
+    }
+
+    bool InputReplayer::Open(std::filesystem::path const &path, InputManager &inputManager)
+    {
+        Close();
+
+        m_Stream.open(path, std::ios::binary);
+        if (!m_Stream.is_open())
+        {
+            DYE_LOG_ERROR("InputReplayer::Open: Failed to open '%s' for reading.", path.string().c_str());
+            return false;
+        }
+
+        InputRecordingHeader header;
+        bool const isHeaderValid = readValue(m_Stream, header) &&
+                                   header.FileSignature == InputRecordingHeader::Signature &&
+                                   header.Version == InputRecordingHeader::CurrentVersion &&
+                                   header.NumberOfKeys == NumberOfKeys &&
+                                   header.NumberOfMouseButtons == NumberOfMouseButtons &&
+                                   header.NumberOfGamepadButtons == NumberOfGamepadButtons &&
+                                   header.NumberOfGamepadAxes == NumberOfGamepadAxes;
+        if (!isHeaderValid)
+        {
+            DYE_LOG_ERROR("InputReplayer::Open: '%s' is not a compatible input recording.", path.string().c_str());
+            m_Stream.close();
+            return false;
+        }
+
+        m_FixedFramePerSecond = header.FixedFramePerSecond;
+        m_GUIDSeed = header.GUIDSeed;
+        m_NumberOfReplayedFrames = 0;
+
+        m_pInputManager = &inputManager;
+        m_LiveGamepads = inputManager.captureConnectedGamepads();
+        DYE_LOG("Start replaying input from '%s'.", path.string().c_str());
+        return true;
+    }
+
+    void InputReplayer::Close()
+    {
+        if (!m_Stream.is_open())
+        {
+            return;
+        }
+
+        m_Stream.close();
+
+        if (m_pInputManager != nullptr)
+        {
+            putPluggedInGamepadsAside(*m_pInputManager);
+            m_pInputManager->restoreConnectedGamepads(m_LiveGamepads);
+            m_pInputManager = nullptr;
+        }
+
+        DYE_LOG("Stop replaying input, %d frames replayed.", m_NumberOfReplayedFrames);
+    }
+
+    bool InputReplayer::ReplayNextFrame(InputManager &inputManager, Time &time)
+    {
+        if (!m_Stream.is_open())
+        {
+            return false;
+        }
+
+        // Read the whole frame first so a truncated frame at the end of the stream doesn't get partially applied.
+        std::uint32_t deltaTicks = 0;
+        std::array<std::uint8_t, NumberOfKeyBitBytes> keyBits = {0};
+        std::int32_t mouseX = 0, mouseY = 0;
+        std::uint8_t mouseButtonBits = 0;
+        std::uint8_t numberOfGamepads = 0;
+        std::array<RecordedGamepadState, InputManager::MaxNumberOfUniqueGamepads> recordedGamepadStates;
+
+        bool isFrameValid = readValue(m_Stream, deltaTicks) &&
+                            readValue(m_Stream, keyBits) &&
+                            readValue(m_Stream, mouseX) &&
+                            readValue(m_Stream, mouseY) &&
+                            readValue(m_Stream, mouseButtonBits) &&
+                            readValue(m_Stream, numberOfGamepads) &&
+                            numberOfGamepads <= InputManager::MaxNumberOfUniqueGamepads;
+
+        for (int i = 0; isFrameValid && i < numberOfGamepads; i++)
+        {
+            auto &recordedState = recordedGamepadStates[i];
+            isFrameValid = readValue(m_Stream, recordedState.DeviceID) &&
+                           readValue(m_Stream, recordedState.ButtonBits) &&
+                           readValue(m_Stream, recordedState.Axes) &&
+                           recordedState.DeviceID >= 0 && recordedState.DeviceID < InputManager::MaxNumberOfUniqueGamepads;
+        }
+
+        if (!isFrameValid)
+        {
+            return false;
+        }
+
+        time.m_FixedFramePerSecond = m_FixedFramePerSecond;
+        time.overrideDeltaTicks(deltaTicks);
+
+        inputManager.bufferInputStates();
+
+        for (int i = 0; i < NumberOfKeys; i++)
+        {
+            inputManager.m_KeyboardKeys[i] = keyBits[i / 8] & (1 << (i % 8));
+        }
+
+        inputManager.m_MouseX = mouseX;
+        inputManager.m_MouseY = mouseY;
+        for (int i = 0; i < NumberOfMouseButtons; i++)
+        {
+            inputManager.m_MouseButtons[i] = mouseButtonBits & (1 << i);
+        }
+
+        putPluggedInGamepadsAside(inputManager);
+
+        // Rebuild the connected gamepad sparse set from the recorded devices.
+        // The states of devices that were connected last frame are carried over so that button down/up queries still work.
+        auto const previousGamepadStates = inputManager.m_GamepadStates;
+        int const previousNumberOfConnectedGamepads = inputManager.m_NumberOfConnectedGamepads;
+
+        inputManager.m_NumberOfConnectedGamepads = numberOfGamepads;
+        for (int denseArrayIndex = 0; denseArrayIndex < numberOfGamepads; denseArrayIndex++)
+        {
+            auto const &recordedState = recordedGamepadStates[denseArrayIndex];
+            auto &gamepadState = inputManager.m_GamepadStates[denseArrayIndex];
+
+            gamepadState.DeviceID = recordedState.DeviceID;
+            gamepadState.Reset();
+            for (int i = 0; i < previousNumberOfConnectedGamepads; i++)
+            {
+                if (previousGamepadStates[i].DeviceID == recordedState.DeviceID)
+                {
+                    gamepadState = previousGamepadStates[i];
+                    break;
+                }
+            }
+
+            // A replayed gamepad is never polled, the native objects stay with the live gamepads.
+            gamepadState.NativeGamepadObject = nullptr;
+
+            for (int i = 0; i < NumberOfGamepadButtons; i++)
+            {
+                gamepadState.Buttons[i] = recordedState.ButtonBits & (1 << i);
+            }
+
+            for (int i = 0; i < NumberOfGamepadAxes; i++)
+            {
+                gamepadState.Axes[i] = std::clamp(recordedState.Axes[i] / 32767.f, -1.f, 1.f);
+            }
+
+            inputManager.m_GamepadStateIndices[recordedState.DeviceID] = denseArrayIndex;
+        }
+
+        m_NumberOfReplayedFrames++;
+        return true;
+    }
+
+    void InputReplayer::putPluggedInGamepadsAside(InputManager &inputManager)
+    {
+        // The replayed gamepads have no native object, the ones that have are added by InputManager when they are plugged in.
+        for (int i = 0; i < inputManager.m_NumberOfConnectedGamepads; i++)
+        {
+            auto const &gamepadState = inputManager.m_GamepadStates[i];
+            if (gamepadState.NativeGamepadObject == nullptr)
+            {
+                continue;
+            }
+
+            int liveDenseArrayIndex = -1;
+            for (int liveIndex = 0; liveIndex < m_LiveGamepads.NumberOfConnectedGamepads; liveIndex++)
+            {
+                if (m_LiveGamepads.GamepadStates[liveIndex].DeviceID == gamepadState.DeviceID)
+                {
+                    liveDenseArrayIndex = liveIndex;
+                    break;
+                }
+            }
+
+            if (liveDenseArrayIndex == -1)
+            {
+                liveDenseArrayIndex = m_LiveGamepads.NumberOfConnectedGamepads;
+                m_LiveGamepads.GamepadStateIndices[gamepadState.DeviceID] = liveDenseArrayIndex;
+                m_LiveGamepads.NumberOfConnectedGamepads++;
+            }
+            else
+            {
+                // The device has been re-plugged, free the controller object of the previous connection.
+                auto *pPreviousSDLGameController = static_cast<SDL_GameController *>(m_LiveGamepads.GamepadStates[liveDenseArrayIndex].NativeGamepadObject);
+                if (pPreviousSDLGameController != nullptr && pPreviousSDLGameController != gamepadState.NativeGamepadObject)
+                {
+                    SDL_GameControllerClose(pPreviousSDLGameController);
+                }
+            }
+
+            m_LiveGamepads.GamepadStates[liveDenseArrayIndex] = gamepadState;
+        }
+    }
+}
@@ -2,6 +2,7 @@
 
 #include "Graphics/OpenGL.h"
 #include "Graphics/Shader.h"
+#include "Graphics/RenderCommand.h"
 #include "Graphics/Texture.h"
 
 #include <utility>
@@ -14,6 +15,9 @@ namespace DYE
     {
         DYE_LOG("<< Start creating material \"%s\" from shader \"%s\" >>", name.c_str(), shader->GetName().c_str());
 
+        // The uniforms of a program are only known once its compilation has finished, otherwise the material would end up with no property.
+        DYE_ASSERT_RELEASE(shader->IsReady() && "The shader of a material must be compiled in blocking mode (or have finished the async compilation).");
+
         auto material = std::make_shared<Material>(name, shader);
         for (const auto &propertyInfo: shader->GetAllPropertyInfo())
         {
@@ -65,6 +69,48 @@ namespace DYE
     {
     }
 
+    ShaderProgram &Material::GetShaderProgram() const
+    {
+        ShaderProgram &variant = m_Shader->GetVariant(m_EnabledKeywordMask);
+        if (variant.IsReady())
+        {
+            return variant;
+        }
+
+        // The variant is still being compiled, render with the base program (or the fallback if the base is not ready either).
+        return m_Shader->IsReady() ? *m_Shader : ShaderProgram::GetFallbackShaderProgram();
+    }
+
+    bool Material::EnableKeyword(const std::string &keyword)
+    {
+        std::optional<std::uint32_t> const keywordIndex = m_Shader->TryGetKeywordIndex(keyword);
+        if (!keywordIndex.has_value())
+        {
+            return false;
+        }
+
+        m_EnabledKeywordMask |= (1u << keywordIndex.value());
+        return true;
+    }
+
+    bool Material::DisableKeyword(const std::string &keyword)
+    {
+        std::optional<std::uint32_t> const keywordIndex = m_Shader->TryGetKeywordIndex(keyword);
+        if (!keywordIndex.has_value())
+        {
+            return false;
+        }
+
+        m_EnabledKeywordMask &= ~(1u << keywordIndex.value());
+        return true;
+    }
+
+    bool Material::IsKeywordEnabled(const std::string &keyword) const
+    {
+        std::optional<std::uint32_t> const keywordIndex = m_Shader->TryGetKeywordIndex(keyword);
+        return keywordIndex.has_value() && (m_EnabledKeywordMask & (1u << keywordIndex.value())) != 0;
+    }
+
     float Material::GetFloat(const std::string &name) const
     {
         auto const &propertiesOfType = m_FloatProperties;
@@ -257,115 +303,116 @@ namespace DYE
         result->second = texture;
     }
 
-    void Material::updateUniformValuesToGPU() const
+    void Material::updateUniformValuesToGPU(RenderCommand &renderCommand) const
     {
+        // The uniforms are looked up by name because the locations might be different in each variant of the shader.
         ShaderProgram const &shaderProgram = GetShaderProgram();
 
         for (auto const &propertyPair: m_FloatProperties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            UniformLocation const location = uniformInfo.Location;
-            glCall(glUniform1fv(location, 1, &propertyPair.second));
+            UniformLocation const location = uniformInfo->Location;
+            renderCommand.SetUniformFloat(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Float2Properties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            UniformLocation const location = uniformInfo.Location;
-            glCall(glUniform2fv(location, 1, glm::value_ptr(propertyPair.second)));
+            UniformLocation const location = uniformInfo->Location;
+            renderCommand.SetUniformFloat2(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Float3Properties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            UniformLocation const location = uniformInfo.Location;
-            glCall(glUniform3fv(location, 1, glm::value_ptr(propertyPair.second)));
+            UniformLocation const location = uniformInfo->Location;
+            renderCommand.SetUniformFloat3(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Float4Properties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            UniformLocation const location = uniformInfo.Location;
-            glCall(glUniform4fv(location, 1, glm::value_ptr(propertyPair.second)));
+            UniformLocation const location = uniformInfo->Location;
+            renderCommand.SetUniformFloat4(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Mat3Properties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            UniformLocation const location = uniformInfo.Location;
-            glCall(glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(propertyPair.second)));
+            UniformLocation const location = uniformInfo->Location;
+            renderCommand.SetUniformMat3(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Mat4Properties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            UniformLocation const location = uniformInfo.Location;
-            glCall(glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(propertyPair.second)));
+            UniformLocation const location = uniformInfo->Location;
+            renderCommand.SetUniformMat4(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_IntProperties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            UniformLocation const location = uniformInfo.Location;
-            glCall(glUniform1iv(location, 1, &propertyPair.second));
+            UniformLocation const location = uniformInfo->Location;
+            renderCommand.SetUniformInt(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_BoolProperties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            UniformLocation const location = uniformInfo.Location;
-            glCall(glUniform1iv(location, 1, &propertyPair.second));
+            UniformLocation const location = uniformInfo->Location;
+            renderCommand.SetUniformInt(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_TextureProperties)
         {
-            UniformInfo const &uniformInfo = propertyPair.first;
-            if (!shaderProgram.HasUniform(uniformInfo.Name))
+            auto const uniformInfo = shaderProgram.TryGetUniformInfo(propertyPair.first.Name);
+            if (!uniformInfo.has_value())
             {
                 continue;
             }
 
-            propertyPair.second->Bind(uniformInfo.TextureUnitSlotIfTexture);
+            renderCommand.BindTexture(*propertyPair.second, uniformInfo->TextureUnitSlotIfTexture);
         }
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Graphics/OpenGL.h"
 #include "Graphics/Shader.h"
+#include "Graphics/RenderCommand.h"
 #include "Graphics/Texture.h"
 
 #include <algorithm>
@@ -202,7 +203,14 @@ namespace DYE
         result->second = texture;
     }
 
-    void MaterialPropertyBlock::updatePropertyValuesToGPU(ShaderProgram const &shaderProgram) const
+    bool MaterialPropertyBlock::IsEmpty() const
+    {
+        return m_FloatProperties.empty() && m_Float2Properties.empty() && m_Float3Properties.empty() && m_Float4Properties.empty() &&
+               m_Mat3Properties.empty() && m_Mat4Properties.empty() && m_IntProperties.empty() && m_BoolProperties.empty() &&
+               m_TextureProperties.empty();
+    }
+
+    void MaterialPropertyBlock::updatePropertyValuesToGPU(RenderCommand &renderCommand, ShaderProgram const &shaderProgram) const
     {
         for (auto const &propertyPair: m_FloatProperties)
         {
@@ -213,7 +221,7 @@ namespace DYE
             }
 
             UniformLocation const location = uniformInfo.value().Location;
-            glCall(glUniform1fv(location, 1, &propertyPair.second));
+            renderCommand.SetUniformFloat(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Float2Properties)
@@ -225,7 +233,7 @@ namespace DYE
             }
 
             UniformLocation const location = uniformInfo.value().Location;
-            glCall(glUniform2fv(location, 1, glm::value_ptr(propertyPair.second)));
+            renderCommand.SetUniformFloat2(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Float3Properties)
@@ -237,7 +245,7 @@ namespace DYE
             }
 
             UniformLocation const location = uniformInfo.value().Location;
-            glCall(glUniform3fv(location, 1, glm::value_ptr(propertyPair.second)));
+            renderCommand.SetUniformFloat3(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Float4Properties)
@@ -249,7 +257,7 @@ namespace DYE
             }
 
             UniformLocation const location = uniformInfo.value().Location;
-            glCall(glUniform4fv(location, 1, glm::value_ptr(propertyPair.second)));
+            renderCommand.SetUniformFloat4(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Mat3Properties)
@@ -261,7 +269,7 @@ namespace DYE
             }
 
             UniformLocation const location = uniformInfo.value().Location;
-            glCall(glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(propertyPair.second)));
+            renderCommand.SetUniformMat3(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_Mat4Properties)
@@ -273,7 +281,7 @@ namespace DYE
             }
 
             UniformLocation const location = uniformInfo.value().Location;
-            glCall(glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(propertyPair.second)));
+            renderCommand.SetUniformMat4(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_IntProperties)
@@ -285,7 +293,7 @@ namespace DYE
             }
 
             UniformLocation const location = uniformInfo.value().Location;
-            glCall(glUniform1iv(location, 1, &propertyPair.second));
+            renderCommand.SetUniformInt(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_BoolProperties)
@@ -297,7 +305,7 @@ namespace DYE
             }
 
             UniformLocation const location = uniformInfo.value().Location;
-            glCall(glUniform1iv(location, 1, &propertyPair.second));
+            renderCommand.SetUniformInt(location, propertyPair.second);
         }
 
         for (auto const &propertyPair: m_TextureProperties)
@@ -308,7 +316,7 @@ namespace DYE
                 continue;
             }
 
-            propertyPair.second->Bind(uniformInfo.value().TextureUnitSlotIfTexture);
+            renderCommand.BindTexture(*propertyPair.second, uniformInfo.value().TextureUnitSlotIfTexture);
         }
     }
 }
\ No newline at end of file
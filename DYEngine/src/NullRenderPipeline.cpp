@@ -0,0 +1,37 @@
+#include "Graphics/NullRenderPipeline.h"
+
+#include <algorithm>
+
+namespace DYE
+{
+    void NullRenderPipeline::Submit(const std::shared_ptr<VertexArray> &vertexArray, const std::shared_ptr<Material> &material,
+                                    glm::mat4 objectToWorldMatrix, MaterialPropertyBlock materialPropertyBlock)
+    {
+        m_NumberOfSubmissionsThisFrame++;
+    }
+
+    void NullRenderPipeline::onCaptureFramePacket()
+    {
+        m_NumberOfSubmissionsInFramePacket = m_NumberOfSubmissionsThisFrame;
+        m_NumberOfSubmissionsThisFrame = 0;
+    }
+
+    void NullRenderPipeline::onPreRender()
+    {
+    }
+
+    void NullRenderPipeline::renderCamera(const Camera &camera)
+    {
+        m_Statistics.NumberOfRenderedCameras++;
+    }
+
+    void NullRenderPipeline::onPostRender()
+    {
+        m_Statistics.NumberOfFrames++;
+        m_Statistics.NumberOfSubmissions += m_NumberOfSubmissionsInFramePacket;
+        m_Statistics.MaxNumberOfSubmissionsPerFrame = std::max(m_Statistics.MaxNumberOfSubmissionsPerFrame, m_NumberOfSubmissionsInFramePacket);
+
+        m_NumberOfSubmissionsLastFrame = m_NumberOfSubmissionsInFramePacket;
+        m_NumberOfSubmissionsInFramePacket = 0;
+    }
+}
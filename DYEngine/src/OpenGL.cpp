@@ -4,6 +4,12 @@ namespace DYE
 {
     std::string g_glErrorMessage;
 
+    bool IsOpenGLLoaded()
+    {
+        // GLVersion is filled in by glad when the function pointers are loaded.
+        return GLVersion.major > 0;
+    }
+
     std::string glGetErrorMessage()
     {
         return g_glErrorMessage;
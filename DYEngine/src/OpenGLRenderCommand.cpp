@@ -0,0 +1,194 @@
+#include "Graphics/OpenGLRenderCommand.h"
+
+#include "Util/Logger.h"
+#include "Graphics/OpenGL.h"
+#include "Graphics/VertexArray.h"
+#include "Graphics/Shader.h"
+#include "Graphics/Texture.h"
+#include "Graphics/WindowBase.h"
+
+#include <SDL.h>
+#include <glad/glad.h>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cstdint>
+
+namespace DYE
+{
+#ifdef DYE_OPENGL_DEBUG
+    static void APIENTRY openglCallbackFunction
+        (
+            GLenum source,
+            GLenum type,
+            GLuint id,
+            GLenum severity,
+            GLsizei length,
+            const GLchar *message,
+            const void *userParam
+        )
+    {
+        (void) source;
+        (void) type;
+        (void) id;
+        (void) severity;
+        (void) length;
+        (void) userParam;
+
+        switch (severity)
+        {
+            case GL_DEBUG_SEVERITY_HIGH:
+                DYE_LOG_ERROR("[OpenGL Debug HIGH] %s", message);
+                DYE_ASSERT(false);
+                break;
+            case GL_DEBUG_SEVERITY_MEDIUM:
+                DYE_LOG_WARN("[OpenGL Debug MED] %s", message);
+                break;
+            case GL_DEBUG_SEVERITY_LOW:
+                //DYE_LOG_INFO("[OpenGL Debug LOW] %s", message);
+                break;
+        }
+    }
+#endif
+
+    OpenGLRenderCommand::OpenGLRenderCommand()
+    {
+#ifdef DYE_OPENGL_DEBUG
+        // Enable the debug callback
+        glEnable(GL_DEBUG_OUTPUT);
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        glDebugMessageCallback(openglCallbackFunction, nullptr);
+        glDebugMessageControl(
+            GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, true
+        );
+#endif
+    }
+
+    glm::vec<2, std::uint32_t> OpenGLRenderCommand::GetMaxFramebufferSize() const
+    {
+        std::int32_t width, height;
+        glGetIntegerv(GL_MAX_FRAMEBUFFER_WIDTH, &width);
+        glGetIntegerv(GL_MAX_FRAMEBUFFER_HEIGHT, &height);
+        return {width, height};
+    }
+
+    void OpenGLRenderCommand::SwapWindowBuffer(WindowBase const &windowBase)
+    {
+        SDL_GL_SwapWindow(windowBase.GetTypedNativeWindowPtr<SDL_Window>());
+    }
+
+    void OpenGLRenderCommand::SetViewport(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height)
+    {
+        glViewport(x, y, width, height);
+        glScissor(x, y, width, height);
+    }
+
+    void OpenGLRenderCommand::SetClearColor(const glm::vec4 &color)
+    {
+        glClearColor(color.r, color.g, color.b, color.a);
+    }
+
+    void OpenGLRenderCommand::SetLinePrimitiveWidth(float width)
+    {
+        glLineWidth(width);
+    }
+
+    void OpenGLRenderCommand::Clear()
+    {
+        // Enable depth mask first so glClear() call actually clears depth buffer.
+        glCall(glDepthMask(GL_TRUE));
+        glCall(glEnable(GL_SCISSOR_TEST));
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    }
+
+    void OpenGLRenderCommand::ClearDepthStencilOnly()
+    {
+        // Enable depth mask first so glClear() call actually clears depth buffer.
+        glCall(glDepthMask(GL_TRUE));
+        glCall(glEnable(GL_SCISSOR_TEST));
+        glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    }
+
+    void OpenGLRenderCommand::applyRenderState(RenderState renderState)
+    {
+        renderState.Apply();
+    }
+
+    void OpenGLRenderCommand::useShaderProgram(ShaderProgram const &shaderProgram)
+    {
+        shaderProgram.Use();
+    }
+
+    void OpenGLRenderCommand::SetUniformFloat(UniformLocation location, float value)
+    {
+        glCall(glUniform1fv(location, 1, &value));
+    }
+
+    void OpenGLRenderCommand::SetUniformFloat2(UniformLocation location, glm::vec2 const &value)
+    {
+        glCall(glUniform2fv(location, 1, glm::value_ptr(value)));
+    }
+
+    void OpenGLRenderCommand::SetUniformFloat3(UniformLocation location, glm::vec3 const &value)
+    {
+        glCall(glUniform3fv(location, 1, glm::value_ptr(value)));
+    }
+
+    void OpenGLRenderCommand::SetUniformFloat4(UniformLocation location, glm::vec4 const &value)
+    {
+        glCall(glUniform4fv(location, 1, glm::value_ptr(value)));
+    }
+
+    void OpenGLRenderCommand::SetUniformMat3(UniformLocation location, glm::mat3 const &value)
+    {
+        glCall(glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value)));
+    }
+
+    void OpenGLRenderCommand::SetUniformMat4(UniformLocation location, glm::mat4 const &value)
+    {
+        glCall(glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value)));
+    }
+
+    void OpenGLRenderCommand::SetUniformInt(UniformLocation location, std::int32_t value)
+    {
+        glCall(glUniform1iv(location, 1, &value));
+    }
+
+    void OpenGLRenderCommand::bindTexture(Texture &texture, std::uint32_t textureUnitSlot)
+    {
+        texture.Bind(textureUnitSlot);
+    }
+
+    void OpenGLRenderCommand::bindVertexArray(VertexArray const &vertexArray)
+    {
+        vertexArray.Bind();
+    }
+
+    void OpenGLRenderCommand::ResetVertexBufferData(VertexBuffer &vertexBuffer, const void *data, std::uint32_t size, BufferUsageHint usage)
+    {
+        vertexBuffer.ResetData(data, size, usage);
+    }
+
+    void OpenGLRenderCommand::ResetIndexBufferData(IndexBuffer &indexBuffer, std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage)
+    {
+        indexBuffer.ResetData(indices, count, usage);
+    }
+
+    void OpenGLRenderCommand::DrawIndexed(PrimitiveType primitiveType, std::uint32_t indexCount, int numberOfInstances, DrawIndexedOffsets const &offsets)
+    {
+        GLenum const mode = primitiveType == PrimitiveType::Lines ? GL_LINES : GL_TRIANGLES;
+        bool const hasOffsets = offsets.FirstIndex != 0 || offsets.BaseVertex != 0 || offsets.BaseInstance != 0;
+        if (hasOffsets)
+        {
+            void const *pFirstIndex = (void const *) ((std::uintptr_t) offsets.FirstIndex * sizeof(std::uint32_t));
+            glCall(glDrawElementsInstancedBaseVertexBaseInstance(mode, indexCount, GL_UNSIGNED_INT, pFirstIndex, numberOfInstances, offsets.BaseVertex, offsets.BaseInstance));
+        }
+        else if (numberOfInstances != 1)
+        {
+            glCall(glDrawElementsInstanced(mode, indexCount, GL_UNSIGNED_INT, nullptr, numberOfInstances));
+        }
+        else
+        {
+            glCall(glDrawElements(mode, indexCount, GL_UNSIGNED_INT, nullptr));
+        }
+    }
+}
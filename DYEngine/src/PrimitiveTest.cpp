@@ -246,6 +246,11 @@ namespace DYE::Math
     }
 
     bool MovingCircleAABBIntersect(glm::vec2 center, float radius, glm::vec2 direction, const AABB &aabb, DynamicTestResult2D &testResult)
+    {
+        return MovingCircleAABBIntersect(center, radius, direction, 1.0f, aabb, testResult);
+    }
+
+    bool MovingCircleAABBIntersect(glm::vec2 center, float radius, glm::vec2 direction, float maxTime, const AABB &aabb, DynamicTestResult2D &testResult)
     {
         testResult.HitNormal = -glm::normalize(direction); // Set normal to the opposite of moving direction by default.
 
@@ -257,10 +262,9 @@ namespace DYE::Math
         expandedAABB.Max.y += radius;
 
         // Do a ray & expanded AABB intersect test.
-        if (!RayAABBIntersect2D(center, direction, expandedAABB, testResult) || testResult.HitTime > 1.0f)
+        // The ray fails the test if it intersects but at a point where it's farther than maxTime.
+        if (!RayAABBIntersect2D(center, direction, maxTime, expandedAABB, testResult))
         {
-            // The ray doesn't intersect with the expanded AABB
-            // OR it intersects but at a point where it's farther than direction vector.
             return false;
         }
 
@@ -304,10 +308,15 @@ namespace DYE::Math
 
         bool const rayExpandedCircleIntersect = RayCircleIntersect(center, direction, corner, radius, testResult);
         testResult.HitPoint = testResult.HitCentroid - testResult.HitNormal;
-        return rayExpandedCircleIntersect;
+        return rayExpandedCircleIntersect && testResult.HitTime <= maxTime;
     }
 
     bool MovingAABBAABBIntersect2D(AABB const &aabb, glm::vec2 direction, AABB const &otherAABB, DynamicTestResult2D &testResult)
+    {
+        return MovingAABBAABBIntersect2D(aabb, direction, 1.0f, otherAABB, testResult);
+    }
+
+    bool MovingAABBAABBIntersect2D(AABB const &aabb, glm::vec2 direction, float maxTime, AABB const &otherAABB, DynamicTestResult2D &testResult)
     {
         if (AABBAABBIntersect2D(aabb, otherAABB))
         {
@@ -322,7 +331,7 @@ namespace DYE::Math
         // All axes first/last should overlap with each other.
         constexpr int const numberOfAxes = 2;
         float firstContactTime = 0.0f;
-        float lastContactTime = 1.0f;
+        float lastContactTime = maxTime;
         for (int i = 0; i < numberOfAxes; ++i)
         {
             if (direction[i] == 0.0f)
@@ -0,0 +1,605 @@
+#include "Math/PrimitiveTestBatch.h"
+
+#include "Util/Macro.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#if defined(__AVX2__)
+#define DYE_BATCH_TEST_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DYE_BATCH_TEST_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define DYE_BATCH_TEST_NEON
+#include <arm_neon.h>
+#endif
+
+namespace DYE::Math
+{
+    namespace
+    {
+        // The kernels are written once against the following 'lanes' interfaces, and instantiated for the scalar & SIMD lanes.
+        // A mask is a per-lane boolean.
+
+        struct ScalarLanes
+        {
+            static constexpr std::size_t Width = 1;
+            using Float = float;
+            using Mask = bool;
+
+            static Float Load(float const *pValues) { return *pValues; }
+            static Float Set(float value) { return value; }
+            static void Store(float *pOutValues, Float values) { *pOutValues = values; }
+
+            static Float Add(Float a, Float b) { return a + b; }
+            static Float Sub(Float a, Float b) { return a - b; }
+            static Float Mul(Float a, Float b) { return a * b; }
+            static Float Min(Float a, Float b) { return std::min(a, b); }
+            static Float Max(Float a, Float b) { return std::max(a, b); }
+            static Float Sqrt(Float a) { return std::sqrt(a); }
+
+            static Mask LessEqual(Float a, Float b) { return a <= b; }
+            static Mask Greater(Float a, Float b) { return a > b; }
+            static Mask And(Mask a, Mask b) { return a && b; }
+            static Mask Or(Mask a, Mask b) { return a || b; }
+            /// a && !b
+            static Mask AndNot(Mask a, Mask b) { return a && !b; }
+            /// mask ? a : b
+            static Float Select(Mask mask, Float a, Float b) { return mask ? a : b; }
+
+            /// \return the number of the set lanes.
+            static std::size_t StoreMask(std::uint8_t *pOutHits, Mask mask)
+            {
+                *pOutHits = mask ? 1 : 0;
+                return mask ? 1 : 0;
+            }
+        };
+
+#if defined(DYE_BATCH_TEST_AVX2)
+        struct SIMDLanes
+        {
+            static constexpr std::size_t Width = 8;
+            using Float = __m256;
+            using Mask = __m256;
+
+            static Float Load(float const *pValues) { return _mm256_loadu_ps(pValues); }
+            static Float Set(float value) { return _mm256_set1_ps(value); }
+            static void Store(float *pOutValues, Float values) { _mm256_storeu_ps(pOutValues, values); }
+
+            static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+            static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+            static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+            static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+            static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+            static Float Sqrt(Float a) { return _mm256_sqrt_ps(a); }
+
+            static Mask LessEqual(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+            static Mask Greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+            static Mask And(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+            static Mask Or(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+            static Mask AndNot(Mask a, Mask b) { return _mm256_andnot_ps(b, a); }
+            static Float Select(Mask mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+
+            static std::size_t StoreMask(std::uint8_t *pOutHits, Mask mask)
+            {
+                auto const bits = static_cast<unsigned>(_mm256_movemask_ps(mask));
+                for (std::size_t lane = 0; lane < Width; lane++)
+                {
+                    pOutHits[lane] = (bits >> lane) & 1u;
+                }
+                return std::popcount(bits);
+            }
+        };
+
+        constexpr char const *SIMDLanesName = "AVX2";
+#elif defined(DYE_BATCH_TEST_SSE2)
+        struct SIMDLanes
+        {
+            static constexpr std::size_t Width = 4;
+            using Float = __m128;
+            using Mask = __m128;
+
+            static Float Load(float const *pValues) { return _mm_loadu_ps(pValues); }
+            static Float Set(float value) { return _mm_set1_ps(value); }
+            static void Store(float *pOutValues, Float values) { _mm_storeu_ps(pOutValues, values); }
+
+            static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+            static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+            static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+            static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+            static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+            static Float Sqrt(Float a) { return _mm_sqrt_ps(a); }
+
+            static Mask LessEqual(Float a, Float b) { return _mm_cmple_ps(a, b); }
+            static Mask Greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+            static Mask And(Mask a, Mask b) { return _mm_and_ps(a, b); }
+            static Mask Or(Mask a, Mask b) { return _mm_or_ps(a, b); }
+            static Mask AndNot(Mask a, Mask b) { return _mm_andnot_ps(b, a); }
+            static Float Select(Mask mask, Float a, Float b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+            static std::size_t StoreMask(std::uint8_t *pOutHits, Mask mask)
+            {
+                auto const bits = static_cast<unsigned>(_mm_movemask_ps(mask));
+                for (std::size_t lane = 0; lane < Width; lane++)
+                {
+                    pOutHits[lane] = (bits >> lane) & 1u;
+                }
+                return std::popcount(bits);
+            }
+        };
+
+        constexpr char const *SIMDLanesName = "SSE2";
+#elif defined(DYE_BATCH_TEST_NEON)
+        struct SIMDLanes
+        {
+            static constexpr std::size_t Width = 4;
+            using Float = float32x4_t;
+            using Mask = uint32x4_t;
+
+            static Float Load(float const *pValues) { return vld1q_f32(pValues); }
+            static Float Set(float value) { return vdupq_n_f32(value); }
+            static void Store(float *pOutValues, Float values) { vst1q_f32(pOutValues, values); }
+
+            static Float Add(Float a, Float b) { return vaddq_f32(a, b); }
+            static Float Sub(Float a, Float b) { return vsubq_f32(a, b); }
+            static Float Mul(Float a, Float b) { return vmulq_f32(a, b); }
+            static Float Min(Float a, Float b) { return vminq_f32(a, b); }
+            static Float Max(Float a, Float b) { return vmaxq_f32(a, b); }
+            static Float Sqrt(Float a) { return vsqrtq_f32(a); }
+
+            static Mask LessEqual(Float a, Float b) { return vcleq_f32(a, b); }
+            static Mask Greater(Float a, Float b) { return vcgtq_f32(a, b); }
+            static Mask And(Mask a, Mask b) { return vandq_u32(a, b); }
+            static Mask Or(Mask a, Mask b) { return vorrq_u32(a, b); }
+            static Mask AndNot(Mask a, Mask b) { return vbicq_u32(a, b); }
+            static Float Select(Mask mask, Float a, Float b) { return vbslq_f32(mask, a, b); }
+
+            static std::size_t StoreMask(std::uint8_t *pOutHits, Mask mask)
+            {
+                // Narrow the 32-bit lanes down to 0/1 bytes.
+                uint32x4_t const bits = vshrq_n_u32(mask, 31);
+                pOutHits[0] = static_cast<std::uint8_t>(vgetq_lane_u32(bits, 0));
+                pOutHits[1] = static_cast<std::uint8_t>(vgetq_lane_u32(bits, 1));
+                pOutHits[2] = static_cast<std::uint8_t>(vgetq_lane_u32(bits, 2));
+                pOutHits[3] = static_cast<std::uint8_t>(vgetq_lane_u32(bits, 3));
+                return vaddvq_u32(bits);
+            }
+        };
+
+        constexpr char const *SIMDLanesName = "NEON";
+#endif
+
+        /// Run the kernel over the whole batch: the SIMD lanes take as many shapes as they can, and the scalar lanes take the rest.
+        /// \param kernel called as kernel(Lanes {}, first, last), where (last - first) is a multiple of the lane width.
+        template<typename Kernel>
+        std::size_t runBatchTest(BatchTestKernel kernelType, std::size_t count, Kernel kernel)
+        {
+            std::size_t numberOfHits = 0;
+            std::size_t first = 0;
+#if defined(DYE_BATCH_TEST_AVX2) || defined(DYE_BATCH_TEST_SSE2) || defined(DYE_BATCH_TEST_NEON)
+            if (kernelType == BatchTestKernel::SIMD)
+            {
+                first = count - count % SIMDLanes::Width;
+                numberOfHits += kernel(SIMDLanes {}, 0, first);
+            }
+#endif
+            numberOfHits += kernel(ScalarLanes {}, first, count);
+            return numberOfHits;
+        }
+
+        /// Narrow down the [enterTime, exitTime] interval of a ray with one slab of the AABBs, see RayAABBIntersect2D in PrimitiveTest.cpp.
+        template<typename Lanes>
+        void clipRayBySlab(bool isParallelToSlab, typename Lanes::Float origin, typename Lanes::Float timeNormalizingMultiplier,
+                           typename Lanes::Float slabMin, typename Lanes::Float slabMax,
+                           typename Lanes::Mask &hit, typename Lanes::Float &enterTime, typename Lanes::Float &exitTime)
+        {
+            if (isParallelToSlab)
+            {
+                hit = Lanes::And(hit, Lanes::And(Lanes::LessEqual(slabMin, origin), Lanes::LessEqual(origin, slabMax)));
+                return;
+            }
+
+            auto const firstTime = Lanes::Mul(Lanes::Sub(slabMin, origin), timeNormalizingMultiplier);
+            auto const secondTime = Lanes::Mul(Lanes::Sub(slabMax, origin), timeNormalizingMultiplier);
+            enterTime = Lanes::Max(enterTime, Lanes::Min(firstTime, secondTime));
+            exitTime = Lanes::Min(exitTime, Lanes::Max(firstTime, secondTime));
+        }
+
+        /// Narrow down the [firstContactTime, lastContactTime] interval of a moving AABB with the AABBs on one axis,
+        /// see MovingAABBAABBIntersect2D in PrimitiveTest.cpp.
+        template<typename Lanes>
+        void clipContactTimeByAxis(float direction, typename Lanes::Float timeNormalizingMultiplier,
+                                   typename Lanes::Float min, typename Lanes::Float max, typename Lanes::Float otherMin, typename Lanes::Float otherMax,
+                                   typename Lanes::Mask &miss, typename Lanes::Float &firstContactTime, typename Lanes::Float &lastContactTime)
+        {
+            if (direction == 0.0f)
+            {
+                // The AABBs never change their states on this axis, therefore they have to be overlapping on it already.
+                miss = Lanes::Or(miss, Lanes::Or(Lanes::Greater(otherMin, max), Lanes::Greater(min, otherMax)));
+                return;
+            }
+
+            if (direction < 0.0f)
+            {
+                // Moving away from the other AABB if it is on the other side.
+                miss = Lanes::Or(miss, Lanes::Greater(otherMin, max));
+                auto const firstTime = Lanes::Mul(Lanes::Sub(otherMax, min), timeNormalizingMultiplier);
+                auto const lastTime = Lanes::Mul(Lanes::Sub(otherMin, max), timeNormalizingMultiplier);
+                firstContactTime = Lanes::Select(Lanes::Greater(min, otherMax), Lanes::Max(firstTime, firstContactTime), firstContactTime);
+                lastContactTime = Lanes::Select(Lanes::Greater(max, otherMin), Lanes::Min(lastTime, lastContactTime), lastContactTime);
+            }
+            else
+            {
+                miss = Lanes::Or(miss, Lanes::Greater(min, otherMax));
+                auto const firstTime = Lanes::Mul(Lanes::Sub(otherMin, max), timeNormalizingMultiplier);
+                auto const lastTime = Lanes::Mul(Lanes::Sub(otherMax, min), timeNormalizingMultiplier);
+                firstContactTime = Lanes::Select(Lanes::Greater(otherMin, max), Lanes::Max(firstTime, firstContactTime), firstContactTime);
+                lastContactTime = Lanes::Select(Lanes::Greater(otherMax, min), Lanes::Min(lastTime, lastContactTime), lastContactTime);
+            }
+        }
+    }
+
+    void AABBBatch2D::Reserve(std::size_t capacity)
+    {
+        MinX.reserve(capacity);
+        MinY.reserve(capacity);
+        MaxX.reserve(capacity);
+        MaxY.reserve(capacity);
+    }
+
+    void AABBBatch2D::Clear()
+    {
+        MinX.clear();
+        MinY.clear();
+        MaxX.clear();
+        MaxY.clear();
+    }
+
+    void AABBBatch2D::Add(AABB const &aabb)
+    {
+        MinX.push_back(aabb.Min.x);
+        MinY.push_back(aabb.Min.y);
+        MaxX.push_back(aabb.Max.x);
+        MaxY.push_back(aabb.Max.y);
+    }
+
+    void CircleBatch2D::Reserve(std::size_t capacity)
+    {
+        CenterX.reserve(capacity);
+        CenterY.reserve(capacity);
+        Radius.reserve(capacity);
+    }
+
+    void CircleBatch2D::Clear()
+    {
+        CenterX.clear();
+        CenterY.clear();
+        Radius.clear();
+    }
+
+    void CircleBatch2D::Add(glm::vec2 center, float radius)
+    {
+        CenterX.push_back(center.x);
+        CenterY.push_back(center.y);
+        Radius.push_back(radius);
+    }
+
+    char const *GetSIMDBatchTestKernelName()
+    {
+#if defined(DYE_BATCH_TEST_AVX2) || defined(DYE_BATCH_TEST_SSE2) || defined(DYE_BATCH_TEST_NEON)
+        return SIMDLanesName;
+#else
+        return "Scalar";
+#endif
+    }
+
+    std::size_t AABBAABBIntersect2D(AABB const &aabb, AABBBatch2D const &batch, std::span<std::uint8_t> outHits, BatchTestKernel kernel)
+    {
+        DYE_ASSERT(outHits.size() >= batch.Size() && "AABBAABBIntersect2D: outHits is smaller than the batch.");
+
+        return runBatchTest
+            (
+                kernel, batch.Size(),
+                [&aabb, &batch, pOutHits = outHits.data()](auto lanes, std::size_t first, std::size_t last)
+                {
+                    using Lanes = decltype(lanes);
+                    auto const minX = Lanes::Set(aabb.Min.x);
+                    auto const minY = Lanes::Set(aabb.Min.y);
+                    auto const maxX = Lanes::Set(aabb.Max.x);
+                    auto const maxY = Lanes::Set(aabb.Max.y);
+
+                    std::size_t numberOfHits = 0;
+                    for (std::size_t i = first; i < last; i += Lanes::Width)
+                    {
+                        // Two AABBs only overlap if their intervals overlap on all axes.
+                        auto const overlapX = Lanes::And(Lanes::LessEqual(Lanes::Load(&batch.MinX[i]), maxX), Lanes::LessEqual(minX, Lanes::Load(&batch.MaxX[i])));
+                        auto const overlapY = Lanes::And(Lanes::LessEqual(Lanes::Load(&batch.MinY[i]), maxY), Lanes::LessEqual(minY, Lanes::Load(&batch.MaxY[i])));
+                        numberOfHits += Lanes::StoreMask(pOutHits + i, Lanes::And(overlapX, overlapY));
+                    }
+                    return numberOfHits;
+                }
+            );
+    }
+
+    std::size_t AABBCircleIntersect(AABBBatch2D const &batch, glm::vec2 center, float radius, std::span<std::uint8_t> outHits, BatchTestKernel kernel)
+    {
+        DYE_ASSERT(outHits.size() >= batch.Size() && "AABBCircleIntersect: outHits is smaller than the batch.");
+
+        return runBatchTest
+            (
+                kernel, batch.Size(),
+                [center, radius, &batch, pOutHits = outHits.data()](auto lanes, std::size_t first, std::size_t last)
+                {
+                    using Lanes = decltype(lanes);
+                    auto const centerX = Lanes::Set(center.x);
+                    auto const centerY = Lanes::Set(center.y);
+                    auto const sqrRadius = Lanes::Set(radius * radius);
+                    auto const zero = Lanes::Set(0.0f);
+
+                    std::size_t numberOfHits = 0;
+                    for (std::size_t i = first; i < last; i += Lanes::Width)
+                    {
+                        // The distance from the center to the closest point in the AABB on each axis, 0 if it's inside the slab.
+                        auto const distanceX = Lanes::Max(Lanes::Max(Lanes::Sub(Lanes::Load(&batch.MinX[i]), centerX), Lanes::Sub(centerX, Lanes::Load(&batch.MaxX[i]))), zero);
+                        auto const distanceY = Lanes::Max(Lanes::Max(Lanes::Sub(Lanes::Load(&batch.MinY[i]), centerY), Lanes::Sub(centerY, Lanes::Load(&batch.MaxY[i]))), zero);
+                        auto const sqrDistance = Lanes::Add(Lanes::Mul(distanceX, distanceX), Lanes::Mul(distanceY, distanceY));
+                        numberOfHits += Lanes::StoreMask(pOutHits + i, Lanes::LessEqual(sqrDistance, sqrRadius));
+                    }
+                    return numberOfHits;
+                }
+            );
+    }
+
+    std::size_t CircleCircleIntersect(glm::vec2 center, float radius, CircleBatch2D const &batch, std::span<std::uint8_t> outHits, BatchTestKernel kernel)
+    {
+        DYE_ASSERT(outHits.size() >= batch.Size() && "CircleCircleIntersect: outHits is smaller than the batch.");
+
+        return runBatchTest
+            (
+                kernel, batch.Size(),
+                [center, radius, &batch, pOutHits = outHits.data()](auto lanes, std::size_t first, std::size_t last)
+                {
+                    using Lanes = decltype(lanes);
+                    auto const centerX = Lanes::Set(center.x);
+                    auto const centerY = Lanes::Set(center.y);
+                    auto const radiusLanes = Lanes::Set(radius);
+
+                    std::size_t numberOfHits = 0;
+                    for (std::size_t i = first; i < last; i += Lanes::Width)
+                    {
+                        auto const offsetX = Lanes::Sub(Lanes::Load(&batch.CenterX[i]), centerX);
+                        auto const offsetY = Lanes::Sub(Lanes::Load(&batch.CenterY[i]), centerY);
+                        auto const sqrDistance = Lanes::Add(Lanes::Mul(offsetX, offsetX), Lanes::Mul(offsetY, offsetY));
+                        auto const inRangeDistance = Lanes::Add(Lanes::Load(&batch.Radius[i]), radiusLanes);
+                        numberOfHits += Lanes::StoreMask(pOutHits + i, Lanes::LessEqual(sqrDistance, Lanes::Mul(inRangeDistance, inRangeDistance)));
+                    }
+                    return numberOfHits;
+                }
+            );
+    }
+
+    std::size_t RayAABBIntersect2D(glm::vec2 rayOrigin, glm::vec2 rayDirection, float maxDistance, AABBBatch2D const &batch,
+                                   std::span<std::uint8_t> outHits, std::span<float> outHitTimes, BatchTestKernel kernel)
+    {
+        DYE_ASSERT(outHits.size() >= batch.Size() && "RayAABBIntersect2D: outHits is smaller than the batch.");
+        DYE_ASSERT(outHitTimes.size() >= batch.Size() && "RayAABBIntersect2D: outHitTimes is smaller than the batch.");
+
+        // The ray is the same for all the AABBs, so whether it's parallel to a slab is decided once.
+        bool const isParallelToSlabX = std::abs(rayDirection.x) <= std::numeric_limits<float>::epsilon();
+        bool const isParallelToSlabY = std::abs(rayDirection.y) <= std::numeric_limits<float>::epsilon();
+
+        return runBatchTest
+            (
+                kernel, batch.Size(),
+                [=, &batch, pOutHits = outHits.data(), pOutHitTimes = outHitTimes.data()](auto lanes, std::size_t first, std::size_t last)
+                {
+                    using Lanes = decltype(lanes);
+                    auto const originX = Lanes::Set(rayOrigin.x);
+                    auto const originY = Lanes::Set(rayOrigin.y);
+                    auto const timeNormalizingMultiplierX = Lanes::Set(isParallelToSlabX ? 0.0f : 1.0f / rayDirection.x);
+                    auto const timeNormalizingMultiplierY = Lanes::Set(isParallelToSlabY ? 0.0f : 1.0f / rayDirection.y);
+                    auto const zero = Lanes::Set(0.0f);
+                    auto const maxDistanceLanes = Lanes::Set(maxDistance);
+
+                    std::size_t numberOfHits = 0;
+                    for (std::size_t i = first; i < last; i += Lanes::Width)
+                    {
+                        auto const slabMinX = Lanes::Load(&batch.MinX[i]);
+                        auto const slabMaxX = Lanes::Load(&batch.MaxX[i]);
+                        auto const slabMinY = Lanes::Load(&batch.MinY[i]);
+                        auto const slabMaxY = Lanes::Load(&batch.MaxY[i]);
+
+                        auto enterTime = zero;
+                        auto exitTime = maxDistanceLanes;
+                        auto hit = Lanes::LessEqual(zero, zero);
+                        clipRayBySlab<Lanes>(isParallelToSlabX, originX, timeNormalizingMultiplierX, slabMinX, slabMaxX, hit, enterTime, exitTime);
+                        clipRayBySlab<Lanes>(isParallelToSlabY, originY, timeNormalizingMultiplierY, slabMinY, slabMaxY, hit, enterTime, exitTime);
+
+                        // The slab intersection is empty if the ray exits before it enters.
+                        hit = Lanes::And(hit, Lanes::LessEqual(enterTime, exitTime));
+
+                        Lanes::Store(pOutHitTimes + i, enterTime);
+                        numberOfHits += Lanes::StoreMask(pOutHits + i, hit);
+                    }
+                    return numberOfHits;
+                }
+            );
+    }
+
+    std::size_t RayCircleIntersect(glm::vec2 rayOrigin, glm::vec2 rayDirection, CircleBatch2D const &batch,
+                                   std::span<std::uint8_t> outHits, std::span<float> outHitTimes, BatchTestKernel kernel)
+    {
+        DYE_ASSERT(outHits.size() >= batch.Size() && "RayCircleIntersect: outHits is smaller than the batch.");
+        DYE_ASSERT(outHitTimes.size() >= batch.Size() && "RayCircleIntersect: outHitTimes is smaller than the batch.");
+
+        return runBatchTest
+            (
+                kernel, batch.Size(),
+                [=, &batch, pOutHits = outHits.data(), pOutHitTimes = outHitTimes.data()](auto lanes, std::size_t first, std::size_t last)
+                {
+                    using Lanes = decltype(lanes);
+                    auto const originX = Lanes::Set(rayOrigin.x);
+                    auto const originY = Lanes::Set(rayOrigin.y);
+                    auto const directionX = Lanes::Set(rayDirection.x);
+                    auto const directionY = Lanes::Set(rayDirection.y);
+                    float const a = glm::dot(rayDirection, rayDirection);
+                    auto const aLanes = Lanes::Set(a);
+                    auto const inverseA = Lanes::Set(1.0f / a);
+                    auto const zero = Lanes::Set(0.0f);
+
+                    std::size_t numberOfHits = 0;
+                    for (std::size_t i = first; i < last; i += Lanes::Width)
+                    {
+                        // Solve the quadratic equation of the ray & the circle, see RayCircleIntersect in PrimitiveTest.cpp.
+                        auto const cpX = Lanes::Sub(originX, Lanes::Load(&batch.CenterX[i]));
+                        auto const cpY = Lanes::Sub(originY, Lanes::Load(&batch.CenterY[i]));
+                        auto const radius = Lanes::Load(&batch.Radius[i]);
+                        auto const b = Lanes::Add(Lanes::Mul(cpX, directionX), Lanes::Mul(cpY, directionY));
+                        auto const c = Lanes::Sub(Lanes::Add(Lanes::Mul(cpX, cpX), Lanes::Mul(cpY, cpY)), Lanes::Mul(radius, radius));
+
+                        auto const isOutsideAndPointingAway = Lanes::And(Lanes::Greater(c, zero), Lanes::Greater(b, zero));
+                        auto const discriminant = Lanes::Sub(Lanes::Mul(b, b), Lanes::Mul(aLanes, c));
+                        auto const hit = Lanes::AndNot(Lanes::LessEqual(zero, discriminant), isOutsideAndPointingAway);
+
+                        // A negative time means the ray starts inside the circle, clamp it to zero.
+                        auto const hitTime = Lanes::Mul(Lanes::Sub(Lanes::Sub(zero, b), Lanes::Sqrt(Lanes::Max(discriminant, zero))), inverseA);
+                        Lanes::Store(pOutHitTimes + i, Lanes::Max(hitTime, zero));
+                        numberOfHits += Lanes::StoreMask(pOutHits + i, hit);
+                    }
+                    return numberOfHits;
+                }
+            );
+    }
+
+    std::size_t MovingAABBAABBIntersect2D(AABB const &aabb, glm::vec2 direction, float maxTime, AABBBatch2D const &batch,
+                                          std::span<std::uint8_t> outHits, std::span<float> outHitTimes, BatchTestKernel kernel)
+    {
+        DYE_ASSERT(outHits.size() >= batch.Size() && "MovingAABBAABBIntersect2D: outHits is smaller than the batch.");
+        DYE_ASSERT(outHitTimes.size() >= batch.Size() && "MovingAABBAABBIntersect2D: outHitTimes is smaller than the batch.");
+
+        return runBatchTest
+            (
+                kernel, batch.Size(),
+                [=, &aabb, &batch, pOutHits = outHits.data(), pOutHitTimes = outHitTimes.data()](auto lanes, std::size_t first, std::size_t last)
+                {
+                    using Lanes = decltype(lanes);
+                    auto const minX = Lanes::Set(aabb.Min.x);
+                    auto const minY = Lanes::Set(aabb.Min.y);
+                    auto const maxX = Lanes::Set(aabb.Max.x);
+                    auto const maxY = Lanes::Set(aabb.Max.y);
+                    auto const timeNormalizingMultiplierX = Lanes::Set(direction.x == 0.0f ? 0.0f : 1.0f / direction.x);
+                    auto const timeNormalizingMultiplierY = Lanes::Set(direction.y == 0.0f ? 0.0f : 1.0f / direction.y);
+                    auto const zero = Lanes::Set(0.0f);
+                    auto const maxTimeLanes = Lanes::Set(maxTime);
+
+                    std::size_t numberOfHits = 0;
+                    for (std::size_t i = first; i < last; i += Lanes::Width)
+                    {
+                        auto const otherMinX = Lanes::Load(&batch.MinX[i]);
+                        auto const otherMaxX = Lanes::Load(&batch.MaxX[i]);
+                        auto const otherMinY = Lanes::Load(&batch.MinY[i]);
+                        auto const otherMaxY = Lanes::Load(&batch.MaxY[i]);
+
+                        // The AABBs that are initially overlapping are hit at time 0.
+                        auto const overlapX = Lanes::And(Lanes::LessEqual(otherMinX, maxX), Lanes::LessEqual(minX, otherMaxX));
+                        auto const overlapY = Lanes::And(Lanes::LessEqual(otherMinY, maxY), Lanes::LessEqual(minY, otherMaxY));
+                        auto const isOverlapping = Lanes::And(overlapX, overlapY);
+
+                        auto firstContactTime = zero;
+                        auto lastContactTime = maxTimeLanes;
+                        auto miss = Lanes::Greater(zero, zero);
+                        clipContactTimeByAxis<Lanes>(direction.x, timeNormalizingMultiplierX, minX, maxX, otherMinX, otherMaxX, miss, firstContactTime, lastContactTime);
+                        clipContactTimeByAxis<Lanes>(direction.y, timeNormalizingMultiplierY, minY, maxY, otherMinY, otherMaxY, miss, firstContactTime, lastContactTime);
+
+                        // The AABBs have to overlap on all axes at the same time.
+                        auto const hit = Lanes::Or(isOverlapping, Lanes::AndNot(Lanes::LessEqual(firstContactTime, lastContactTime), miss));
+
+                        Lanes::Store(pOutHitTimes + i, Lanes::Select(isOverlapping, zero, firstContactTime));
+                        numberOfHits += Lanes::StoreMask(pOutHits + i, hit);
+                    }
+                    return numberOfHits;
+                }
+            );
+    }
+
+    std::size_t MovingCircleAABBIntersect(glm::vec2 center, float radius, glm::vec2 direction, float maxTime, AABBBatch2D const &batch,
+                                          std::span<std::uint8_t> outHits, std::span<float> outHitTimes, BatchTestKernel kernel)
+    {
+        DYE_ASSERT(outHits.size() >= batch.Size() && "MovingCircleAABBIntersect: outHits is smaller than the batch.");
+        DYE_ASSERT(outHitTimes.size() >= batch.Size() && "MovingCircleAABBIntersect: outHitTimes is smaller than the batch.");
+
+        bool const isParallelToSlabX = std::abs(direction.x) <= std::numeric_limits<float>::epsilon();
+        bool const isParallelToSlabY = std::abs(direction.y) <= std::numeric_limits<float>::epsilon();
+
+        return runBatchTest
+            (
+                kernel, batch.Size(),
+                [=, &batch, pOutHits = outHits.data(), pOutHitTimes = outHitTimes.data()](auto lanes, std::size_t first, std::size_t last)
+                {
+                    using Lanes = decltype(lanes);
+                    auto const centerX = Lanes::Set(center.x);
+                    auto const centerY = Lanes::Set(center.y);
+                    auto const radiusLanes = Lanes::Set(radius);
+                    auto const sqrRadius = Lanes::Set(radius * radius);
+                    auto const directionX = Lanes::Set(direction.x);
+                    auto const directionY = Lanes::Set(direction.y);
+                    auto const timeNormalizingMultiplierX = Lanes::Set(isParallelToSlabX ? 0.0f : 1.0f / direction.x);
+                    auto const timeNormalizingMultiplierY = Lanes::Set(isParallelToSlabY ? 0.0f : 1.0f / direction.y);
+                    float const a = glm::dot(direction, direction);
+                    auto const aLanes = Lanes::Set(a);
+                    auto const inverseA = Lanes::Set(1.0f / a);
+                    auto const zero = Lanes::Set(0.0f);
+                    auto const maxTimeLanes = Lanes::Set(maxTime);
+
+                    std::size_t numberOfHits = 0;
+                    for (std::size_t i = first; i < last; i += Lanes::Width)
+                    {
+                        auto const slabMinX = Lanes::Load(&batch.MinX[i]);
+                        auto const slabMaxX = Lanes::Load(&batch.MaxX[i]);
+                        auto const slabMinY = Lanes::Load(&batch.MinY[i]);
+                        auto const slabMaxY = Lanes::Load(&batch.MaxY[i]);
+
+                        // Do a ray & the AABB expanded by the radius intersect test,
+                        // the ray has to hit it before it gets farther than (direction * maxTime).
+                        auto enterTime = zero;
+                        auto exitTime = maxTimeLanes;
+                        auto hit = Lanes::LessEqual(zero, zero);
+                        clipRayBySlab<Lanes>(isParallelToSlabX, centerX, timeNormalizingMultiplierX,
+                                             Lanes::Sub(slabMinX, radiusLanes), Lanes::Add(slabMaxX, radiusLanes), hit, enterTime, exitTime);
+                        clipRayBySlab<Lanes>(isParallelToSlabY, centerY, timeNormalizingMultiplierY,
+                                             Lanes::Sub(slabMinY, radiusLanes), Lanes::Add(slabMaxY, radiusLanes), hit, enterTime, exitTime);
+                        hit = Lanes::And(hit, Lanes::LessEqual(enterTime, exitTime));
+
+                        // The hit centroid in an edge region of the AABB is a hit already,
+                        // see MovingCircleAABBIntersect in PrimitiveTest.cpp for the Voronoi regions.
+                        auto const hitCentroidX = Lanes::Add(centerX, Lanes::Mul(directionX, enterTime));
+                        auto const hitCentroidY = Lanes::Add(centerY, Lanes::Mul(directionY, enterTime));
+                        auto const inSlabX = Lanes::And(Lanes::LessEqual(slabMinX, hitCentroidX), Lanes::LessEqual(hitCentroidX, slabMaxX));
+                        auto const inSlabY = Lanes::And(Lanes::LessEqual(slabMinY, hitCentroidY), Lanes::LessEqual(hitCentroidY, slabMaxY));
+                        auto const isEdgeRegion = Lanes::Or(inSlabX, inSlabY);
+
+                        // Otherwise it's in a corner region, do a ray & circle (at the corner) intersect test.
+                        auto const cornerX = Lanes::Select(Lanes::Greater(slabMinX, hitCentroidX), slabMinX, slabMaxX);
+                        auto const cornerY = Lanes::Select(Lanes::Greater(slabMinY, hitCentroidY), slabMinY, slabMaxY);
+                        auto const cpX = Lanes::Sub(centerX, cornerX);
+                        auto const cpY = Lanes::Sub(centerY, cornerY);
+                        auto const b = Lanes::Add(Lanes::Mul(cpX, directionX), Lanes::Mul(cpY, directionY));
+                        auto const c = Lanes::Sub(Lanes::Add(Lanes::Mul(cpX, cpX), Lanes::Mul(cpY, cpY)), sqrRadius);
+                        auto const isOutsideAndPointingAway = Lanes::And(Lanes::Greater(c, zero), Lanes::Greater(b, zero));
+                        auto const discriminant = Lanes::Sub(Lanes::Mul(b, b), Lanes::Mul(aLanes, c));
+                        auto const isCornerHit = Lanes::AndNot(Lanes::LessEqual(zero, discriminant), isOutsideAndPointingAway);
+                        auto const cornerHitTime = Lanes::Max(Lanes::Mul(Lanes::Sub(Lanes::Sub(zero, b), Lanes::Sqrt(Lanes::Max(discriminant, zero))), inverseA), zero);
+
+                        hit = Lanes::And(hit, Lanes::Or(isEdgeRegion, Lanes::And(isCornerHit, Lanes::LessEqual(cornerHitTime, maxTimeLanes))));
+
+                        Lanes::Store(pOutHitTimes + i, Lanes::Select(isEdgeRegion, enterTime, cornerHitTime));
+                        numberOfHits += Lanes::StoreMask(pOutHits + i, hit);
+                    }
+                    return numberOfHits;
+                }
+            );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "Graphics/RecordingRenderCommand.h"
+
+#include "Graphics/VertexArray.h"
+#include "Graphics/Shader.h"
+#include "Graphics/Texture.h"
+
+#include <limits>
+
+namespace DYE
+{
+    RecordingRenderCommand::RecordingRenderCommand(bool keepCommandList) : m_KeepCommandList(keepCommandList)
+    {
+    }
+
+    void RecordingRenderCommand::Reset()
+    {
+        m_RecordedCommands.clear();
+        m_Statistics = {};
+    }
+
+    glm::vec<2, std::uint32_t> RecordingRenderCommand::GetMaxFramebufferSize() const
+    {
+        // There is no device to query, there is no limit.
+        return {std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::max()};
+    }
+
+    void RecordingRenderCommand::SwapWindowBuffer(WindowBase const &windowBase)
+    {
+        record({.Type = RecordedRenderCommandType::SwapWindowBuffer});
+    }
+
+    void RecordingRenderCommand::SetViewport(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height)
+    {
+        record({.Type = RecordedRenderCommandType::SetViewport});
+    }
+
+    void RecordingRenderCommand::SetClearColor(const glm::vec4 &color)
+    {
+        record({.Type = RecordedRenderCommandType::SetClearColor});
+    }
+
+    void RecordingRenderCommand::SetLinePrimitiveWidth(float width)
+    {
+        record({.Type = RecordedRenderCommandType::SetLinePrimitiveWidth});
+    }
+
+    void RecordingRenderCommand::Clear()
+    {
+        m_Statistics.NumberOfClears++;
+        record({.Type = RecordedRenderCommandType::Clear});
+    }
+
+    void RecordingRenderCommand::ClearDepthStencilOnly()
+    {
+        m_Statistics.NumberOfClears++;
+        record({.Type = RecordedRenderCommandType::ClearDepthStencilOnly});
+    }
+
+    void RecordingRenderCommand::applyRenderState(RenderState renderState)
+    {
+        m_Statistics.NumberOfRenderStateChanges++;
+        record({.Type = RecordedRenderCommandType::ApplyRenderState});
+    }
+
+    void RecordingRenderCommand::useShaderProgram(ShaderProgram const &shaderProgram)
+    {
+        m_Statistics.NumberOfShaderProgramBinds++;
+        record({.Type = RecordedRenderCommandType::UseShaderProgram, .ObjectID = shaderProgram.GetID()});
+    }
+
+    void RecordingRenderCommand::SetUniformFloat(UniformLocation location, float value)
+    {
+        recordUniformUpload(location);
+    }
+
+    void RecordingRenderCommand::SetUniformFloat2(UniformLocation location, glm::vec2 const &value)
+    {
+        recordUniformUpload(location);
+    }
+
+    void RecordingRenderCommand::SetUniformFloat3(UniformLocation location, glm::vec3 const &value)
+    {
+        recordUniformUpload(location);
+    }
+
+    void RecordingRenderCommand::SetUniformFloat4(UniformLocation location, glm::vec4 const &value)
+    {
+        recordUniformUpload(location);
+    }
+
+    void RecordingRenderCommand::SetUniformMat3(UniformLocation location, glm::mat3 const &value)
+    {
+        recordUniformUpload(location);
+    }
+
+    void RecordingRenderCommand::SetUniformMat4(UniformLocation location, glm::mat4 const &value)
+    {
+        recordUniformUpload(location);
+    }
+
+    void RecordingRenderCommand::SetUniformInt(UniformLocation location, std::int32_t value)
+    {
+        recordUniformUpload(location);
+    }
+
+    void RecordingRenderCommand::bindTexture(Texture &texture, std::uint32_t textureUnitSlot)
+    {
+        m_Statistics.NumberOfTextureBinds++;
+        record({.Type = RecordedRenderCommandType::BindTexture, .ObjectID = texture.GetID(), .Count = textureUnitSlot});
+    }
+
+    void RecordingRenderCommand::bindVertexArray(VertexArray const &vertexArray)
+    {
+        m_Statistics.NumberOfVertexArrayBinds++;
+        record({.Type = RecordedRenderCommandType::BindVertexArray, .ObjectID = vertexArray.GetID()});
+    }
+
+    void RecordingRenderCommand::ResetVertexBufferData(VertexBuffer &vertexBuffer, const void *data, std::uint32_t size, BufferUsageHint usage)
+    {
+        m_Statistics.NumberOfBufferUpdates++;
+        m_Statistics.NumberOfUpdatedBufferBytes += size;
+        record({.Type = RecordedRenderCommandType::ResetBufferData, .ObjectID = vertexBuffer.GetID(), .Count = size});
+    }
+
+    void RecordingRenderCommand::ResetIndexBufferData(IndexBuffer &indexBuffer, std::uint32_t *indices, std::uint32_t count, BufferUsageHint usage)
+    {
+        std::uint32_t const size = count * sizeof(std::uint32_t);
+        m_Statistics.NumberOfBufferUpdates++;
+        m_Statistics.NumberOfUpdatedBufferBytes += size;
+        record({.Type = RecordedRenderCommandType::ResetBufferData, .ObjectID = indexBuffer.GetID(), .Count = size});
+    }
+
+    void RecordingRenderCommand::DrawIndexed(PrimitiveType primitiveType, std::uint32_t indexCount, int numberOfInstances, DrawIndexedOffsets const &offsets)
+    {
+        m_Statistics.NumberOfDrawCalls++;
+        m_Statistics.NumberOfDrawnIndices += (std::uint64_t) indexCount * numberOfInstances;
+        record({.Type = RecordedRenderCommandType::DrawIndexed, .Count = indexCount, .NumberOfInstances = numberOfInstances});
+    }
+
+    void RecordingRenderCommand::record(RecordedRenderCommand command)
+    {
+        if (!m_KeepCommandList)
+        {
+            return;
+        }
+
+        m_RecordedCommands.push_back(command);
+    }
+
+    void RecordingRenderCommand::recordUniformUpload(UniformLocation location)
+    {
+        m_Statistics.NumberOfUniformUploads++;
+        record({.Type = RecordedRenderCommandType::SetUniform, .ObjectID = location});
+    }
+}
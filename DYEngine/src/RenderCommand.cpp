@@ -1,55 +1,15 @@
 #include "Graphics/RenderCommand.h"
 
-#include "Util/Logger.h"
-#include "Graphics/OpenGL.h"
+#include "Util/Macro.h"
+#include "Graphics/OpenGLRenderCommand.h"
 #include "Graphics/VertexArray.h"
 #include "Graphics/Shader.h"
 #include "Graphics/Material.h"
-#include "Graphics/WindowBase.h"
-
-#include <SDL.h>
-#include <glad/glad.h>
-#include <glm/gtc/type_ptr.hpp>
 
 #include <memory>
 
 namespace DYE
 {
-#ifdef DYE_OPENGL_DEBUG
-    static void APIENTRY openglCallbackFunction
-        (
-            GLenum source,
-            GLenum type,
-            GLuint id,
-            GLenum severity,
-            GLsizei length,
-            const GLchar *message,
-            const void *userParam
-        )
-    {
-        (void) source;
-        (void) type;
-        (void) id;
-        (void) severity;
-        (void) length;
-        (void) userParam;
-
-        switch (severity)
-        {
-            case GL_DEBUG_SEVERITY_HIGH:
-                DYE_LOG_ERROR("[OpenGL Debug HIGH] %s", message);
-                DYE_ASSERT(false);
-                break;
-            case GL_DEBUG_SEVERITY_MEDIUM:
-                DYE_LOG_WARN("[OpenGL Debug MED] %s", message);
-                break;
-            case GL_DEBUG_SEVERITY_LOW:
-                //DYE_LOG_INFO("[OpenGL Debug LOW] %s", message);
-                break;
-        }
-    }
-#endif
-
     std::unique_ptr<RenderCommand> RenderCommand::s_Instance {};
 
     RenderCommand &RenderCommand::GetInstance()
@@ -62,143 +22,192 @@ namespace DYE
 
     void RenderCommand::InitSingleton()
     {
-#ifdef DYE_OPENGL_DEBUG
-        // Enable the debug callback
-        glEnable(GL_DEBUG_OUTPUT);
-        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
-        glDebugMessageCallback(openglCallbackFunction, nullptr);
-        glDebugMessageControl(
-            GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, true
-        );
-#endif
-        s_Instance = std::make_unique<RenderCommand>();
+        s_Instance = std::make_unique<OpenGLRenderCommand>();
     }
 
-    void RenderCommand::SwapWindowBuffer(WindowBase const &windowBase)
+    void RenderCommand::InitSingleton(std::unique_ptr<RenderCommand> renderCommand)
     {
-        SDL_GL_SwapWindow(windowBase.GetTypedNativeWindowPtr<SDL_Window>());
+        s_Instance = std::move(renderCommand);
     }
 
-    void RenderCommand::SetViewport(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height)
+    std::unique_ptr<RenderCommand> RenderCommand::ReplaceInstance(std::unique_ptr<RenderCommand> renderCommand)
     {
-        glViewport(x, y, width, height);
-        glScissor(x, y, width, height);
+        std::swap(s_Instance, renderCommand);
+        return renderCommand;
     }
 
-    void RenderCommand::SetViewport(Math::Rect viewportRect)
+    void RenderCommand::BeginStateCaching()
     {
-        int x = glm::round(viewportRect.X);
-        int y = glm::round(viewportRect.Y);
-        int width = glm::round(viewportRect.Width);
-        int height = glm::round(viewportRect.Height);
-        glViewport(x, y, width, height);
-        glScissor(x, y, width, height);
+        invalidateStateCache();
+        m_IsStateCaching = true;
+    }
+
+    void RenderCommand::EndStateCaching()
+    {
+        m_IsStateCaching = false;
+        invalidateStateCache();
+    }
+
+    void RenderCommand::invalidateStateCache()
+    {
+        m_CachedRenderState.reset();
+        m_pCachedShaderProgram = nullptr;
+        m_pCachedVertexArray = nullptr;
+        m_CachedTextures.fill(nullptr);
+    }
+
+    void RenderCommand::ApplyRenderState(RenderState const &renderState)
+    {
+        if (m_IsStateCaching)
+        {
+            if (m_CachedRenderState.has_value() && m_CachedRenderState.value() == renderState)
+            {
+                m_StateCacheStatistics.NumberOfElidedRenderStateChanges++;
+                return;
+            }
+
+            m_CachedRenderState = renderState;
+            m_StateCacheStatistics.NumberOfIssuedRenderStateChanges++;
+        }
+
+        applyRenderState(renderState);
     }
 
-    void RenderCommand::SetClearColor(const glm::vec4 &color)
+    bool RenderCommand::UseShaderProgram(ShaderProgram const &shaderProgram)
     {
-        glClearColor(color.r, color.g, color.b, color.a);
+        if (m_IsStateCaching)
+        {
+            if (m_pCachedShaderProgram == &shaderProgram)
+            {
+                m_StateCacheStatistics.NumberOfElidedShaderProgramBinds++;
+                return false;
+            }
+
+            m_pCachedShaderProgram = &shaderProgram;
+            m_StateCacheStatistics.NumberOfIssuedShaderProgramBinds++;
+        }
+
+        useShaderProgram(shaderProgram);
+        return true;
     }
 
-    void RenderCommand::SetLinePrimitiveWidth(float width)
+    void RenderCommand::BindTexture(Texture &texture, std::uint32_t textureUnitSlot)
     {
-        glLineWidth(width);
+        if (m_IsStateCaching && textureUnitSlot < MaxNumberOfCachedTextureUnits)
+        {
+            if (m_CachedTextures[textureUnitSlot] == &texture)
+            {
+                m_StateCacheStatistics.NumberOfElidedTextureBinds++;
+                return;
+            }
+
+            m_CachedTextures[textureUnitSlot] = &texture;
+            m_StateCacheStatistics.NumberOfIssuedTextureBinds++;
+        }
+
+        bindTexture(texture, textureUnitSlot);
     }
 
-    void RenderCommand::Clear()
+    void RenderCommand::BindVertexArray(VertexArray const &vertexArray)
     {
-        // Enable depth mask first so glClear() call actually clears depth buffer.
-        glCall(glDepthMask(GL_TRUE));
-        glCall(glEnable(GL_SCISSOR_TEST));
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        if (m_IsStateCaching)
+        {
+            if (m_pCachedVertexArray == &vertexArray)
+            {
+                m_StateCacheStatistics.NumberOfElidedVertexArrayBinds++;
+                return;
+            }
+
+            m_pCachedVertexArray = &vertexArray;
+            m_StateCacheStatistics.NumberOfIssuedVertexArrayBinds++;
+        }
+
+        bindVertexArray(vertexArray);
     }
 
-    void RenderCommand::ClearDepthStencilOnly()
+    void RenderCommand::SetViewport(Math::Rect viewportRect)
     {
-        // Enable depth mask first so glClear() call actually clears depth buffer.
-        glCall(glDepthMask(GL_TRUE));
-        glCall(glEnable(GL_SCISSOR_TEST));
-        glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        int x = glm::round(viewportRect.X);
+        int y = glm::round(viewportRect.Y);
+        int width = glm::round(viewportRect.Width);
+        int height = glm::round(viewportRect.Height);
+        SetViewport(x, y, width, height);
     }
 
     void RenderCommand::DrawIndexedLinesNow(const VertexArray &vertexArray)
     {
         // Bind mesh (VAO)
-        vertexArray.Bind();
-        std::uint32_t const indexCount = vertexArray.GetIndexBuffer()->GetCount();
-        glCall(glDrawElements(GL_LINES, indexCount, GL_UNSIGNED_INT, nullptr));
+        BindVertexArray(vertexArray);
+        DrawIndexed(PrimitiveType::Lines, vertexArray.GetIndexBuffer()->GetCount(), 1);
     }
 
     void RenderCommand::DrawIndexedLinesInstancedNow(const VertexArray &vertexArray, int numberOfInstances)
     {
         // Bind mesh (VAO)
-        vertexArray.Bind();
-        std::uint32_t const indexCount = vertexArray.GetIndexBuffer()->GetCount();
-        glCall(glDrawElementsInstanced(GL_LINES, indexCount, GL_UNSIGNED_INT, nullptr, numberOfInstances));
+        BindVertexArray(vertexArray);
+        DrawIndexed(PrimitiveType::Lines, vertexArray.GetIndexBuffer()->GetCount(), numberOfInstances);
     }
 
     void RenderCommand::DrawIndexedNow(VertexArray const &vertexArray)
     {
         // Bind mesh (VAO)
-        vertexArray.Bind();
-        std::uint32_t const indexCount = vertexArray.GetIndexBuffer()->GetCount();
-        glCall(glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr));
+        BindVertexArray(vertexArray);
+        DrawIndexed(PrimitiveType::Triangles, vertexArray.GetIndexBuffer()->GetCount(), 1);
     }
 
     void RenderCommand::DrawIndexedInstancedNow(const VertexArray &vertexArray, int numberOfInstances)
     {
         // Bind mesh (VAO)
-        vertexArray.Bind();
-        std::uint32_t const indexCount = vertexArray.GetIndexBuffer()->GetCount();
-        glCall(glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, numberOfInstances));
+        BindVertexArray(vertexArray);
+        DrawIndexed(PrimitiveType::Triangles, vertexArray.GetIndexBuffer()->GetCount(), numberOfInstances);
     }
 
     void RenderCommand::DrawIndexedNow(RenderParameters const &renderParameters, VertexArray const &vertexArray, glm::mat4 objectToWorldMatrix)
     {
         auto &shader = renderParameters.Material->GetShaderProgram();
-        auto &camera = renderParameters.Camera;
 
         // Set render state
-        shader.GetDefaultRenderState().Apply();
+        ApplyRenderState(shader.GetDefaultRenderState());
 
         // Bind shader
-        shader.Use();
+        UseShaderProgram(shader);
 
         // Bind built-in uniforms (matrices)
         {
             // Local to world space
-            auto modelMatrixLoc = glGetUniformLocation(shader.GetID(), DefaultUniformNames::ModelMatrix);
-            glCall(glUniformMatrix4fv(modelMatrixLoc, 1, GL_FALSE, glm::value_ptr(objectToWorldMatrix)));
+            if (auto modelMatrixInfo = shader.TryGetUniformInfo(DefaultUniformNames::ModelMatrix); modelMatrixInfo.has_value())
+            {
+                SetUniformMat4(modelMatrixInfo->Location, objectToWorldMatrix);
+            }
 
-            // World space to camera space
-            glm::mat4 viewMatrix = camera.ViewMatrix;
-            auto viewMatrixLoc = glGetUniformLocation(shader.GetID(), DefaultUniformNames::ViewMatrix);
-            glCall(glUniformMatrix4fv(viewMatrixLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix)));
-
-            // Camera space to clip space
-            float const aspectRatio = camera.Properties.GetAspectRatio();
-            glm::mat4 projectionMatrix = camera.Properties.GetProjectionMatrix(aspectRatio);
-            auto projectionMatrixLoc = glGetUniformLocation(shader.GetID(), DefaultUniformNames::ProjectionMatrix);
-            glCall(glUniformMatrix4fv(projectionMatrixLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix)));
+            // World space to camera space, camera space to clip space
+            SetCameraUniforms(shader, renderParameters.Camera);
         }
 
         // Bind property uniforms on the material
-        renderParameters.Material->updateUniformValuesToGPU();
+        renderParameters.Material->updateUniformValuesToGPU(*this);
 
         // Bind property values on the property block
-        renderParameters.PropertyBlock.updatePropertyValuesToGPU(shader);
+        renderParameters.PropertyBlock.updatePropertyValuesToGPU(*this, shader);
 
         // Bind mesh (VAO)
-        vertexArray.Bind();
-        std::uint32_t const indexCount = vertexArray.GetIndexBuffer()->GetCount();
-        glCall(glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr));
+        BindVertexArray(vertexArray);
+        DrawIndexed(PrimitiveType::Triangles, vertexArray.GetIndexBuffer()->GetCount(), 1);
     }
 
-    glm::vec<2, std::uint32_t> RenderCommand::GetMaxFramebufferSize() const
+    void RenderCommand::SetCameraUniforms(ShaderProgram const &shaderProgram, Camera const &camera)
     {
-        std::int32_t width, height;
-        glGetIntegerv(GL_MAX_FRAMEBUFFER_WIDTH, &width);
-        glGetIntegerv(GL_MAX_FRAMEBUFFER_HEIGHT, &height);
-        return {width, height};
+        // World space to camera space
+        if (auto viewMatrixInfo = shaderProgram.TryGetUniformInfo(DefaultUniformNames::ViewMatrix); viewMatrixInfo.has_value())
+        {
+            SetUniformMat4(viewMatrixInfo->Location, camera.ViewMatrix);
+        }
+
+        // Camera space to clip space
+        if (auto projectionMatrixInfo = shaderProgram.TryGetUniformInfo(DefaultUniformNames::ProjectionMatrix); projectionMatrixInfo.has_value())
+        {
+            float const aspectRatio = camera.Properties.GetAspectRatio();
+            SetUniformMat4(projectionMatrixInfo->Location, camera.Properties.GetProjectionMatrix(aspectRatio));
+        }
     }
-}
\ No newline at end of file
+}
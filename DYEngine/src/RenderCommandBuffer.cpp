@@ -0,0 +1,80 @@
+#include "Graphics/RenderCommandBuffer.h"
+
+#include "Graphics/RenderCommand.h"
+#include "Graphics/VertexArray.h"
+#include "Graphics/Material.h"
+#include "Graphics/MaterialPropertyBlock.h"
+#include "Graphics/Shader.h"
+
+#include <algorithm>
+#include <optional>
+
+namespace DYE
+{
+    void RenderCommandBuffer::SortByKey()
+    {
+        std::stable_sort
+            (
+                m_DrawIndexedCommands.begin(),
+                m_DrawIndexedCommands.end(),
+                [](DrawIndexedCommand const &commandA, DrawIndexedCommand const &commandB)
+                {
+                    return commandA.SortKey < commandB.SortKey;
+                }
+            );
+    }
+
+    void RenderCommandBuffer::Execute(RenderCommand &renderCommand, Camera const &camera) const
+    {
+        renderCommand.BeginStateCaching();
+
+        Material const *pPreviousMaterial = nullptr;
+        std::optional<UniformLocation> modelMatrixLocation;
+
+        // Uniform values are stored per shader program, they only have to be uploaded again if they might have been changed.
+        // A non-empty property block could override the values of the material, in which case the material is uploaded again.
+        bool hasPreviousPropertyBlockOverridden = false;
+
+        for (auto const &command: m_DrawIndexedCommands)
+        {
+            Material const &material = *command.pMaterial;
+            ShaderProgram const &shader = material.GetShaderProgram();
+
+            // Set render state
+            renderCommand.ApplyRenderState(shader.GetDefaultRenderState());
+
+            // Bind shader, camera matrices are uploaded once per shader bind.
+            bool const isShaderBound = renderCommand.UseShaderProgram(shader);
+            if (isShaderBound)
+            {
+                auto const modelMatrixInfo = shader.TryGetUniformInfo(DefaultUniformNames::ModelMatrix);
+                modelMatrixLocation = modelMatrixInfo.has_value() ? std::optional(modelMatrixInfo->Location) : std::nullopt;
+
+                renderCommand.SetCameraUniforms(shader, camera);
+            }
+
+            // Local to world space
+            if (modelMatrixLocation.has_value())
+            {
+                renderCommand.SetUniformMat4(modelMatrixLocation.value(), command.ObjectToWorldMatrix);
+            }
+
+            // Bind property uniforms on the material
+            if (isShaderBound || &material != pPreviousMaterial || hasPreviousPropertyBlockOverridden)
+            {
+                material.updateUniformValuesToGPU(renderCommand);
+                pPreviousMaterial = &material;
+            }
+
+            // Bind property values on the property block
+            command.pPropertyBlock->updatePropertyValuesToGPU(renderCommand, shader);
+            hasPreviousPropertyBlockOverridden = !command.pPropertyBlock->IsEmpty();
+
+            // Bind mesh (VAO)
+            renderCommand.BindVertexArray(*command.pVertexArray);
+            renderCommand.DrawIndexed(PrimitiveType::Triangles, command.pVertexArray->GetIndexBuffer()->GetCount(), 1);
+        }
+
+        renderCommand.EndStateCaching();
+    }
+}
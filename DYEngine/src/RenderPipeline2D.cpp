@@ -7,8 +7,13 @@
 #include "Graphics/Texture.h"
 
 #include "Util/Algorithm.h"
+#include "Util/Macro.h"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <limits>
+#include <thread>
 
 namespace DYE
 {
@@ -133,46 +138,287 @@ namespace DYE
             );
     }
 
+    void RenderPipeline2D::onCaptureFramePacket()
+    {
+        // The previous packet has been cleared in onPostRender, swap to retain the capacity of both buffers.
+        std::swap(m_Submissions, m_FramePacketSubmissions);
+        m_Submissions.clear();
+
+        // Snapshot the materials, the submissions sharing a material share the snapshot.
+        for (auto &submission: m_FramePacketSubmissions)
+        {
+            auto [snapshotItr, isNewSnapshot] = m_MaterialSnapshots.try_emplace(submission.Material.get());
+            if (isNewSnapshot)
+            {
+                snapshotItr->second = std::make_shared<Material>(*submission.Material);
+            }
+            submission.Material = snapshotItr->second;
+        }
+        m_MaterialSnapshots.clear();
+    }
+
     void RenderPipeline2D::onPreRender()
     {
         // Do nothing.
     }
 
+    void RenderPipeline2D::prepareCameras(const std::vector<Camera> &cameras)
+    {
+        computeSubmissionBounds();
+
+        // Assign a view to each camera on the render thread, so that the cameras sharing a view are only prepared once.
+        std::size_t const numberOfPreparedViewsBefore = m_NumberOfPreparedViewsThisFrame;
+        std::vector<bool> isCameraViewReused;
+        isCameraViewReused.reserve(cameras.size());
+        m_CameraPreparedViewIndices.clear();
+        m_CameraPreparedViewIndices.reserve(cameras.size());
+        for (auto const &camera: cameras)
+        {
+            auto const [viewIndex, isNewView] = findOrAddPreparedView(camera);
+            m_CameraPreparedViewIndices.push_back(viewIndex);
+            isCameraViewReused.push_back(!isNewView);
+        }
+
+        // Cull, record & sort the new views on worker threads, the render thread takes views as well.
+        // The views only read the submissions, which are not modified during rendering.
+        std::size_t const numberOfNewViews = m_NumberOfPreparedViewsThisFrame - numberOfPreparedViewsBefore;
+        std::size_t const numberOfThreads = std::min<std::size_t>(numberOfNewViews, std::max(std::thread::hardware_concurrency(), 1u));
+        std::atomic<std::size_t> nextViewIndex = numberOfPreparedViewsBefore;
+        auto prepareViews = [this, &nextViewIndex]()
+        {
+            for (std::size_t viewIndex = nextViewIndex++; viewIndex < m_NumberOfPreparedViewsThisFrame; viewIndex = nextViewIndex++)
+            {
+                prepareView(m_PreparedViews[viewIndex]);
+            }
+        };
+
+        std::vector<std::thread> workerThreads;
+        for (std::size_t i = 1; i < numberOfThreads; i++)
+        {
+            workerThreads.emplace_back(prepareViews);
+        }
+        prepareViews();
+        for (auto &workerThread: workerThreads)
+        {
+            workerThread.join();
+        }
+
+        // The statistics are accumulated after the views are prepared.
+        for (std::size_t i = 0; i < cameras.size(); i++)
+        {
+            accumulateCullingStatistics(m_PreparedViews[m_CameraPreparedViewIndices[i]], isCameraViewReused[i]);
+        }
+    }
+
     void RenderPipeline2D::renderCamera(const Camera &camera)
     {
-        // Sort the submission (render queue, sorting layer, camera distance etc).
-        // TODO: we want to use insertion sort instead cuz the vector will already be kinda sorted in every Submit call
-        // TODO: we can also further decode the sorting criteria into an integer and use radix sort as well (see: https://youtu.be/4BISSS3MCNA)
-        glm::mat4 const viewMatrix = camera.ViewMatrix;
-        std::stable_sort
-            (
-                m_Submissions.begin(),
-                m_Submissions.end(),
-                [viewMatrix](RenderSubmission2D const &submissionA, RenderSubmission2D const &submissionB)
+        // The camera is not passed to prepareCameras (i.e. the pipeline is driven manually), prepare it on the render thread.
+        computeSubmissionBounds();
+
+        auto const [viewIndex, isNewView] = findOrAddPreparedView(camera);
+        if (isNewView)
+        {
+            prepareView(m_PreparedViews[viewIndex]);
+        }
+        accumulateCullingStatistics(m_PreparedViews[viewIndex], !isNewView);
+
+        m_PreparedViews[viewIndex].CommandBuffer.Execute(RenderCommand::GetInstance(), camera);
+    }
+
+    void RenderPipeline2D::renderPreparedCamera(const Camera &camera, std::size_t cameraIndex)
+    {
+        DYE_ASSERT(cameraIndex < m_CameraPreparedViewIndices.size() && "RenderPipeline2D::renderPreparedCamera: the camera is not passed to prepareCameras in this frame.");
+
+        // Execute draw-calls, the only part that has to be on the render thread.
+        m_PreparedViews[m_CameraPreparedViewIndices[cameraIndex]].CommandBuffer.Execute(RenderCommand::GetInstance(), camera);
+    }
+
+    void RenderPipeline2D::onPostRender()
+    {
+        // Clean up the submissions.
+        m_FramePacketSubmissions.clear();
+        m_SubmissionBounds.Clear();
+        m_NumberOfPreparedViewsThisFrame = 0;
+        m_CameraPreparedViewIndices.clear();
+
+        m_CullingStatisticsLastFrame = m_CullingStatisticsThisFrame;
+        m_CullingStatisticsThisFrame = {};
+
+        RenderCommand &renderCommand = RenderCommand::GetInstance();
+        m_StateCacheStatisticsLastFrame = renderCommand.GetStateCacheStatistics();
+        renderCommand.ResetStateCacheStatistics();
+    }
+
+    void RenderPipeline2D::computeSubmissionBounds()
+    {
+        if (m_SubmissionBounds.Size() == m_FramePacketSubmissions.size())
+        {
+            return;
+        }
+
+        constexpr float infinity = std::numeric_limits<float>::infinity();
+        Math::AABB const infiniteBounds {glm::vec3 {-infinity}, glm::vec3 {infinity}};
+
+        m_SubmissionBounds.Clear();
+        m_SubmissionBounds.Reserve(m_FramePacketSubmissions.size());
+        for (auto const &submission: m_FramePacketSubmissions)
+        {
+            if (submission.VertexArray != m_DefaultSpriteVAO)
+            {
+                // We don't know the extent of an arbitrary vertex array, never cull it.
+                m_SubmissionBounds.Add(infiniteBounds);
+                continue;
+            }
+
+            // The default sprite quad spans [-0.5, 0.5] on the local x & y axes.
+            // The world-space extent on each axis is the sum of the absolute contributions of the two local half axes.
+            glm::mat4 const &matrix = submission.ObjectToWorldMatrix;
+            glm::vec3 const center {matrix[3]};
+            glm::vec3 const extents = 0.5f * (glm::abs(glm::vec3 {matrix[0]}) + glm::abs(glm::vec3 {matrix[1]}));
+            m_SubmissionBounds.Add(Math::AABB {center - extents, center + extents});
+        }
+    }
+
+    std::pair<std::size_t, bool> RenderPipeline2D::findOrAddPreparedView(Camera const &camera)
+    {
+        glm::mat4 const projectionMatrix = camera.Properties.GetProjectionMatrix(camera.Properties.GetAspectRatio());
+
+        // Cameras sharing the same view & projection (i.e. a scene camera rendering to multiple targets) see the same submissions.
+        for (std::size_t i = 0; i < m_NumberOfPreparedViewsThisFrame; i++)
+        {
+            PreparedView const &view = m_PreparedViews[i];
+            if (view.ViewMatrix == camera.ViewMatrix && view.ProjectionMatrix == projectionMatrix)
+            {
+                return {i, false};
+            }
+        }
+
+        if (m_NumberOfPreparedViewsThisFrame == m_PreparedViews.size())
+        {
+            m_PreparedViews.emplace_back();
+        }
+
+        std::size_t const viewIndex = m_NumberOfPreparedViewsThisFrame++;
+        PreparedView &view = m_PreparedViews[viewIndex];
+        view.ViewMatrix = camera.ViewMatrix;
+        view.ProjectionMatrix = projectionMatrix;
+        return {viewIndex, true};
+    }
+
+    void RenderPipeline2D::prepareView(PreparedView &view) const
+    {
+        auto const numberOfSubmissions = (std::uint32_t) m_SubmissionBounds.Size();
+
+        // The world-space AABB of the frustum, calculated by transforming the corners of the clip-space cube back to world space.
+        // For an orthographic camera that only rotates around the view axis, the AABB is the exact visible area in 2D.
+        glm::mat4 const clipToWorldMatrix = glm::inverse(view.ProjectionMatrix * view.ViewMatrix);
+        glm::vec3 frustumMin {std::numeric_limits<float>::max()};
+        glm::vec3 frustumMax {std::numeric_limits<float>::lowest()};
+        for (int cornerIndex = 0; cornerIndex < 8; cornerIndex++)
+        {
+            glm::vec4 const clipCorner
                 {
-                    auto modelViewMatrixA = viewMatrix * submissionA.ObjectToWorldMatrix;
-                    auto modelViewMatrixB = viewMatrix * submissionB.ObjectToWorldMatrix;
-                    glm::vec4 const viewPositionA = modelViewMatrixA * glm::vec4 {0, 0, 0, 1};
-                    glm::vec4 const viewPositionB = modelViewMatrixB * glm::vec4 {0, 0, 0, 1};
-                    return viewPositionA.z < viewPositionB.z;
-                }
-            );
+                    (cornerIndex & 1) ? 1.0f : -1.0f,
+                    (cornerIndex & 2) ? 1.0f : -1.0f,
+                    (cornerIndex & 4) ? 1.0f : -1.0f,
+                    1.0f
+                };
+            glm::vec4 worldCorner = clipToWorldMatrix * clipCorner;
+            worldCorner /= worldCorner.w;
+
+            frustumMin = glm::min(frustumMin, glm::vec3 {worldCorner});
+            frustumMax = glm::max(frustumMax, glm::vec3 {worldCorner});
+        }
+
+        // Branchless overlap test over the arrays of bounds, which the compiler can vectorize.
+        view.VisibilityMask.resize(numberOfSubmissions);
+        float const *pMinX = m_SubmissionBounds.MinX.data();
+        float const *pMinY = m_SubmissionBounds.MinY.data();
+        float const *pMinZ = m_SubmissionBounds.MinZ.data();
+        float const *pMaxX = m_SubmissionBounds.MaxX.data();
+        float const *pMaxY = m_SubmissionBounds.MaxY.data();
+        float const *pMaxZ = m_SubmissionBounds.MaxZ.data();
+        std::uint8_t *pVisibilityMask = view.VisibilityMask.data();
+        for (std::uint32_t i = 0; i < numberOfSubmissions; i++)
+        {
+            pVisibilityMask[i] = (std::uint8_t) ((pMinX[i] <= frustumMax.x) & (pMaxX[i] >= frustumMin.x) &
+                                                 (pMinY[i] <= frustumMax.y) & (pMaxY[i] >= frustumMin.y) &
+                                                 (pMinZ[i] <= frustumMax.z) & (pMaxZ[i] >= frustumMin.z));
+        }
 
-        // Execute draw-calls.
-        for (auto const &submission: m_Submissions)
+        view.VisibleSubmissionIndices.clear();
+        for (std::uint32_t i = 0; i < numberOfSubmissions; i++)
         {
-            RenderCommand::GetInstance().DrawIndexedNow
+            if (pVisibilityMask[i] != 0)
+            {
+                view.VisibleSubmissionIndices.push_back(i);
+            }
+        }
+
+        // Record the visible submissions into compact draw commands, the depth in view space is calculated once per submission.
+        view.CommandBuffer.Clear();
+        view.CommandBuffer.Reserve(view.VisibleSubmissionIndices.size());
+        for (std::uint32_t const submissionIndex: view.VisibleSubmissionIndices)
+        {
+            RenderSubmission2D const &submission = m_FramePacketSubmissions[submissionIndex];
+            glm::vec4 const viewPosition = view.ViewMatrix * submission.ObjectToWorldMatrix * glm::vec4 {0, 0, 0, 1};
+            view.CommandBuffer.RecordDrawIndexed
                 (
-                    RenderParameters {.Camera = camera, .Material = submission.Material, .PropertyBlock = submission.MaterialPropertyBlock},
-                    *submission.VertexArray,
-                    submission.ObjectToWorldMatrix
+                    RenderCommandBuffer::DrawIndexedCommand
+                        {
+                            .pVertexArray = submission.VertexArray.get(),
+                            .pMaterial = submission.Material.get(),
+                            .pPropertyBlock = &submission.MaterialPropertyBlock,
+                            .ObjectToWorldMatrix = submission.ObjectToWorldMatrix,
+                            .SortKey = viewPosition.z
+                        }
                 );
         }
+
+        // Sort the commands (render queue, sorting layer, camera distance etc).
+        // TODO: we can also further decode the sorting criteria into an integer and use radix sort as well (see: https://youtu.be/4BISSS3MCNA)
+        view.CommandBuffer.SortByKey();
     }
 
-    void RenderPipeline2D::onPostRender()
+    void RenderPipeline2D::accumulateCullingStatistics(PreparedView const &view, bool isReused)
     {
-        // Clean up the submissions.
-        m_Submissions.clear();
+        auto const numberOfSubmissions = (std::uint32_t) m_FramePacketSubmissions.size();
+        auto const numberOfVisibleSubmissions = (std::uint32_t) view.VisibleSubmissionIndices.size();
+        m_CullingStatisticsThisFrame.NumberOfVisibleSubmissions += numberOfVisibleSubmissions;
+        m_CullingStatisticsThisFrame.NumberOfCulledSubmissions += numberOfSubmissions - numberOfVisibleSubmissions;
+        if (isReused)
+        {
+            m_CullingStatisticsThisFrame.NumberOfReusedCullingResults++;
+        }
+    }
+
+    void RenderPipeline2D::SubmissionBounds::Clear()
+    {
+        MinX.clear();
+        MinY.clear();
+        MinZ.clear();
+        MaxX.clear();
+        MaxY.clear();
+        MaxZ.clear();
+    }
+
+    void RenderPipeline2D::SubmissionBounds::Reserve(std::size_t size)
+    {
+        MinX.reserve(size);
+        MinY.reserve(size);
+        MinZ.reserve(size);
+        MaxX.reserve(size);
+        MaxY.reserve(size);
+        MaxZ.reserve(size);
+    }
+
+    void RenderPipeline2D::SubmissionBounds::Add(Math::AABB const &bounds)
+    {
+        MinX.push_back(bounds.Min.x);
+        MinY.push_back(bounds.Min.y);
+        MinZ.push_back(bounds.Min.z);
+        MaxX.push_back(bounds.Max.x);
+        MaxY.push_back(bounds.Max.y);
+        MaxZ.push_back(bounds.Max.z);
     }
 }
\ No newline at end of file
@@ -9,6 +9,9 @@
 #include "Graphics/ContextBase.h"
 #include "Graphics/Framebuffer.h"
 #include "Graphics/DebugDraw.h"
+#include "Graphics/Shader.h"
+
+#include <glad/glad.h>
 
 #include <optional>
 
@@ -16,14 +19,45 @@ namespace DYE
 {
     std::shared_ptr<RenderPipelineBase> RenderPipelineManager::s_ActiveRenderPipeline = {};
     std::vector<Camera> RenderPipelineManager::s_Cameras = {};
+    std::vector<Camera> RenderPipelineManager::s_FramePacketCameras = {};
+    bool RenderPipelineManager::s_IsHeadless = false;
     bool RenderPipelineManager::EnableDebugDraw = true;
 
     void RenderPipelineManager::Initialize()
     {
+        s_IsHeadless = false;
         DebugDraw::initialize();
     }
 
+    void RenderPipelineManager::InitializeHeadless()
+    {
+        s_IsHeadless = true;
+    }
+
     void RenderPipelineManager::RenderWithActivePipeline()
+    {
+        CaptureFramePacket();
+        RenderFramePacket();
+    }
+
+    void RenderPipelineManager::CaptureFramePacket()
+    {
+        if (!s_ActiveRenderPipeline)
+        {
+            // No render pipeline is set as the active pipeline, nothing is rendered!
+            s_Cameras.clear();
+            return;
+        }
+
+        // The packet cameras have been cleared after the previous packet was rendered, swap to retain the capacity.
+        std::swap(s_Cameras, s_FramePacketCameras);
+        s_Cameras.clear();
+
+        s_ActiveRenderPipeline->onCaptureFramePacket();
+        DebugDraw::captureFramePacket();
+    }
+
+    void RenderPipelineManager::RenderFramePacket()
     {
         if (!s_ActiveRenderPipeline)
         {
@@ -31,18 +65,41 @@ namespace DYE
             return;
         }
 
-        if (s_Cameras.empty())
+        if (s_FramePacketCameras.empty())
         {
-            DYE_LOG("RenderPipelineManager::RenderWithActivePipeline is called, but no camera has been registered.");
+            DYE_LOG("RenderPipelineManager::RenderFramePacket is called, but no camera has been registered.");
         }
 
+        if (s_IsHeadless)
+        {
+            // There is no render target to bind in headless mode, simply pass the cameras to the pipeline.
+            s_ActiveRenderPipeline->onPreRender();
+            s_ActiveRenderPipeline->prepareCameras(s_FramePacketCameras);
+            for (std::size_t cameraIndex = 0; cameraIndex < s_FramePacketCameras.size(); cameraIndex++)
+            {
+                s_ActiveRenderPipeline->renderPreparedCamera(s_FramePacketCameras[cameraIndex], cameraIndex);
+            }
+            s_ActiveRenderPipeline->onPostRender();
+
+            DebugDraw::clearDebugDraw();
+            s_FramePacketCameras.clear();
+            return;
+        }
+
+        glEnable(GL_CULL_FACE);
+        glCullFace(GL_BACK);
+
+        // Finish the shader programs (i.e. keyword variants) whose async compilation has completed,
+        // so they can be used in this frame instead of the fallback.
+        ShaderProgram::PollPendingCompilations();
+
         // Sort the cameras based on their render target ID.
         // to reduce the number of calls to window context swap.
         // After that, sort them based on their Depth value (from low to high).
         std::stable_sort
             (
-                s_Cameras.begin(),
-                s_Cameras.end(),
+                s_FramePacketCameras.begin(),
+                s_FramePacketCameras.end(),
                 [](Camera const &cameraA, Camera const &cameraB)
                 {
                     if (cameraA.Properties.TargetType != cameraB.Properties.TargetType)
@@ -89,6 +146,25 @@ namespace DYE
 
         s_ActiveRenderPipeline->onPreRender();
 
+        // Update the cameras' aspect ratio before they are prepared, since the projection matrices depend on it.
+        for (auto &camera: s_FramePacketCameras)
+        {
+            bool const hasRenderTarget = camera.Properties.TargetType == RenderTargetType::Window ?
+                                         WindowManager::TryGetWindowAt(camera.Properties.TargetWindowIndex) != nullptr :
+                                         camera.Properties.pTargetRenderTexture != nullptr;
+            if (!hasRenderTarget)
+            {
+                // The camera will be skipped.
+                continue;
+            }
+
+            camera.Properties.CachedAutomaticAspectRatio = camera.Properties.GetAutomaticAspectRatioOfDimension(camera.Properties.GetTargetDimension());
+        }
+
+        // Let the pipeline do the per-camera work that doesn't need the render API (possibly on worker threads),
+        // only the draw-calls are issued in renderCamera on the render thread.
+        s_ActiveRenderPipeline->prepareCameras(s_FramePacketCameras);
+
         // We always render the main window first.
         // Make the main window's context current!
         WindowBase *pCurrentWindow = WindowManager::GetMainWindow();
@@ -97,8 +173,10 @@ namespace DYE
         Framebuffer *pCurrentFramebuffer = nullptr;
         pCurrentWindow->MakeCurrent();
 
-        for (auto &camera: s_Cameras)
+        for (std::size_t cameraIndex = 0; cameraIndex < s_FramePacketCameras.size(); cameraIndex++)
         {
+            auto &camera = s_FramePacketCameras[cameraIndex];
+
             // Render to a window
             if (camera.Properties.TargetType == RenderTargetType::Window)
             {
@@ -154,9 +232,8 @@ namespace DYE
                 }
             }
 
-            // Update camera's aspect ratio and set viewport.
+            // Set viewport, the aspect ratio has been updated before the cameras are prepared.
             auto targetDimension = camera.Properties.GetTargetDimension();
-            camera.Properties.CachedAutomaticAspectRatio = camera.Properties.GetAutomaticAspectRatioOfDimension(targetDimension);
             Math::Rect const viewportDimension = camera.Properties.GetAbsoluteViewportOfDimension(targetDimension);
 
             RenderCommand::GetInstance().SetViewport(viewportDimension);
@@ -170,7 +247,7 @@ namespace DYE
                 RenderCommand::GetInstance().ClearDepthStencilOnly();
             }
 
-            s_ActiveRenderPipeline->renderCamera(camera);
+            s_ActiveRenderPipeline->renderPreparedCamera(camera, cameraIndex);
 
             // Render DebugDraw at the end to make sure debug gizmos are on top of other objects.
             DebugDraw::renderDebugDrawOnCamera(camera);
@@ -194,7 +271,7 @@ namespace DYE
 
         DebugDraw::clearDebugDraw();
 
-        s_Cameras.clear();
+        s_FramePacketCameras.clear();
     }
 
 
@@ -0,0 +1,115 @@
+#include "Graphics/RenderThread.h"
+
+#include "Graphics/RenderPipelineManager.h"
+#include "Graphics/WindowBase.h"
+#include "Util/Macro.h"
+#include "Util/Stopwatch.h"
+
+namespace DYE
+{
+    RenderThread::~RenderThread()
+    {
+        Stop();
+    }
+
+    void RenderThread::Start(WindowBase &mainWindow)
+    {
+        DYE_ASSERT_LOG_WARN(!IsRunning(), "RenderThread::Start is called but the render thread is already running.");
+        if (IsRunning())
+        {
+            return;
+        }
+
+        m_pMainWindow = &mainWindow;
+        m_HasFrameToRender = false;
+        m_IsStopRequested = false;
+        m_IsFrameInFlight = false;
+        m_Thread = std::thread(&RenderThread::run, this);
+
+        DYE_LOG("Render thread started.");
+    }
+
+    void RenderThread::Stop()
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+
+        WaitForFrame();
+
+        {
+            std::scoped_lock lock(m_Mutex);
+            m_IsStopRequested = true;
+        }
+        m_ConditionVariable.notify_all();
+        m_Thread.join();
+
+        DYE_LOG("Render thread stopped.");
+    }
+
+    void RenderThread::KickFrame()
+    {
+        // Wait for the previous packet in case WaitForFrame hasn't been called, the packet is not allowed to be captured while being rendered.
+        WaitForFrame();
+
+        RenderPipelineManager::CaptureFramePacket();
+        m_pMainWindow->ReleaseCurrent();
+
+        {
+            std::scoped_lock lock(m_Mutex);
+            m_HasFrameToRender = true;
+        }
+        m_IsFrameInFlight = true;
+        m_ConditionVariable.notify_all();
+    }
+
+    void RenderThread::WaitForFrame()
+    {
+        if (!m_IsFrameInFlight)
+        {
+            return;
+        }
+
+        Stopwatch const stopwatch;
+        {
+            std::unique_lock lock(m_Mutex);
+            m_ConditionVariable.wait(lock, [this]() { return !m_HasFrameToRender; });
+            m_StatisticsLastFrame.RenderMilliseconds = m_RenderMillisecondsInFlight;
+        }
+        m_StatisticsLastFrame.WaitMilliseconds = stopwatch.GetElapsedMilliseconds();
+
+        m_IsFrameInFlight = false;
+        m_pMainWindow->MakeCurrent();
+    }
+
+    void RenderThread::run()
+    {
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_Mutex);
+                m_ConditionVariable.wait(lock, [this]() { return m_HasFrameToRender || m_IsStopRequested; });
+                if (!m_HasFrameToRender)
+                {
+                    // Stop is requested & there is no frame left to render.
+                    break;
+                }
+            }
+
+            Stopwatch const stopwatch;
+            m_pMainWindow->MakeCurrent();
+            RenderPipelineManager::RenderFramePacket();
+
+            // The rendering might have switched to another window's context, release whichever is current.
+            m_pMainWindow->ReleaseCurrent();
+
+            {
+                std::scoped_lock lock(m_Mutex);
+                m_RenderMillisecondsInFlight = stopwatch.GetElapsedMilliseconds();
+                m_HasFrameToRender = false;
+            }
+            m_ConditionVariable.notify_all();
+        }
+    }
+}
@@ -39,4 +39,13 @@ namespace DYE
             DYE_LOG_ERROR("SDLContext: Couldn't initialize glad");
         }
     }
+
+    void SDLContext::ReleaseCurrentForWindow(WindowBase const &window)
+    {
+        int const status = SDL_GL_MakeCurrent(window.GetTypedNativeWindowPtr<SDL_Window>(), nullptr);
+        if (status < 0)
+        {
+            DYE_LOG("SDLContext: SDL_GL_MakeCurrent (release) failed: %s\n", SDL_GetError());
+        }
+    }
 }
\ No newline at end of file
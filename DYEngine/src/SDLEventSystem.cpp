@@ -26,15 +26,14 @@ namespace DYE
                 isPreprocessedByImGui = ImGui_ImplSDL2_ProcessEvent(&event);
             }
 
-            std::shared_ptr<Event> eventPtr;
+            // Events are constructed on the stack and broadcast right away,
+            // so high-rate events (i.e. mouse motion) don't pay for a heap allocation each.
             SDL_JoystickID joystickInstanceID;
-            bool caught = false;
 
             switch (event.type)
             {
                 case SDL_QUIT:
-                    eventPtr.reset(new ApplicationQuitEvent(event.quit.timestamp));
-                    caught = true;
+                    emplaceBroadcast<ApplicationQuitEvent>(event.quit.timestamp);
                     break;
                 case SDL_WINDOWEVENT:
                     if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
@@ -46,78 +45,66 @@ namespace DYE
                             break;
                         }
 
-                        eventPtr.reset(new WindowSizeChangeEvent(event.window.windowID, event.window.data1, event.window.data2));
-                        caught = true;
+                        emplaceBroadcast<WindowSizeChangeEvent>(event.window.windowID, event.window.data1, event.window.data2);
                     }
                     else if (event.window.event == SDL_WINDOWEVENT_RESIZED)
                     {
-                        eventPtr.reset(new WindowManualResizeEvent(event.window.windowID, event.window.data1, event.window.data2));
-                        caught = true;
+                        emplaceBroadcast<WindowManualResizeEvent>(event.window.windowID, event.window.data1, event.window.data2);
                     }
                     else if (event.window.event == SDL_WINDOWEVENT_CLOSE)
                     {
-                        eventPtr.reset(new WindowCloseEvent(event.window.windowID));
-                        caught = true;
+                        emplaceBroadcast<WindowCloseEvent>(event.window.windowID);
                     }
                     else if (event.window.event == SDL_WINDOWEVENT_MOVED)
                     {
-                        eventPtr.reset(new WindowMoveEvent(event.window.windowID, event.window.data1, event.window.data2));
-                        caught = true;
+                        emplaceBroadcast<WindowMoveEvent>(event.window.windowID, event.window.data1, event.window.data2);
                     }
 
                     /// MORE
                     break;
                 case SDL_KEYDOWN:
                     // static case SDL_KeyCode into DYE::KeyCode
-                    eventPtr.reset(new KeyDownEvent(static_cast<KeyCode>(event.key.keysym.sym)));
-                    caught = true;
+                    emplaceBroadcast<KeyDownEvent>(static_cast<KeyCode>(event.key.keysym.sym));
                     break;
                 case SDL_KEYUP:
                     // static case SDL_KeyCode into DYE::KeyCode
-                    eventPtr.reset(new KeyUpEvent(static_cast<KeyCode>(event.key.keysym.sym)));
-                    caught = true;
+                    emplaceBroadcast<KeyUpEvent>(static_cast<KeyCode>(event.key.keysym.sym));
                     break;
                 case SDL_MOUSEMOTION:
-                    eventPtr.reset(new MouseMovedEvent(event.motion.x, event.motion.y, event.motion.xrel, event.motion.yrel));
-                    caught = true;
+                    emplaceBroadcast<MouseMovedEvent>(event.motion.x, event.motion.y, event.motion.xrel, event.motion.yrel);
                     break;
                 case SDL_MOUSEBUTTONDOWN:
                     // TODO: Imgui Process, look at imgui_impl_sdl
-                    eventPtr.reset(new MouseButtonDownEvent(static_cast<MouseButton>(event.button.button)));
-                    caught = true;
+                    emplaceBroadcast<MouseButtonDownEvent>(static_cast<MouseButton>(event.button.button));
                     break;
                 case SDL_MOUSEBUTTONUP:
                     // TODO: Imgui Process, look at imgui_impl_sdl
-                    eventPtr.reset(new MouseButtonUpEvent(static_cast<MouseButton>(event.button.button)));
-                    caught = true;
+                    emplaceBroadcast<MouseButtonUpEvent>(static_cast<MouseButton>(event.button.button));
                     break;
                 case SDL_MOUSEWHEEL:
                     // TODO: update SDL to >= 2.0.18 so we can use wheel.preciseX/Y instead of wheel.X/Y.
                     // 	see - https://wiki.libsdl.org/SDL2/SDL_MouseWheelEvent#remarks for further information.
                     if (event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED)
                     {
-                        eventPtr.reset(new MouseScrolledEvent(-event.wheel.x, -event.wheel.y));
+                        emplaceBroadcast<MouseScrolledEvent>(-event.wheel.x, -event.wheel.y);
                     }
                     else
                     {
-                        eventPtr.reset(new MouseScrolledEvent(event.wheel.x, event.wheel.y));
+                        emplaceBroadcast<MouseScrolledEvent>(event.wheel.x, event.wheel.y);
                     }
-                    caught = true;
                     break;
                 case SDL_CONTROLLERDEVICEADDED:
                     // Note that cdevice.which is not the instance id in ControllerAddedEvent, but index (location in the system array).
                     // To keep the event data symmetrical, we want to use the instance id instead.
                     joystickInstanceID = SDL_JoystickGetDeviceInstanceID(event.cdevice.which);
-                    eventPtr.reset(new GamepadConnectEvent(joystickInstanceID, event.cdevice.which));
-                    caught = true;
+                    emplaceBroadcast<GamepadConnectEvent>(joystickInstanceID, event.cdevice.which);
                     break;
                 case SDL_CONTROLLERDEVICEREMOVED:
                     // This event would only be fired if the disconnected joystick is:
                     // 1. a game controller/gamepad
                     // 2. has been opened
                     joystickInstanceID = event.cdevice.which;
-                    eventPtr.reset(new GamepadDisconnectEvent(joystickInstanceID));
-                    caught = true;
+                    emplaceBroadcast<GamepadDisconnectEvent>(joystickInstanceID);
                     break;
                 case SDL_CONTROLLERDEVICEREMAPPED:
                     break;
@@ -130,16 +117,8 @@ namespace DYE
                     break;
 
                 default:
-                    // Error
-                    caught = false;
                     break;
             }
-
-            // Dispatch event
-            if (caught)
-            {
-                broadcast(*eventPtr);
-            }
         }
     }
 }
\ No newline at end of file
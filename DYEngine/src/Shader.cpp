@@ -1,11 +1,14 @@
 #include "Util/Macro.h"
 #include "Graphics/Shader.h"
 #include "Graphics/OpenGL.h"
+#include "Graphics/ShaderProgramBinaryCache.h"
 
 #include "Graphics/ShaderProcessorBase.h"
 #include "Graphics/Processor/UniformPropertyProcessor.h"
 #include "Graphics/Processor/BlendStateCommandProcessor.h"
 #include "Graphics/Processor/DepthStateCommandProcessor.h"
+#include "Graphics/Processor/ShaderKeywordProcessor.h"
+#include "Util/Stopwatch.h"
 
 #include <utility>
 #include <iostream>
@@ -57,8 +60,34 @@ void main()
 )";
 
         static std::shared_ptr<ShaderProgram> s_FallbackMVPShader;
+
+        /// Whether the driver has been told to use as many compiler threads as it wants, done on the first async compilation.
+        static bool s_HasSetMaxShaderCompilerThreads = false;
+
+        bool hasParallelShaderCompile()
+        {
+            return GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+        }
     }
 
+    struct ShaderProgram::PendingCompilation
+    {
+        /// The processors are kept alive because OnPostShaderCompilation & OnEnd are only called when the compilation is finished.
+        std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> ShaderProcessors;
+        std::vector<std::pair<ShaderType, ShaderID>> CreatedShaders;
+
+        /// True if the source has failed to be parsed.
+        bool HasCompileError = false;
+        bool UseBinaryCache = false;
+        std::uint64_t BinaryCacheKey = 0;
+
+        /// Used to finish the compilation on the next poll when the driver cannot report completion.
+        bool HasBeenPolled = false;
+    };
+
+    std::vector<ShaderProgram *> ShaderProgram::s_ProgramsPendingCompilation {};
+    ShaderCompileMode ShaderProgram::s_VariantCompileMode = ShaderCompileMode::Async;
+
     /// Map the ShaderType enum to GL_(TYPE)_SHADER
     /// \param type enum ShaderType
     /// \return unsigned int (GL Shader Type)
@@ -117,20 +146,16 @@ void main()
         return false;
     }
 
-    std::shared_ptr<ShaderProgram> ShaderProgram::CreateFromFile(const std::string &name, const std::filesystem::path &filepath)
+    std::shared_ptr<ShaderProgram> ShaderProgram::CreateFromFile(const std::string &name, const std::filesystem::path &filepath,
+                                                                 ShaderCompileMode compileMode)
     {
         DYE_LOG("<< Start creating shader \"%s\" from \"%s\" -", name.c_str(), filepath.string().c_str());
+        Stopwatch const stopwatch;
 
         auto program = std::make_shared<ShaderProgram>(name);
 
         bool success = true;
 
-        // Populate shader processors!
-        std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> shaderProcessors {};
-        shaderProcessors.emplace_back(std::make_unique<ShaderProcessor::UniformPropertyProcessor>());
-        shaderProcessors.emplace_back(std::make_unique<ShaderProcessor::BlendStateCommandProcessor>());
-        shaderProcessors.emplace_back(std::make_unique<ShaderProcessor::DepthStateCommandProcessor>());
-
         if (!std::filesystem::exists(filepath))
         {
             DYE_LOG("There is no file at the given path!");
@@ -142,7 +167,7 @@ void main()
             std::string shaderProgramSource((std::istreambuf_iterator<char>(fs)),
                                             (std::istreambuf_iterator<char>()));
 
-            success = program->initializeProgramFromSource(shaderProgramSource, shaderProcessors);
+            success = program->initializeProgramFromSource(shaderProgramSource, createShaderProcessors(0), compileMode);
             if (program->HasCompileError())
             {
                 DYE_LOG("There are compile errors in the shader!");
@@ -155,26 +180,83 @@ void main()
             DYE_ASSERT(false);
 
             // We will return the fallback purple MVP shader.
-            if (!s_FallbackMVPShader)
-            {
-                DYE_LOG("<< Start creating fallback MVP shader -");
-                // If the fallback mvp shader is not loaded yet, we will do that first.
-                s_FallbackMVPShader = std::make_shared<ShaderProgram>(s_FallbackMVPShaderName);
-                s_FallbackMVPShader->initializeProgramFromSource(s_FallbackMVPShaderSource, shaderProcessors);
-            }
-
+            // If the fallback mvp shader is not loaded yet, GetFallbackShaderProgram will do that first.
+            GetFallbackShaderProgram();
             return s_FallbackMVPShader;
         }
 
-        DYE_LOG("- Successfully create shader (%d) \"%s\" from \"%s\" >>", program->m_ID, name.c_str(), filepath.string().c_str());
+        DYE_LOG("- Successfully create shader (%d) \"%s\" from \"%s\" in %.2f ms%s >>",
+                program->m_ID, name.c_str(), filepath.string().c_str(), stopwatch.GetElapsedMilliseconds(),
+                program->m_IsLoadedFromBinaryCache ? " (loaded from binary cache)" :
+                !program->IsReady() ? " (compiling asynchronously)" : "");
 
 #ifdef DYE_DEBUG
-        glObjectLabel(GL_PROGRAM, program->m_ID, -1, name.c_str());
+        if (program->m_ID != 0)
+        {
+            glObjectLabel(GL_PROGRAM, program->m_ID, -1, name.c_str());
+        }
 #endif
 
         return program;
     }
 
+    void ShaderProgram::PollPendingCompilations()
+    {
+        if (s_ProgramsPendingCompilation.empty())
+        {
+            return;
+        }
+
+        bool const canQueryCompletion = hasParallelShaderCompile();
+
+        // Finishing a compilation doesn't add or remove pending programs, it's safe to erase them while iterating.
+        std::erase_if
+            (
+                s_ProgramsPendingCompilation,
+                [canQueryCompletion](ShaderProgram *pProgram)
+                {
+                    PendingCompilation &pendingCompilation = *pProgram->m_pPendingCompilation;
+
+                    bool isCompleted;
+                    if (canQueryCompletion)
+                    {
+                        GLint completionStatus = GL_FALSE;
+                        glCall(glGetProgramiv(pProgram->m_ID, GL_COMPLETION_STATUS_KHR, &completionStatus));
+                        isCompleted = completionStatus == GL_TRUE;
+                    }
+                    else
+                    {
+                        // The driver might still compile in the background (i.e. a threaded driver),
+                        // give it a frame before blocking on the results.
+                        isCompleted = pendingCompilation.HasBeenPolled;
+                        pendingCompilation.HasBeenPolled = true;
+                    }
+
+                    if (!isCompleted)
+                    {
+                        return false;
+                    }
+
+                    bool const success = pProgram->finishCompilation();
+                    DYE_LOG("<< Finish compiling shader (%d) \"%s\" asynchronously%s >>",
+                            pProgram->m_ID, pProgram->m_Name.c_str(), success ? "" : " with compile errors");
+                    return true;
+                }
+            );
+    }
+
+    ShaderProgram &ShaderProgram::GetFallbackShaderProgram()
+    {
+        if (!s_FallbackMVPShader)
+        {
+            DYE_LOG("<< Start creating fallback MVP shader -");
+            s_FallbackMVPShader = std::make_shared<ShaderProgram>(s_FallbackMVPShaderName);
+            s_FallbackMVPShader->initializeProgramFromSource(s_FallbackMVPShaderSource, createShaderProcessors(0), ShaderCompileMode::Blocking);
+        }
+
+        return *s_FallbackMVPShader;
+    }
+
     DYE::ShaderProgram::ShaderProgram(std::string name) : m_ID(0), m_Name(std::move(name))
     {
 
@@ -182,6 +264,21 @@ void main()
 
     DYE::ShaderProgram::~ShaderProgram()
     {
+        if (m_pPendingCompilation)
+        {
+            std::erase(s_ProgramsPendingCompilation, this);
+            for (auto const &[shaderType, shaderID]: m_pPendingCompilation->CreatedShaders)
+            {
+                glDeleteShader(shaderID);
+            }
+        }
+
+        if (m_ID == 0)
+        {
+            // The program has never been created on the GPU (i.e. headless mode).
+            return;
+        }
+
         Unbind();
 
         DYE_LOG("Delete Program [%d] %s", m_ID, m_Name.c_str());
@@ -231,9 +328,71 @@ void main()
             );
     }
 
-    bool ShaderProgram::initializeProgramFromSource(std::string source, const std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> &shaderProcessors)
+    std::optional<std::uint32_t> ShaderProgram::TryGetKeywordIndex(const std::string &keyword) const
+    {
+        auto const keywordItr = std::find(m_Keywords.begin(), m_Keywords.end(), keyword);
+        if (keywordItr == m_Keywords.end())
+        {
+            return std::nullopt;
+        }
+
+        return (std::uint32_t) std::distance(m_Keywords.begin(), keywordItr);
+    }
+
+    ShaderProgram &ShaderProgram::GetVariant(ShaderKeywordMask keywordMask)
+    {
+        ShaderKeywordMask const validKeywordMask = m_Keywords.size() >= ShaderConstants::MaxNumberOfKeywords ?
+                                                   ~0u : (1u << m_Keywords.size()) - 1;
+        keywordMask &= validKeywordMask;
+
+        if (keywordMask == m_KeywordMask)
+        {
+            return *this;
+        }
+
+        auto const variantItr = m_Variants.find(keywordMask);
+        if (variantItr != m_Variants.end())
+        {
+            return *variantItr->second;
+        }
+
+        std::string variantName = m_Name + " [";
+        for (std::size_t i = 0; i < m_Keywords.size(); i++)
+        {
+            if ((keywordMask & (1u << i)) != 0)
+            {
+                variantName += " " + m_Keywords[i];
+            }
+        }
+        variantName += " ]";
+
+        DYE_LOG("<< Compile shader variant \"%s\" on first use >>", variantName.c_str());
+
+        auto variant = std::make_unique<ShaderProgram>(variantName);
+        variant->initializeProgramFromSource(m_ProgramSource, createShaderProcessors(keywordMask), s_VariantCompileMode);
+
+        ShaderProgram &variantReference = *variant;
+        m_Variants.emplace(keywordMask, std::move(variant));
+        return variantReference;
+    }
+
+    std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> ShaderProgram::createShaderProcessors(ShaderKeywordMask enabledKeywordMask)
+    {
+        std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> shaderProcessors {};
+        shaderProcessors.emplace_back(std::make_unique<ShaderProcessor::UniformPropertyProcessor>());
+        shaderProcessors.emplace_back(std::make_unique<ShaderProcessor::BlendStateCommandProcessor>());
+        shaderProcessors.emplace_back(std::make_unique<ShaderProcessor::DepthStateCommandProcessor>());
+        shaderProcessors.emplace_back(std::make_unique<ShaderProcessor::ShaderKeywordProcessor>(enabledKeywordMask));
+
+        return shaderProcessors;
+    }
+
+    bool ShaderProgram::initializeProgramFromSource(std::string source,
+                                                    std::vector<std::unique_ptr<ShaderProcessor::ShaderProcessorBase>> shaderProcessors,
+                                                    ShaderCompileMode compileMode)
     {
         bool hasCompileError = false;
+        m_ProgramSource = source;
 
         // Processors.OnBegin
         for (auto &processor: shaderProcessors)
@@ -268,58 +427,148 @@ void main()
             processor->OnPostShaderTypeParse(shaderTypeParseResult);
         }
 
+        if (!IsOpenGLLoaded())
+        {
+            // There is no graphics context to compile the shaders with (i.e. headless mode).
+            // Only the processors are run so the uniforms & render states are still reflected from the source.
+            for (auto &processor: shaderProcessors)
+            {
+                processor->OnEnd(*this);
+            }
+
+            m_HasCompileError = hasCompileError;
+            return !hasCompileError;
+        }
+
         // Create shader program on GPU
         m_ID = glCreateProgram();
         glCheckAfterCall(glCreateProgram());
 
-        // Actually compile shader(s)
-        std::vector<ShaderID> createdShaderIDs;
-        for (auto &shaderSourcePair: shaderTypeParseResult.ShaderSources)
+        // Processors.OnPreShaderCompilation
+        // The processed sources are what the compiler sees, therefore they are also used as the key of the binary cache.
+        for (auto &[shaderType, shaderSource]: shaderTypeParseResult.ShaderSources)
         {
-            auto shaderType = shaderSourcePair.first;
-            auto shaderSource = shaderSourcePair.second;
-
-            // Processors.OnPreShaderCompilation
             for (auto &processor: shaderProcessors)
             {
                 processor->OnPreShaderCompilation(shaderType, shaderSource);
             }
+        }
 
-            ShaderCompilationResult compileShaderResult = compileShaderForProgram(m_ID, shaderType, shaderSource);
-            if (compileShaderResult.Success)
+        auto pendingCompilation = std::make_unique<PendingCompilation>();
+        pendingCompilation->HasCompileError = hasCompileError;
+        pendingCompilation->UseBinaryCache = !hasCompileError && ShaderProgramBinaryCache::IsAvailable();
+        pendingCompilation->BinaryCacheKey = pendingCompilation->UseBinaryCache ? ShaderProgramBinaryCache::ComputeKey(shaderTypeParseResult.ShaderSources) : 0;
+
+        m_IsLoadedFromBinaryCache = pendingCompilation->UseBinaryCache && ShaderProgramBinaryCache::TryLoad(m_ID, pendingCompilation->BinaryCacheKey);
+        if (m_IsLoadedFromBinaryCache)
+        {
+            // Processors.OnPostShaderCompilation
+            // There is no individual shader object when the program is loaded from a binary.
+            for (auto &shaderSourcePair: shaderTypeParseResult.ShaderSources)
+            {
+                ShaderCompilationResult compileShaderResult {.Success = true, .CompiledShaderID = 0};
+                for (auto &processor: shaderProcessors)
+                {
+                    processor->OnPostShaderCompilation(shaderSourcePair.first, compileShaderResult);
+                }
+            }
+
+            // Processors.OnEnd
+            for (auto &processor: shaderProcessors)
+            {
+                processor->OnEnd(*this);
+            }
+
+            m_HasCompileError = false;
+            return true;
+        }
+
+        if (compileMode == ShaderCompileMode::Async && !s_HasSetMaxShaderCompilerThreads)
+        {
+            // 0xFFFFFFFF lets the driver pick the number of background compiler threads (0 is the default on some drivers, which disables them).
+            if (GLAD_GL_KHR_parallel_shader_compile)
             {
-                glCall(glAttachShader(m_ID, compileShaderResult.CompiledShaderID));
-                createdShaderIDs.push_back(compileShaderResult.CompiledShaderID);
+                glCall(glMaxShaderCompilerThreadsKHR(0xFFFFFFFF));
             }
-            else
+            else if (GLAD_GL_ARB_parallel_shader_compile)
+            {
+                glCall(glMaxShaderCompilerThreadsARB(0xFFFFFFFF));
+            }
+            s_HasSetMaxShaderCompilerThreads = true;
+        }
+
+        // Issue the compilation of the shaders & the link of the program, the results are not queried until finishCompilation.
+        for (auto const &[shaderType, shaderSource]: shaderTypeParseResult.ShaderSources)
+        {
+            ShaderID const shaderID = issueShaderCompilation(shaderType, shaderSource);
+            glCall(glAttachShader(m_ID, shaderID));
+            pendingCompilation->CreatedShaders.emplace_back(shaderType, shaderID);
+        }
+
+        if (pendingCompilation->UseBinaryCache)
+        {
+            // The hint has to be set before linking, otherwise the binary might not be retrievable.
+            glCall(glProgramParameteri(m_ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+        }
+
+        // Link the shaders specified by m_ID with the corresponding GPU processors
+        glCall(glLinkProgram(m_ID));
+
+        pendingCompilation->ShaderProcessors = std::move(shaderProcessors);
+        m_pPendingCompilation = std::move(pendingCompilation);
+
+        if (compileMode == ShaderCompileMode::Blocking)
+        {
+            return finishCompilation();
+        }
+
+        s_ProgramsPendingCompilation.push_back(this);
+        return true;
+    }
+
+    bool ShaderProgram::finishCompilation()
+    {
+        PendingCompilation &pendingCompilation = *m_pPendingCompilation;
+        bool hasCompileError = pendingCompilation.HasCompileError;
+
+        for (auto const &[shaderType, shaderID]: pendingCompilation.CreatedShaders)
+        {
+            ShaderCompilationResult compileShaderResult = checkShaderCompilation(shaderType, shaderID);
+            if (!compileShaderResult.Success)
             {
                 /// Compile error!
                 hasCompileError = true;
             }
 
             // Processors.OnPostShaderCompilation
-            for (auto &processor: shaderProcessors)
+            for (auto &processor: pendingCompilation.ShaderProcessors)
             {
                 processor->OnPostShaderCompilation(shaderType, compileShaderResult);
             }
         }
 
-        // Link the shaders specified by m_ID with the corresponding GPU processors
-        glCall(glLinkProgram(m_ID));
         glCall(glValidateProgram(m_ID));
 
         // Clean up shaders
-        for (auto shaderID: createdShaderIDs)
+        for (auto const &[shaderType, shaderID]: pendingCompilation.CreatedShaders)
         {
             glCall(glDeleteShader(shaderID));
         }
 
+        GLint linkStatus = GL_FALSE;
+        glCall(glGetProgramiv(m_ID, GL_LINK_STATUS, &linkStatus));
+        if (pendingCompilation.UseBinaryCache && !hasCompileError && linkStatus == GL_TRUE)
+        {
+            ShaderProgramBinaryCache::Store(m_ID, pendingCompilation.BinaryCacheKey);
+        }
+
         // Processors.OnEnd
-        for (auto &processor: shaderProcessors)
+        for (auto &processor: pendingCompilation.ShaderProcessors)
         {
             processor->OnEnd(*this);
         }
 
+        m_pPendingCompilation.reset();
         m_HasCompileError = hasCompileError;
         return !hasCompileError;
     }
@@ -412,18 +661,21 @@ void main()
         return ShaderTypeParseResult {.Success = !hasParseError, .ShaderSources = std::move(shaderSources)};
     }
 
-    ShaderProgram::ShaderCompilationResult ShaderProgram::compileShaderForProgram(DYE::ShaderProgramID programId, DYE::ShaderType type, const std::string &source)
+    ShaderID ShaderProgram::issueShaderCompilation(ShaderType type, const std::string &source)
     {
-        ShaderID shaderID = 0;
-
         const char *shaderSource = source.c_str();
 
         unsigned int const glShaderType = ShaderTypeEnumToGLShaderType(type);
 
-        shaderID = glCreateShader(glShaderType);
+        ShaderID const shaderID = glCreateShader(glShaderType);
         glCall(glShaderSource(shaderID, 1, &shaderSource, nullptr));
         glCall(glCompileShader(shaderID));
 
+        return shaderID;
+    }
+
+    ShaderProgram::ShaderCompilationResult ShaderProgram::checkShaderCompilation(ShaderType type, ShaderID shaderID)
+    {
         int compileResult;
         glCall(glGetShaderiv(shaderID, GL_COMPILE_STATUS, &compileResult));
         if (compileResult == GL_FALSE)
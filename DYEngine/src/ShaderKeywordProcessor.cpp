@@ -0,0 +1,105 @@
+#include "Graphics/Processor/ShaderKeywordProcessor.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+namespace DYE::ShaderProcessor
+{
+    void ShaderKeywordProcessor::OnBegin(ShaderProgram &shaderProgram)
+    {
+        m_KeywordsCache.clear();
+    }
+
+    void ShaderKeywordProcessor::OnPreShaderTypeParse(std::string &programSource)
+    {
+        std::stringstream stream(programSource);
+        std::stringstream processedStream;
+
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            std::stringstream lineStream(line);
+            std::string directive;
+            std::string pragmaName;
+            lineStream >> directive >> pragmaName;
+
+            if (directive != PragmaDirective || pragmaName != KeywordsPragmaName)
+            {
+                processedStream << line << '\n';
+                continue;
+            }
+
+            std::string keyword;
+            while (lineStream >> keyword)
+            {
+                if (std::find(m_KeywordsCache.begin(), m_KeywordsCache.end(), keyword) != m_KeywordsCache.end())
+                {
+                    continue;
+                }
+
+                if (m_KeywordsCache.size() >= ShaderConstants::MaxNumberOfKeywords)
+                {
+                    DYE_LOG("A shader cannot have more than %d keywords, keyword '%s' is ignored.", ShaderConstants::MaxNumberOfKeywords, keyword.c_str());
+                    continue;
+                }
+
+                m_KeywordsCache.push_back(keyword);
+            }
+
+            // Keep an empty line so the line numbers in the compile errors stay the same.
+            processedStream << '\n';
+        }
+
+        programSource = processedStream.str();
+    }
+
+    void ShaderKeywordProcessor::OnPreShaderCompilation(ShaderType shaderType, std::string &shaderSource)
+    {
+        std::string defines;
+        for (std::size_t i = 0; i < m_KeywordsCache.size(); i++)
+        {
+            if ((m_EnabledKeywordMask & (1u << i)) != 0)
+            {
+                defines += "#define " + m_KeywordsCache[i] + "\n";
+            }
+        }
+
+        if (defines.empty())
+        {
+            return;
+        }
+
+        // '#version' has to be the first directive in GLSL, the defines are inserted right after it.
+        std::size_t insertPosition = 0;
+        std::size_t const versionPosition = shaderSource.find("#version");
+        if (versionPosition != std::string::npos)
+        {
+            std::size_t const versionLineEnd = shaderSource.find('\n', versionPosition);
+            if (versionLineEnd == std::string::npos)
+            {
+                shaderSource += '\n';
+                insertPosition = shaderSource.size();
+            }
+            else
+            {
+                insertPosition = versionLineEnd + 1;
+            }
+        }
+
+        // Restore the line numbering of the source after the defines, so the compile errors point at the original lines.
+        // Since GLSL 3.30, '#line N' makes the line that follows the directive line N.
+        auto const nextLineNumber = std::count(shaderSource.begin(), shaderSource.begin() + insertPosition, '\n') + 1;
+        defines += "#line " + std::to_string(nextLineNumber) + "\n";
+
+        shaderSource.insert(insertPosition, defines);
+    }
+
+    void ShaderKeywordProcessor::OnEnd(ShaderProgram &shaderProgram)
+    {
+        ShaderKeywordMask const validKeywordMask = m_KeywordsCache.size() >= ShaderConstants::MaxNumberOfKeywords ?
+                                                   ~0u : (1u << m_KeywordsCache.size()) - 1;
+
+        shaderProgram.setKeywords(m_KeywordsCache, m_EnabledKeywordMask & validKeywordMask);
+    }
+}
@@ -0,0 +1,211 @@
+#include "Graphics/ShaderProgramBinaryCache.h"
+#include "Graphics/OpenGL.h"
+#include "FileSystem/FileSystem.h"
+#include "Util/Macro.h"
+
+#include <glad/glad.h>
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+
+namespace DYE
+{
+    namespace
+    {
+        constexpr std::array<char, 4> ShaderBinaryMagic = {'D', 'Y', 'S', 'B'};
+
+        /// Increase the version whenever the file layout or the key changes, so the old binaries are invalidated.
+        constexpr std::uint32_t ShaderBinaryVersion = 1;
+
+        struct ShaderBinaryFileHeader
+        {
+            std::array<char, 4> Magic;
+            std::uint32_t Version;
+            std::uint64_t Key;
+            std::uint32_t BinaryFormat;
+            std::uint32_t BinarySize;
+        };
+
+        constexpr std::uint64_t FNV1aOffsetBasis = 14695981039346656037ull;
+        constexpr std::uint64_t FNV1aPrime = 1099511628211ull;
+
+        std::uint64_t hashBytes(std::uint64_t hash, void const *pData, std::size_t size)
+        {
+            auto const *pBytes = static_cast<std::uint8_t const *>(pData);
+            for (std::size_t i = 0; i < size; i++)
+            {
+                hash ^= pBytes[i];
+                hash *= FNV1aPrime;
+            }
+
+            return hash;
+        }
+
+        std::uint64_t hashGLString(std::uint64_t hash, GLenum name)
+        {
+            auto const *pString = reinterpret_cast<char const *>(glGetString(name));
+            if (pString == nullptr)
+            {
+                return hash;
+            }
+
+            return hashBytes(hash, pString, std::char_traits<char>::length(pString));
+        }
+    }
+
+    std::filesystem::path ShaderProgramBinaryCache::s_CacheDirectory = std::filesystem::path("Cache") / "ShaderBinaries";
+    ShaderProgramBinaryCacheStatistics ShaderProgramBinaryCache::s_Statistics {};
+
+    bool ShaderProgramBinaryCache::IsAvailable()
+    {
+        if (s_CacheDirectory.empty() || !IsOpenGLLoaded())
+        {
+            return false;
+        }
+
+        static GLint const numberOfBinaryFormats = []()
+        {
+            GLint numberOfFormats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numberOfFormats);
+            return numberOfFormats;
+        }();
+
+        return numberOfBinaryFormats > 0;
+    }
+
+    void ShaderProgramBinaryCache::Clear()
+    {
+        std::error_code errorCode;
+        if (!std::filesystem::is_directory(s_CacheDirectory, errorCode))
+        {
+            return;
+        }
+
+        for (auto const &directoryEntry: std::filesystem::directory_iterator(s_CacheDirectory, errorCode))
+        {
+            if (directoryEntry.path().extension() == BinaryExtension)
+            {
+                std::filesystem::remove(directoryEntry.path(), errorCode);
+            }
+        }
+    }
+
+    std::uint64_t ShaderProgramBinaryCache::ComputeKey(std::vector<std::pair<ShaderType, std::string>> const &shaderSources)
+    {
+        std::uint64_t hash = FNV1aOffsetBasis;
+        hash = hashBytes(hash, &ShaderBinaryVersion, sizeof(ShaderBinaryVersion));
+
+        // A driver is only guaranteed to accept the binaries produced by itself.
+        hash = hashGLString(hash, GL_VENDOR);
+        hash = hashGLString(hash, GL_RENDERER);
+        hash = hashGLString(hash, GL_VERSION);
+
+        for (auto const &[shaderType, source]: shaderSources)
+        {
+            auto const shaderTypeValue = (std::uint32_t) shaderType;
+            hash = hashBytes(hash, &shaderTypeValue, sizeof(shaderTypeValue));
+            hash = hashBytes(hash, source.data(), source.size());
+        }
+
+        return hash;
+    }
+
+    bool ShaderProgramBinaryCache::TryLoad(ShaderProgramID programID, std::uint64_t key)
+    {
+        std::filesystem::path const binaryPath = getBinaryPath(key);
+        if (!FileSystem::FileExists(binaryPath))
+        {
+            s_Statistics.NumberOfMisses++;
+            return false;
+        }
+
+        std::ifstream file(binaryPath, std::ios::binary);
+        ShaderBinaryFileHeader header {};
+        file.read(reinterpret_cast<char *>(&header), sizeof(header));
+        if (!file || header.Magic != ShaderBinaryMagic || header.Version != ShaderBinaryVersion || header.Key != key)
+        {
+            s_Statistics.NumberOfMisses++;
+            return false;
+        }
+
+        std::vector<char> binary(header.BinarySize);
+        file.read(binary.data(), (std::streamsize) binary.size());
+        if (!file)
+        {
+            s_Statistics.NumberOfMisses++;
+            return false;
+        }
+
+        glProgramBinary(programID, header.BinaryFormat, binary.data(), (GLsizei) binary.size());
+
+        // The driver is allowed to reject any binary, in which case the program has to be compiled from source.
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(programID, GL_LINK_STATUS, &linkStatus);
+        if (linkStatus == GL_FALSE)
+        {
+            DYE_LOG("Shader program binary \"%s\" is rejected by the driver, fallback to source compilation.", binaryPath.string().c_str());
+            s_Statistics.NumberOfMisses++;
+            return false;
+        }
+
+        s_Statistics.NumberOfHits++;
+        return true;
+    }
+
+    bool ShaderProgramBinaryCache::Store(ShaderProgramID programID, std::uint64_t key)
+    {
+        GLint binarySize = 0;
+        glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+        if (binarySize <= 0)
+        {
+            return false;
+        }
+
+        std::vector<char> binary(binarySize);
+        GLenum binaryFormat = 0;
+        GLsizei writtenSize = 0;
+        glCall(glGetProgramBinary(programID, binarySize, &writtenSize, &binaryFormat, binary.data()));
+        if (writtenSize <= 0)
+        {
+            return false;
+        }
+
+        std::error_code errorCode;
+        std::filesystem::create_directories(s_CacheDirectory, errorCode);
+
+        std::filesystem::path const binaryPath = getBinaryPath(key);
+        std::ofstream file(binaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            DYE_LOG("Failed to open \"%s\" to write shader program binary.", binaryPath.string().c_str());
+            return false;
+        }
+
+        ShaderBinaryFileHeader const header
+            {
+                .Magic = ShaderBinaryMagic,
+                .Version = ShaderBinaryVersion,
+                .Key = key,
+                .BinaryFormat = binaryFormat,
+                .BinarySize = (std::uint32_t) writtenSize
+            };
+
+        file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        file.write(binary.data(), writtenSize);
+        if (!file.good())
+        {
+            return false;
+        }
+
+        s_Statistics.NumberOfStores++;
+        return true;
+    }
+
+    std::filesystem::path ShaderProgramBinaryCache::getBinaryPath(std::uint64_t key)
+    {
+        std::array<char, 17> keyString {};
+        std::snprintf(keyString.data(), keyString.size(), "%016llx", (unsigned long long) key);
+        return s_CacheDirectory / (std::string(keyString.data()) + BinaryExtension);
+    }
+}
@@ -0,0 +1,23 @@
+#include "Util/Stopwatch.h"
+
+namespace DYE
+{
+    Stopwatch::Stopwatch() : m_StartTimePoint(std::chrono::steady_clock::now())
+    {
+    }
+
+    void Stopwatch::Restart()
+    {
+        m_StartTimePoint = std::chrono::steady_clock::now();
+    }
+
+    double Stopwatch::GetElapsedSeconds() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTimePoint).count();
+    }
+
+    double Stopwatch::GetElapsedMilliseconds() const
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_StartTimePoint).count();
+    }
+}
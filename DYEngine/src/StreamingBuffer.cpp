@@ -0,0 +1,128 @@
+#include "Graphics/StreamingBuffer.h"
+#include "Graphics/OpenGL.h"
+#include "Util/Macro.h"
+
+namespace DYE
+{
+    std::shared_ptr<StreamingBuffer> StreamingBuffer::Create(std::uint32_t capacityPerFrame)
+    {
+        return std::make_shared<StreamingBuffer>(capacityPerFrame);
+    }
+
+    StreamingBuffer::StreamingBuffer(std::uint32_t capacityPerFrame) : m_CapacityPerFrame(capacityPerFrame)
+    {
+        std::uint32_t const totalSize = capacityPerFrame * NumberOfFramesInFlight;
+        if (!IsOpenGLLoaded())
+        {
+            // Headless, allocations are written into CPU memory that is never read.
+            m_HeadlessStorage.resize(totalSize);
+            m_pMappedData = m_HeadlessStorage.data();
+            return;
+        }
+
+        GLbitfield const flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCall(glCreateBuffers(1, &m_ID));
+        glCall(glNamedBufferStorage(m_ID, totalSize, nullptr, flags));
+        m_pMappedData = static_cast<std::uint8_t *>(glMapNamedBufferRange(m_ID, 0, totalSize, flags));
+        DYE_ASSERT_LOG_WARN(m_pMappedData != nullptr, "Failed to persistently map the streaming buffer (%u bytes).", totalSize);
+    }
+
+    StreamingBuffer::~StreamingBuffer()
+    {
+        if (m_ID == 0)
+        {
+            return;
+        }
+
+        for (GLsync &fence: m_Fences)
+        {
+            if (fence != nullptr)
+            {
+                glDeleteSync(fence);
+                fence = nullptr;
+            }
+        }
+
+        glUnmapNamedBuffer(m_ID);
+        glDeleteBuffers(1, &m_ID);
+    }
+
+    void StreamingBuffer::BeginFrame()
+    {
+        DYE_ASSERT_LOG_WARN(!m_IsInFrame, "StreamingBuffer::BeginFrame is called twice without calling EndFrame.");
+
+        GLsync &fence = m_Fences[m_FrameIndex];
+        if (fence != nullptr)
+        {
+            // Flush on the first wait so the fence is guaranteed to be signaled eventually.
+            GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            while (true)
+            {
+                GLenum const waitResult = glClientWaitSync(fence, waitFlags, 1'000'000);
+                if (waitResult == GL_ALREADY_SIGNALED || waitResult == GL_CONDITION_SATISFIED || waitResult == GL_WAIT_FAILED)
+                {
+                    break;
+                }
+                waitFlags = 0;
+            }
+
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        m_Cursor = 0;
+        m_IsInFrame = true;
+    }
+
+    void StreamingBuffer::EndFrame()
+    {
+        DYE_ASSERT_LOG_WARN(m_IsInFrame, "StreamingBuffer::EndFrame is called without calling BeginFrame.");
+
+        if (m_ID != 0)
+        {
+            m_Fences[m_FrameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+
+        m_FrameIndex = (m_FrameIndex + 1) % NumberOfFramesInFlight;
+        m_IsInFrame = false;
+    }
+
+    StreamingBufferAllocation StreamingBuffer::Allocate(std::uint32_t size, std::uint32_t alignment)
+    {
+        if (!m_IsInFrame || m_pMappedData == nullptr || alignment == 0)
+        {
+            return {};
+        }
+
+        // Align the absolute offset (instead of the offset within the region), so that it can be divided by a stride directly.
+        std::uint32_t const regionStart = m_FrameIndex * m_CapacityPerFrame;
+        std::uint32_t const unalignedOffset = regionStart + m_Cursor;
+        std::uint32_t const alignedOffset = ((unalignedOffset + alignment - 1) / alignment) * alignment;
+
+        if (alignedOffset + size > regionStart + m_CapacityPerFrame)
+        {
+            return {};
+        }
+
+        m_Cursor = alignedOffset + size - regionStart;
+
+        return StreamingBufferAllocation
+            {
+                .pData = m_pMappedData + alignedOffset,
+                .Offset = alignedOffset,
+                .Size = size
+            };
+    }
+
+    std::shared_ptr<VertexBuffer> StreamingBuffer::CreateVertexBufferView(VertexLayout const &layout) const
+    {
+        auto vertexBuffer = std::make_shared<VertexBuffer>(BufferViewTag {}, m_ID);
+        vertexBuffer->SetLayout(layout);
+        return vertexBuffer;
+    }
+
+    std::shared_ptr<IndexBuffer> StreamingBuffer::CreateIndexBufferView() const
+    {
+        return std::make_shared<IndexBuffer>(BufferViewTag {}, m_ID);
+    }
+}
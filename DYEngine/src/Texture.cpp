@@ -1,4 +1,5 @@
 #include "Graphics/Texture.h"
+#include "Graphics/TextureCooker.h"
 #include "Graphics/OpenGL.h"
 #include "Util/Macro.h"
 
@@ -14,6 +15,11 @@ namespace DYE
         // TODO: add per axis (u, v) settings.
 
         auto id = GetID();
+        if (id == 0)
+        {
+            return;
+        }
+
         switch (wrapMode)
         {
             case WrapMode::Repeat:
@@ -32,6 +38,11 @@ namespace DYE
         // TODO: add per min/mag filter settings.
 
         auto id = GetID();
+        if (id == 0)
+        {
+            return;
+        }
+
         switch (filterMode)
         {
             case FilterMode::Nearest:
@@ -48,6 +59,11 @@ namespace DYE
     void Texture::SetDebugLabel(const std::string &name)
     {
 #ifdef DYE_DEBUG
+        if (GetID() == 0)
+        {
+            return;
+        }
+
         glObjectLabel(GL_TEXTURE, GetID(), -1, name.c_str());
 #endif
     }
@@ -112,6 +128,11 @@ namespace DYE
         return std::move(texture);
     }
 
+    std::shared_ptr<Texture2D> Texture2D::Create(CookedTexture const &cookedTexture)
+    {
+        return std::make_shared<Texture2D>(cookedTexture);
+    }
+
     std::shared_ptr<Texture2D> Texture2D::GetWhiteTexture()
     {
         static std::shared_ptr<Texture2D> const whiteTexture = Create(glm::vec4 {1, 1, 1, 1});
@@ -129,6 +150,12 @@ namespace DYE
         m_InternalFormat = GL_RGBA8;
         m_DataFormat = GL_RGBA;
 
+        if (!IsOpenGLLoaded())
+        {
+            // Headless mode: only keep the dimensions of the texture, so that the CPU side logic (i.e. sprite scale) still works.
+            return;
+        }
+
         glCall(glCreateTextures(GL_TEXTURE_2D, 1, &m_ID));
         DYE_LOG("Create Texture (%d), %d x %d", m_ID, width, height);
         glTextureStorage2D(m_ID, 1, m_InternalFormat, m_Width, m_Height);
@@ -141,6 +168,20 @@ namespace DYE
 
     Texture2D::Texture2D(const std::filesystem::path &path) : m_Path(path)
     {
+        if (path.extension() == TextureCooker::CookedTextureExtension)
+        {
+            std::optional<CookedTexture> const cookedTexture = TextureCooker::ReadCookedTexture(path);
+            if (!cookedTexture.has_value())
+            {
+                DYE_LOG("Failed to load cooked texture \"%s\"!", path.string().c_str());
+                DYE_ASSERT(false);
+                return;
+            }
+
+            initializeFromCookedTexture(cookedTexture.value());
+            return;
+        }
+
         int width, height, channels;
 
         stbi_set_flip_vertically_on_load(1);
@@ -173,6 +214,13 @@ namespace DYE
             m_DataFormat = GL_RGBA;
         }
 
+        if (!IsOpenGLLoaded())
+        {
+            // Headless mode: only keep the dimensions of the texture, so that the CPU side logic (i.e. sprite scale) still works.
+            stbi_image_free(data);
+            return;
+        }
+
         glCreateTextures(GL_TEXTURE_2D, 1, &m_ID);
 
         glTextureParameteri(m_ID, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -200,8 +248,70 @@ namespace DYE
         stbi_image_free(data);
     }
 
+    Texture2D::Texture2D(CookedTexture const &cookedTexture)
+    {
+        initializeFromCookedTexture(cookedTexture);
+    }
+
+    void Texture2D::initializeFromCookedTexture(CookedTexture const &cookedTexture)
+    {
+        m_Width = cookedTexture.Width;
+        m_Height = cookedTexture.Height;
+        m_DataFormat = GL_RGBA;
+        switch (cookedTexture.Format)
+        {
+            case CookedTextureFormat::RGBA8:
+                m_InternalFormat = GL_RGBA8;
+                break;
+            case CookedTextureFormat::BC1:
+                m_InternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+                break;
+            case CookedTextureFormat::BC3:
+                m_InternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+                break;
+        }
+
+        if (!IsOpenGLLoaded() || cookedTexture.MipLevels.empty())
+        {
+            // Headless mode: only keep the dimensions of the texture, so that the CPU side logic (i.e. sprite scale) still works.
+            return;
+        }
+
+        GLsizei const numberOfMipLevels = (GLsizei) cookedTexture.MipLevels.size();
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_ID);
+
+        glTextureParameteri(m_ID, GL_TEXTURE_MIN_FILTER, numberOfMipLevels > 1 ? GL_NEAREST_MIPMAP_LINEAR : GL_NEAREST);
+        glTextureParameteri(m_ID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_ID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(m_ID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureParameteri(m_ID, GL_TEXTURE_MAX_LEVEL, numberOfMipLevels - 1);
+
+        glTextureStorage2D(m_ID, numberOfMipLevels, m_InternalFormat, m_Width, m_Height);
+        for (GLint level = 0; level < numberOfMipLevels; level++)
+        {
+            CookedTexture::MipLevel const &mipLevel = cookedTexture.MipLevels[level];
+            void const *pData = cookedTexture.Data.data() + mipLevel.Offset;
+            if (cookedTexture.Format == CookedTextureFormat::RGBA8)
+            {
+                glTextureSubImage2D(m_ID, level, 0, 0, mipLevel.Width, mipLevel.Height, m_DataFormat, GL_UNSIGNED_BYTE, pData);
+            }
+            else
+            {
+                glCompressedTextureSubImage2D(m_ID, level, 0, 0, mipLevel.Width, mipLevel.Height, m_InternalFormat, (GLsizei) mipLevel.Size, pData);
+            }
+        }
+
+        DYE_LOG("Create texture (%d) from cooked texture\n\tDimension - %d x %d\n\tMip Levels - %d", m_ID, m_Width, m_Height, numberOfMipLevels);
+    }
+
     Texture2D::~Texture2D()
     {
+        if (m_ID == 0)
+        {
+            return;
+        }
+
         glDeleteTextures(1, &m_ID);
     }
 
@@ -213,6 +323,11 @@ namespace DYE
 
     void Texture2D::SetData(void *data, std::uint32_t size)
     {
+        if (m_ID == 0)
+        {
+            return;
+        }
+
         glTextureSubImage2D(m_ID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
     }
 
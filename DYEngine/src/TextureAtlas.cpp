@@ -0,0 +1,48 @@
+#include "Graphics/TextureAtlas.h"
+
+#include <algorithm>
+
+namespace DYE
+{
+    std::shared_ptr<TextureAtlas> TextureAtlas::Create(std::shared_ptr<Texture2D> texture, std::vector<TextureAtlasRegion> regions)
+    {
+        return std::make_shared<TextureAtlas>(std::move(texture), std::move(regions));
+    }
+
+    TextureAtlas::TextureAtlas(std::shared_ptr<Texture2D> texture, std::vector<TextureAtlasRegion> regions) :
+        m_Texture(std::move(texture)), m_Regions(std::move(regions))
+    {
+    }
+
+    TextureAtlasRegion const *TextureAtlas::TryGetRegion(std::string const &name) const
+    {
+        auto const regionItr = std::find_if
+            (
+                m_Regions.begin(),
+                m_Regions.end(),
+                [&name](TextureAtlasRegion const &region)
+                {
+                    return region.Name == name;
+                }
+            );
+
+        if (regionItr == m_Regions.end())
+        {
+            return nullptr;
+        }
+
+        return &(*regionItr);
+    }
+
+    glm::vec4 TextureAtlas::GetRegionTilingOffset(TextureAtlasRegion const &region) const
+    {
+        float const width = (float) m_Texture->GetWidth();
+        float const height = (float) m_Texture->GetHeight();
+        if (width == 0 || height == 0)
+        {
+            return {1, 1, 0, 0};
+        }
+
+        return {(float) region.Width / width, (float) region.Height / height, (float) region.X / width, (float) region.Y / height};
+    }
+}
@@ -0,0 +1,228 @@
+#include "Graphics/TextureAtlasPacker.h"
+#include "Util/Macro.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+namespace DYE
+{
+    std::vector<TextureAtlasPacker::PackedRect>
+    TextureAtlasPacker::PackRects(std::vector<glm::u32vec2> const &sizes, TextureAtlasPackerSettings const &settings)
+    {
+        std::vector<PackedRect> packedRects(sizes.size());
+
+        // Place the tallest rects first, so that the height of each shelf is mostly filled.
+        std::vector<std::size_t> orderedIndices(sizes.size());
+        std::iota(orderedIndices.begin(), orderedIndices.end(), 0);
+        std::stable_sort
+            (
+                orderedIndices.begin(),
+                orderedIndices.end(),
+                [&sizes](std::size_t indexA, std::size_t indexB)
+                {
+                    if (sizes[indexA].y != sizes[indexB].y)
+                    {
+                        return sizes[indexA].y > sizes[indexB].y;
+                    }
+
+                    return sizes[indexA].x > sizes[indexB].x;
+                }
+            );
+
+        std::uint32_t const padding = settings.Padding;
+        std::uint32_t const maxX = settings.PageWidth > padding ? settings.PageWidth - padding : 0;
+        std::uint32_t const maxY = settings.PageHeight > padding ? settings.PageHeight - padding : 0;
+
+        std::uint32_t pageIndex = 0;
+        std::uint32_t cursorX = padding;
+        std::uint32_t cursorY = padding;
+        std::uint32_t shelfHeight = 0;
+        bool isPageEmpty = true;
+
+        for (std::size_t const index: orderedIndices)
+        {
+            glm::u32vec2 const size = sizes[index];
+            if (padding + size.x > maxX || padding + size.y > maxY)
+            {
+                DYE_LOG("The rect (%d x %d) is too large to fit in an atlas page (%d x %d).", size.x, size.y, settings.PageWidth, settings.PageHeight);
+                continue;
+            }
+
+            if (cursorX + size.x > maxX)
+            {
+                // Start a new shelf on top of the current one.
+                cursorX = padding;
+                cursorY += shelfHeight + padding;
+                shelfHeight = 0;
+            }
+
+            if (cursorY + size.y > maxY)
+            {
+                // Start a new page.
+                if (!isPageEmpty)
+                {
+                    pageIndex++;
+                }
+                cursorX = padding;
+                cursorY = padding;
+                shelfHeight = 0;
+            }
+
+            packedRects[index] = PackedRect {.PageIndex = pageIndex, .X = cursorX, .Y = cursorY};
+            isPageEmpty = false;
+
+            cursorX += size.x + padding;
+            shelfHeight = std::max(shelfHeight, size.y);
+        }
+
+        return packedRects;
+    }
+
+    std::vector<TextureAtlasPage> TextureAtlasPacker::PackFolder(std::filesystem::path const &folderPath, TextureAtlasPackerSettings const &settings)
+    {
+        struct LoadedImage
+        {
+            std::string Name;
+            glm::u32vec2 Size;
+            stbi_uc *pData;
+        };
+
+        static constexpr std::array<char const *, 6> imageExtensions = {".png", ".jpg", ".jpeg", ".tga", ".bmp", ".psd"};
+
+        std::error_code errorCode;
+        if (!std::filesystem::is_directory(folderPath, errorCode))
+        {
+            DYE_LOG("Failed to pack texture atlas, \"%s\" is not a folder.", folderPath.string().c_str());
+            return {};
+        }
+
+        // Sort the paths so the output is the same on every platform.
+        std::vector<std::filesystem::path> imagePaths;
+        for (auto const &directoryEntry: std::filesystem::directory_iterator(folderPath))
+        {
+            if (!directoryEntry.is_regular_file())
+            {
+                continue;
+            }
+
+            std::string const extension = directoryEntry.path().extension().string();
+            bool const isImage = std::any_of(imageExtensions.begin(), imageExtensions.end(), [&extension](char const *imageExtension) { return extension == imageExtension; });
+            if (isImage)
+            {
+                imagePaths.push_back(directoryEntry.path());
+            }
+        }
+        std::sort(imagePaths.begin(), imagePaths.end());
+
+        // Load the images the same way Texture2D does (flipped vertically), so the rows are stored from bottom to top.
+        std::vector<LoadedImage> images;
+        std::vector<glm::u32vec2> sizes;
+        images.reserve(imagePaths.size());
+        sizes.reserve(imagePaths.size());
+
+        stbi_set_flip_vertically_on_load(1);
+        for (auto const &imagePath: imagePaths)
+        {
+            int width, height, channels;
+            stbi_uc *pData = stbi_load(imagePath.string().c_str(), &width, &height, &channels, 4);
+            if (pData == nullptr)
+            {
+                DYE_LOG("Failed to load image \"%s\" for texture atlas, skipped.", imagePath.string().c_str());
+                continue;
+            }
+
+            images.push_back(LoadedImage {.Name = imagePath.stem().string(), .Size = {(std::uint32_t) width, (std::uint32_t) height}, .pData = pData});
+            sizes.push_back(images.back().Size);
+        }
+
+        std::vector<PackedRect> const packedRects = PackRects(sizes, settings);
+
+        std::vector<TextureAtlasPage> pages;
+        for (std::size_t i = 0; i < images.size(); i++)
+        {
+            LoadedImage const &image = images[i];
+            PackedRect const &packedRect = packedRects[i];
+            if (packedRect.PageIndex == InvalidPageIndex)
+            {
+                stbi_image_free(image.pData);
+                continue;
+            }
+
+            while (pages.size() <= packedRect.PageIndex)
+            {
+                TextureAtlasPage &newPage = pages.emplace_back();
+                newPage.Width = settings.PageWidth;
+                newPage.Height = settings.PageHeight;
+                newPage.Pixels.resize((std::size_t) settings.PageWidth * settings.PageHeight * 4, 0);
+            }
+
+            TextureAtlasPage &page = pages[packedRect.PageIndex];
+            for (std::uint32_t row = 0; row < image.Size.y; row++)
+            {
+                std::size_t const sourceOffset = (std::size_t) row * image.Size.x * 4;
+                std::size_t const destinationOffset = ((std::size_t) (packedRect.Y + row) * page.Width + packedRect.X) * 4;
+                std::memcpy(page.Pixels.data() + destinationOffset, image.pData + sourceOffset, (std::size_t) image.Size.x * 4);
+            }
+
+            page.Regions.push_back
+                (
+                    TextureAtlasRegion
+                        {
+                            .Name = image.Name,
+                            .X = packedRect.X,
+                            .Y = packedRect.Y,
+                            .Width = image.Size.x,
+                            .Height = image.Size.y
+                        }
+                );
+
+            stbi_image_free(image.pData);
+        }
+
+        DYE_LOG("Packed %zu images from \"%s\" into %zu atlas page(s).", images.size(), folderPath.string().c_str(), pages.size());
+        return pages;
+    }
+
+    bool TextureAtlasPacker::WritePageImageToTGA(TextureAtlasPage const &page, std::filesystem::path const &path)
+    {
+        if (page.Width > std::numeric_limits<std::uint16_t>::max() || page.Height > std::numeric_limits<std::uint16_t>::max())
+        {
+            DYE_LOG("The atlas page (%d x %d) is too large for a TGA image.", page.Width, page.Height);
+            return false;
+        }
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            DYE_LOG("Failed to open \"%s\" to write atlas page.", path.string().c_str());
+            return false;
+        }
+
+        // Uncompressed true-color image, 32 bits per pixel with 8 alpha bits, the origin is at the bottom-left corner.
+        std::array<std::uint8_t, 18> header {};
+        header[2] = 2;
+        header[12] = page.Width & 0xFF;
+        header[13] = (page.Width >> 8) & 0xFF;
+        header[14] = page.Height & 0xFF;
+        header[15] = (page.Height >> 8) & 0xFF;
+        header[16] = 32;
+        header[17] = 8;
+        file.write(reinterpret_cast<char const *>(header.data()), header.size());
+
+        // TGA stores the pixels in BGRA order.
+        std::vector<std::uint8_t> pixels(page.Pixels);
+        for (std::size_t i = 0; i + 3 < pixels.size(); i += 4)
+        {
+            std::swap(pixels[i], pixels[i + 2]);
+        }
+        file.write(reinterpret_cast<char const *>(pixels.data()), (std::streamsize) pixels.size());
+
+        return file.good();
+    }
+}
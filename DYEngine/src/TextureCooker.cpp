@@ -0,0 +1,453 @@
+#include "Graphics/TextureCooker.h"
+#include "FileSystem/FileSystem.h"
+#include "Util/Macro.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace DYE
+{
+    namespace
+    {
+        constexpr std::array<char, 4> CookedTextureMagic = {'D', 'Y', 'T', 'X'};
+
+        /// Increase the version whenever the file layout or the encoders change, so the old cooked textures are invalidated.
+        constexpr std::uint32_t CookedTextureVersion = 1;
+
+        struct CookedTextureFileHeader
+        {
+            std::array<char, 4> Magic;
+            std::uint32_t Version;
+            std::uint32_t Format;
+            std::uint32_t Width;
+            std::uint32_t Height;
+            std::uint32_t NumberOfMipLevels;
+            std::uint64_t SourceHash;
+            std::uint64_t DataSize;
+        };
+
+        constexpr std::uint64_t FNV1aOffsetBasis = 14695981039346656037ull;
+        constexpr std::uint64_t FNV1aPrime = 1099511628211ull;
+
+        std::uint64_t hashBytes(std::uint64_t hash, std::uint8_t const *pBytes, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; i++)
+            {
+                hash ^= pBytes[i];
+                hash *= FNV1aPrime;
+            }
+
+            return hash;
+        }
+
+        TextureImage downsample(TextureImage const &image)
+        {
+            TextureImage result;
+            result.Width = std::max(1u, image.Width / 2);
+            result.Height = std::max(1u, image.Height / 2);
+            result.Pixels.resize((std::size_t) result.Width * result.Height * 4);
+
+            for (std::uint32_t y = 0; y < result.Height; y++)
+            {
+                std::uint32_t const y0 = std::min(y * 2, image.Height - 1);
+                std::uint32_t const y1 = std::min(y * 2 + 1, image.Height - 1);
+                for (std::uint32_t x = 0; x < result.Width; x++)
+                {
+                    std::uint32_t const x0 = std::min(x * 2, image.Width - 1);
+                    std::uint32_t const x1 = std::min(x * 2 + 1, image.Width - 1);
+                    for (std::uint32_t channel = 0; channel < 4; channel++)
+                    {
+                        std::uint32_t const sum = image.Pixels[((std::size_t) y0 * image.Width + x0) * 4 + channel] +
+                                                  image.Pixels[((std::size_t) y0 * image.Width + x1) * 4 + channel] +
+                                                  image.Pixels[((std::size_t) y1 * image.Width + x0) * 4 + channel] +
+                                                  image.Pixels[((std::size_t) y1 * image.Width + x1) * 4 + channel];
+                        result.Pixels[((std::size_t) y * result.Width + x) * 4 + channel] = (std::uint8_t) ((sum + 2) / 4);
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        std::uint16_t packRGB565(std::uint8_t r, std::uint8_t g, std::uint8_t b)
+        {
+            return (std::uint16_t) (((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+        }
+
+        std::array<std::uint8_t, 3> unpackRGB565(std::uint16_t color)
+        {
+            std::uint8_t const r = (color >> 11) & 0x1F;
+            std::uint8_t const g = (color >> 5) & 0x3F;
+            std::uint8_t const b = color & 0x1F;
+            return {(std::uint8_t) ((r << 3) | (r >> 2)), (std::uint8_t) ((g << 2) | (g >> 4)), (std::uint8_t) ((b << 3) | (b >> 2))};
+        }
+
+        /// Encode the colors of a 4x4 block (16 RGBA texels) into 8 bytes of BC1 data.
+        /// The endpoints are the inset corners of the color bounding box, which is fast & good enough for sprites.
+        void encodeBC1ColorBlock(std::array<std::uint8_t, 64> const &block, std::uint8_t *pOutput)
+        {
+            std::array<std::uint8_t, 3> minColor {255, 255, 255};
+            std::array<std::uint8_t, 3> maxColor {0, 0, 0};
+            for (int i = 0; i < 16; i++)
+            {
+                for (int channel = 0; channel < 3; channel++)
+                {
+                    minColor[channel] = std::min(minColor[channel], block[i * 4 + channel]);
+                    maxColor[channel] = std::max(maxColor[channel], block[i * 4 + channel]);
+                }
+            }
+
+            for (int channel = 0; channel < 3; channel++)
+            {
+                std::uint8_t const inset = (maxColor[channel] - minColor[channel]) / 16;
+                minColor[channel] += inset;
+                maxColor[channel] -= inset;
+            }
+
+            // Each channel of the max color is larger than or equal to the min color's, so is the packed value.
+            // color0 > color1 selects the 4-color mode.
+            std::uint16_t const color0 = packRGB565(maxColor[0], maxColor[1], maxColor[2]);
+            std::uint16_t const color1 = packRGB565(minColor[0], minColor[1], minColor[2]);
+
+            std::uint32_t indices = 0;
+            if (color0 != color1)
+            {
+                std::array<std::uint8_t, 3> const endpoint0 = unpackRGB565(color0);
+                std::array<std::uint8_t, 3> const endpoint1 = unpackRGB565(color1);
+                std::array<std::array<int, 3>, 4> palette {};
+                for (int channel = 0; channel < 3; channel++)
+                {
+                    palette[0][channel] = endpoint0[channel];
+                    palette[1][channel] = endpoint1[channel];
+                    palette[2][channel] = (2 * endpoint0[channel] + endpoint1[channel]) / 3;
+                    palette[3][channel] = (endpoint0[channel] + 2 * endpoint1[channel]) / 3;
+                }
+
+                for (int i = 0; i < 16; i++)
+                {
+                    int bestIndex = 0;
+                    int bestDistance = std::numeric_limits<int>::max();
+                    for (int paletteIndex = 0; paletteIndex < 4; paletteIndex++)
+                    {
+                        int distance = 0;
+                        for (int channel = 0; channel < 3; channel++)
+                        {
+                            int const difference = block[i * 4 + channel] - palette[paletteIndex][channel];
+                            distance += difference * difference;
+                        }
+
+                        if (distance < bestDistance)
+                        {
+                            bestDistance = distance;
+                            bestIndex = paletteIndex;
+                        }
+                    }
+
+                    indices |= (std::uint32_t) bestIndex << (i * 2);
+                }
+            }
+
+            pOutput[0] = color0 & 0xFF;
+            pOutput[1] = (color0 >> 8) & 0xFF;
+            pOutput[2] = color1 & 0xFF;
+            pOutput[3] = (color1 >> 8) & 0xFF;
+            for (int i = 0; i < 4; i++)
+            {
+                pOutput[4 + i] = (indices >> (i * 8)) & 0xFF;
+            }
+        }
+
+        /// Encode the alpha of a 4x4 block (16 RGBA texels) into 8 bytes of BC3 alpha data (8 interpolated values mode).
+        void encodeBC3AlphaBlock(std::array<std::uint8_t, 64> const &block, std::uint8_t *pOutput)
+        {
+            std::uint8_t minAlpha = 255;
+            std::uint8_t maxAlpha = 0;
+            for (int i = 0; i < 16; i++)
+            {
+                minAlpha = std::min(minAlpha, block[i * 4 + 3]);
+                maxAlpha = std::max(maxAlpha, block[i * 4 + 3]);
+            }
+
+            std::uint64_t indices = 0;
+            if (maxAlpha != minAlpha)
+            {
+                std::array<int, 8> palette {};
+                palette[0] = maxAlpha;
+                palette[1] = minAlpha;
+                for (int paletteIndex = 2; paletteIndex < 8; paletteIndex++)
+                {
+                    palette[paletteIndex] = ((8 - paletteIndex) * maxAlpha + (paletteIndex - 1) * minAlpha) / 7;
+                }
+
+                for (int i = 0; i < 16; i++)
+                {
+                    int bestIndex = 0;
+                    int bestDistance = std::numeric_limits<int>::max();
+                    for (int paletteIndex = 0; paletteIndex < 8; paletteIndex++)
+                    {
+                        int const distance = std::abs(block[i * 4 + 3] - palette[paletteIndex]);
+                        if (distance < bestDistance)
+                        {
+                            bestDistance = distance;
+                            bestIndex = paletteIndex;
+                        }
+                    }
+
+                    indices |= (std::uint64_t) bestIndex << (i * 3);
+                }
+            }
+
+            pOutput[0] = maxAlpha;
+            pOutput[1] = minAlpha;
+            for (int i = 0; i < 6; i++)
+            {
+                pOutput[2 + i] = (indices >> (i * 8)) & 0xFF;
+            }
+        }
+
+        std::uint32_t getBlockSize(CookedTextureFormat format)
+        {
+            return format == CookedTextureFormat::BC1 ? 8 : 16;
+        }
+
+        void encodeMipLevel(TextureImage const &image, CookedTextureFormat format, std::vector<std::uint8_t> &output)
+        {
+            if (format == CookedTextureFormat::RGBA8)
+            {
+                output.insert(output.end(), image.Pixels.begin(), image.Pixels.end());
+                return;
+            }
+
+            std::uint32_t const blockSize = getBlockSize(format);
+            std::uint32_t const numberOfBlocksX = (image.Width + 3) / 4;
+            std::uint32_t const numberOfBlocksY = (image.Height + 3) / 4;
+
+            std::size_t outputOffset = output.size();
+            output.resize(outputOffset + (std::size_t) numberOfBlocksX * numberOfBlocksY * blockSize);
+
+            std::array<std::uint8_t, 64> block {};
+            for (std::uint32_t blockY = 0; blockY < numberOfBlocksY; blockY++)
+            {
+                for (std::uint32_t blockX = 0; blockX < numberOfBlocksX; blockX++)
+                {
+                    // Gather the texels of the block, the edges are clamped if the dimensions are not multiples of 4.
+                    for (std::uint32_t y = 0; y < 4; y++)
+                    {
+                        std::uint32_t const sourceY = std::min(blockY * 4 + y, image.Height - 1);
+                        for (std::uint32_t x = 0; x < 4; x++)
+                        {
+                            std::uint32_t const sourceX = std::min(blockX * 4 + x, image.Width - 1);
+                            std::memcpy(&block[(y * 4 + x) * 4], &image.Pixels[((std::size_t) sourceY * image.Width + sourceX) * 4], 4);
+                        }
+                    }
+
+                    std::uint8_t *pBlockOutput = output.data() + outputOffset;
+                    if (format == CookedTextureFormat::BC3)
+                    {
+                        encodeBC3AlphaBlock(block, pBlockOutput);
+                        pBlockOutput += 8;
+                    }
+                    encodeBC1ColorBlock(block, pBlockOutput);
+
+                    outputOffset += blockSize;
+                }
+            }
+        }
+    }
+
+    std::optional<TextureImage> TextureCooker::DecodeSourceImage(std::filesystem::path const &sourcePath)
+    {
+        int width, height, channels;
+        stbi_set_flip_vertically_on_load(1);
+        stbi_uc *pData = stbi_load(sourcePath.string().c_str(), &width, &height, &channels, 4);
+        if (pData == nullptr)
+        {
+            DYE_LOG("Failed to decode image \"%s\".", sourcePath.string().c_str());
+            return {};
+        }
+
+        TextureImage image;
+        image.Width = width;
+        image.Height = height;
+        image.Pixels.assign(pData, pData + (std::size_t) width * height * 4);
+        stbi_image_free(pData);
+
+        return image;
+    }
+
+    CookedTexture TextureCooker::Cook(TextureImage const &image, TextureCookSettings const &settings)
+    {
+        CookedTexture cookedTexture;
+        cookedTexture.Format = settings.Format;
+        cookedTexture.Width = image.Width;
+        cookedTexture.Height = image.Height;
+
+        TextureImage mipImage;
+        TextureImage const *pCurrentImage = &image;
+        while (true)
+        {
+            std::uint64_t const offset = cookedTexture.Data.size();
+            encodeMipLevel(*pCurrentImage, settings.Format, cookedTexture.Data);
+            cookedTexture.MipLevels.push_back
+                (
+                    CookedTexture::MipLevel
+                        {
+                            .Width = pCurrentImage->Width,
+                            .Height = pCurrentImage->Height,
+                            .Offset = offset,
+                            .Size = cookedTexture.Data.size() - offset
+                        }
+                );
+
+            bool const isLastLevel = pCurrentImage->Width == 1 && pCurrentImage->Height == 1;
+            if (!settings.GenerateMipmaps || isLastLevel)
+            {
+                break;
+            }
+
+            mipImage = downsample(*pCurrentImage);
+            pCurrentImage = &mipImage;
+        }
+
+        return cookedTexture;
+    }
+
+    std::uint64_t TextureCooker::HashSource(std::filesystem::path const &sourcePath, TextureCookSettings const &settings)
+    {
+        std::uint64_t hash = FNV1aOffsetBasis;
+
+        std::ifstream file(sourcePath, std::ios::binary);
+        std::array<char, 64 * 1024> buffer {};
+        while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+        {
+            hash = hashBytes(hash, reinterpret_cast<std::uint8_t const *>(buffer.data()), (std::size_t) file.gcount());
+        }
+
+        std::array<std::uint32_t, 3> const settingsValues = {CookedTextureVersion, (std::uint32_t) settings.Format, settings.GenerateMipmaps ? 1u : 0u};
+        hash = hashBytes(hash, reinterpret_cast<std::uint8_t const *>(settingsValues.data()), sizeof(settingsValues));
+
+        return hash;
+    }
+
+    std::optional<std::filesystem::path> TextureCooker::CookToCache(std::filesystem::path const &sourcePath,
+                                                                    std::filesystem::path const &cacheFolderPath,
+                                                                    TextureCookSettings const &settings)
+    {
+        if (!FileSystem::FileExists(sourcePath))
+        {
+            DYE_LOG("Cannot find the source image \"%s\" to cook.", sourcePath.string().c_str());
+            return {};
+        }
+
+        std::uint64_t const sourceHash = HashSource(sourcePath, settings);
+
+        std::array<char, 17> hashString {};
+        std::snprintf(hashString.data(), hashString.size(), "%016llx", (unsigned long long) sourceHash);
+        std::filesystem::path const cookedPath = cacheFolderPath / (sourcePath.stem().string() + "_" + hashString.data() + CookedTextureExtension);
+
+        if (FileSystem::FileExists(cookedPath))
+        {
+            // Already cooked with the same content & settings.
+            return cookedPath;
+        }
+
+        std::optional<TextureImage> const image = DecodeSourceImage(sourcePath);
+        if (!image.has_value())
+        {
+            return {};
+        }
+
+        CookedTexture cookedTexture = Cook(image.value(), settings);
+        cookedTexture.SourceHash = sourceHash;
+
+        std::error_code errorCode;
+        std::filesystem::create_directories(cacheFolderPath, errorCode);
+        if (!WriteCookedTexture(cookedTexture, cookedPath))
+        {
+            return {};
+        }
+
+        return cookedPath;
+    }
+
+    bool TextureCooker::WriteCookedTexture(CookedTexture const &cookedTexture, std::filesystem::path const &path)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            DYE_LOG("Failed to open \"%s\" to write cooked texture.", path.string().c_str());
+            return false;
+        }
+
+        CookedTextureFileHeader const header
+            {
+                .Magic = CookedTextureMagic,
+                .Version = CookedTextureVersion,
+                .Format = (std::uint32_t) cookedTexture.Format,
+                .Width = cookedTexture.Width,
+                .Height = cookedTexture.Height,
+                .NumberOfMipLevels = (std::uint32_t) cookedTexture.MipLevels.size(),
+                .SourceHash = cookedTexture.SourceHash,
+                .DataSize = cookedTexture.Data.size()
+            };
+
+        file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        file.write(reinterpret_cast<char const *>(cookedTexture.MipLevels.data()), (std::streamsize) (cookedTexture.MipLevels.size() * sizeof(CookedTexture::MipLevel)));
+        file.write(reinterpret_cast<char const *>(cookedTexture.Data.data()), (std::streamsize) cookedTexture.Data.size());
+
+        return file.good();
+    }
+
+    std::optional<CookedTexture> TextureCooker::ReadCookedTexture(std::filesystem::path const &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            DYE_LOG("Failed to open cooked texture \"%s\".", path.string().c_str());
+            return {};
+        }
+
+        CookedTextureFileHeader header {};
+        file.read(reinterpret_cast<char *>(&header), sizeof(header));
+        if (!file || header.Magic != CookedTextureMagic || header.Version != CookedTextureVersion)
+        {
+            DYE_LOG("\"%s\" is not a valid cooked texture or it's cooked with an old version, it has to be cooked again.", path.string().c_str());
+            return {};
+        }
+
+        CookedTexture cookedTexture;
+        cookedTexture.Format = (CookedTextureFormat) header.Format;
+        cookedTexture.Width = header.Width;
+        cookedTexture.Height = header.Height;
+        cookedTexture.SourceHash = header.SourceHash;
+
+        // The mip table & the data are read directly into the memory, no decoding is needed.
+        cookedTexture.MipLevels.resize(header.NumberOfMipLevels);
+        file.read(reinterpret_cast<char *>(cookedTexture.MipLevels.data()), (std::streamsize) (cookedTexture.MipLevels.size() * sizeof(CookedTexture::MipLevel)));
+        cookedTexture.Data.resize(header.DataSize);
+        file.read(reinterpret_cast<char *>(cookedTexture.Data.data()), (std::streamsize) cookedTexture.Data.size());
+        if (!file)
+        {
+            DYE_LOG("Cooked texture \"%s\" is truncated.", path.string().c_str());
+            return {};
+        }
+
+        for (auto const &mipLevel: cookedTexture.MipLevels)
+        {
+            if (mipLevel.Offset + mipLevel.Size > cookedTexture.Data.size())
+            {
+                DYE_LOG("Cooked texture \"%s\" has an invalid mip level.", path.string().c_str());
+                return {};
+            }
+        }
+
+        return cookedTexture;
+    }
+}
@@ -22,8 +22,27 @@ namespace DYE
         auto now = SDL_GetTicks();
 
         m_DeltaTicks = now - m_LastTicks;
+        m_DeltaTime = m_DeltaTicks / 1000.0;
         m_TicksSinceStart += m_DeltaTicks;
 
         m_LastTicks = now;
     }
+
+    void Time::overrideDeltaTicks(uint32_t deltaTicks)
+    {
+        m_TicksSinceStart = m_TicksSinceStart - m_DeltaTicks + deltaTicks;
+        m_DeltaTicks = deltaTicks;
+        m_DeltaTime = deltaTicks / 1000.0;
+    }
+
+    void Time::overrideDeltaTime(double deltaTime)
+    {
+        overrideDeltaTicks(static_cast<uint32_t>(deltaTime * 1000.0 + 0.5));
+        m_DeltaTime = deltaTime;
+    }
+
+    void Time::setFixedUpdateAccumulator(double deltaTimeAccumulator)
+    {
+        m_FixedUpdateInterpolationAlpha = deltaTimeAccumulator / FixedDeltaTime();
+    }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Graphics/OpenGL.h"
 
 #include <regex>
+#include <algorithm>
 
 namespace DYE::ShaderProcessor
 {
@@ -20,7 +21,7 @@ namespace DYE::ShaderProcessor
     void UniformPropertyProcessor::OnEnd(DYE::ShaderProgram &shaderProgram)
     {
         // Acquire uniform information from shader program.
-        auto uniformInfos = getAllActiveUniformInfoFromShaderProgram(shaderProgram);
+        auto uniformInfos = IsOpenGLLoaded() ? getAllActiveUniformInfoFromShaderProgram(shaderProgram) : getAllDeclaredUniformInfoFromSource();
         shaderProgram.addUniformInfo(uniformInfos);
 
         // Parse property information from cached shader program source.
@@ -164,4 +165,57 @@ namespace DYE::ShaderProcessor
 
         return std::move(infos);
     }
+
+    std::vector<UniformInfo> UniformPropertyProcessor::getAllDeclaredUniformInfoFromSource() const
+    {
+        std::vector<UniformInfo> infos {};
+
+        // i.e. uniform vec4 _Color;
+        std::regex const uniformDeclarationRegexPattern(R"(^\s*uniform\s+(\w+)\s+(\w+)\s*;)");
+
+        std::stringstream stream(m_ShaderProgramSourceCache);
+        std::string line;
+        int textureUnitSlotCounter = 0;
+        while (std::getline(stream, line))
+        {
+            std::smatch match;
+            if (!std::regex_search(line, match, uniformDeclarationRegexPattern))
+            {
+                continue;
+            }
+
+            std::string const typeQualifier = match[1].str();
+            std::string const uniformName = match[2].str();
+
+            bool const isDeclared = std::any_of(infos.begin(), infos.end(), [&uniformName](UniformInfo const &info) { return info.Name == uniformName; });
+            if (isDeclared)
+            {
+                // The same uniform could be declared in multiple shader stages.
+                continue;
+            }
+
+            UniformInfo info {};
+            info.Name = uniformName;
+            info.Type = UniformType::Invalid;
+            for (int i = 0; i < UniformConstants::NumberOfUniformTypes; i++)
+            {
+                if (UniformTypeToPropertyTypeQualifier((UniformType) i) == typeQualifier)
+                {
+                    info.Type = (UniformType) i;
+                    break;
+                }
+            }
+            info.Location = infos.size();
+
+            if (info.Type == UniformType::Texture2D)
+            {
+                info.TextureUnitSlotIfTexture = textureUnitSlotCounter;
+                textureUnitSlotCounter++;
+            }
+
+            infos.push_back(info);
+        }
+
+        return infos;
+    }
 }
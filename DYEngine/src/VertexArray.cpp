@@ -48,11 +48,22 @@ namespace DYE
 
     VertexArray::VertexArray()
     {
+        if (!IsOpenGLLoaded())
+        {
+            // Headless, the vertex array only keeps references to the buffers.
+            return;
+        }
+
         glCall(glGenVertexArrays(1, &m_ID));
     }
 
     VertexArray::~VertexArray()
     {
+        if (m_ID == 0)
+        {
+            return;
+        }
+
         glDeleteVertexArrays(1, &m_ID);
     }
 
@@ -74,6 +85,12 @@ namespace DYE
             DYE_ASSERT(false);
         }
 
+        if (m_ID == 0)
+        {
+            m_VertexBuffers.push_back(vertexBuffer);
+            return;
+        }
+
         glCall(glBindVertexArray(m_ID));
         vertexBuffer->Bind();
 
@@ -147,8 +164,11 @@ namespace DYE
 
     void VertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer> &indexBuffer)
     {
-        glBindVertexArray(m_ID);
-        indexBuffer->Bind();
+        if (m_ID != 0)
+        {
+            glBindVertexArray(m_ID);
+            indexBuffer->Bind();
+        }
 
         m_IndexBuffer = indexBuffer;
     }
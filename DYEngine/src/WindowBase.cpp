@@ -47,6 +47,16 @@ namespace DYE
         m_Context->MakeCurrentForWindow(*this);
     }
 
+    void WindowBase::ReleaseCurrent()
+    {
+        if (m_Context == nullptr)
+        {
+            return;
+        }
+
+        m_Context->ReleaseCurrentForWindow(*this);
+    }
+
     glm::vec<2, std::int32_t> WindowBase::SetWindowSizeUsingWindowCenterAsAnchor(std::uint32_t width, std::uint32_t height)
     {
         int const previousWidth = GetWidth();
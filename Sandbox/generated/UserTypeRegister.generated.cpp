@@ -18,6 +18,7 @@
 #include "include/TestComponents.h"
 #include "include/AnotherTestComponents.h"
 #include "include/SystemExample.h"
+#include "include/BenchmarkSystems.h"
 
 
 namespace DYE::DYEditor
@@ -454,6 +455,31 @@ namespace DYE::DYEditor
 		// System located in include/SystemExample.h
 		static GetViewTestImGuiSystem _GetViewTestImGuiSystem;
 		TypeRegistry::RegisterSystem("Get View Test ImGui System", &_GetViewTestImGuiSystem);
+
+		// System located in include/BenchmarkSystems.h
+		static EventDispatchBenchmarkImGuiSystem _EventDispatchBenchmarkImGuiSystem;
+		TypeRegistry::RegisterSystem("Event Dispatch Benchmark ImGui System", &_EventDispatchBenchmarkImGuiSystem);
+		// System located in include/BenchmarkSystems.h
+		static RenderPipeline2DBenchmarkSystem _RenderPipeline2DBenchmarkSystem;
+		TypeRegistry::RegisterSystem("Render Pipeline 2D Benchmark System", &_RenderPipeline2DBenchmarkSystem);
+		// System located in include/BenchmarkSystems.h
+		static RenderPipeline2DBenchmarkImGuiSystem _RenderPipeline2DBenchmarkImGuiSystem;
+		TypeRegistry::RegisterSystem("Render Pipeline 2D Benchmark ImGui System", &_RenderPipeline2DBenchmarkImGuiSystem);
+		// System located in include/BenchmarkSystems.h
+		static TextureCookingBenchmarkSystem _TextureCookingBenchmarkSystem;
+		TypeRegistry::RegisterSystem("Texture Cooking Benchmark System", &_TextureCookingBenchmarkSystem);
+		// System located in include/BenchmarkSystems.h
+		static ShaderBinaryCacheBenchmarkSystem _ShaderBinaryCacheBenchmarkSystem;
+		TypeRegistry::RegisterSystem("Shader Binary Cache Benchmark System", &_ShaderBinaryCacheBenchmarkSystem);
+		// System located in include/BenchmarkSystems.h
+		static EntityCreationBenchmarkImGuiSystem _EntityCreationBenchmarkImGuiSystem;
+		TypeRegistry::RegisterSystem("Entity Creation Benchmark ImGui System", &_EntityCreationBenchmarkImGuiSystem);
+		// System located in include/BenchmarkSystems.h
+		static WorldMemoryBenchmarkImGuiSystem _WorldMemoryBenchmarkImGuiSystem;
+		TypeRegistry::RegisterSystem("World Memory Benchmark ImGui System", &_WorldMemoryBenchmarkImGuiSystem);
+		// System located in include/BenchmarkSystems.h
+		static PrimitiveTestBatchBenchmarkImGuiSystem _PrimitiveTestBatchBenchmarkImGuiSystem;
+		TypeRegistry::RegisterSystem("Primitive Test Batch Benchmark ImGui System", &_PrimitiveTestBatchBenchmarkImGuiSystem);
 	}
 
 	class UserTypeRegister_Generated
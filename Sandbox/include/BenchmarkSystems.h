@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Core/EditorCore.h"
+#include "Graphics/RenderCommand.h"
+
+#include <vector>
+
+/// Replay a recorded burst of input events through an event dispatcher,
+/// comparing heap allocated events (the old SDLEventSystem path) against in-place broadcast.
+DYE_SYSTEM(EventDispatchBenchmarkImGuiSystem, "Event Dispatch Benchmark ImGui System")
+struct EventDispatchBenchmarkImGuiSystem final : public DYE::DYEditor::SystemBase
+{
+	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::ImGui; }
+	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+private:
+	int m_NumberOfEventsInBurst = 100000;
+	int m_NumberOfHandledEvents = 0;
+	double m_HeapAllocatedReplayMilliseconds = 0;
+	double m_InPlaceReplayMilliseconds = 0;
+};
+
+/// The CPU-side cost of sorting, submission & command generation of a 2D render pipeline,
+/// and the counters of the recording render backend the sprites are rendered with.
+struct RenderPipeline2DBenchmarkResult
+{
+	int NumberOfSprites = 0;
+	double SubmitMilliseconds = 0;
+	double RenderMilliseconds = 0;
+	std::uint64_t NumberOfDrawCalls = 0;
+	std::uint64_t NumberOfUniformUploads = 0;
+	std::uint64_t NumberOfTextureBinds = 0;
+	std::uint64_t NumberOfRenderStateChanges = 0;
+	std::size_t NumberOfRecordedCommands = 0;
+	DYE::RenderStateCacheStatistics StateCacheStatistics;
+};
+
+/// Submit sprites to a 2D render pipeline & render them with a recording render backend, and log the result.
+/// It runs once when the scene is initialized & doesn't touch the GPU, therefore it also works in headless mode on a machine without a GPU.
+DYE_SYSTEM(RenderPipeline2DBenchmarkSystem, "Render Pipeline 2D Benchmark System")
+struct RenderPipeline2DBenchmarkSystem final : public DYE::DYEditor::SystemBase
+{
+	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::Initialize; }
+	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+private:
+	int m_NumberOfSprites = 100000;
+};
+
+/// Show the result of the last render pipeline 2D benchmark run (see RenderPipeline2DBenchmarkSystem),
+/// and run the benchmark again with the given number of sprites.
+DYE_SYSTEM(RenderPipeline2DBenchmarkImGuiSystem, "Render Pipeline 2D Benchmark ImGui System")
+struct RenderPipeline2DBenchmarkImGuiSystem final : public DYE::DYEditor::SystemBase
+{
+	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::ImGui; }
+	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+private:
+	int m_NumberOfSprites = 100000;
+};
+
+/// Decode the source images in 'assets/Textures' with stb_image & compare it with loading the cooked textures (RGBA8, BC1 & BC3).
+/// It runs once when the scene is initialized & only touches the CPU, therefore it also works in headless mode on a machine without a GPU.
+DYE_SYSTEM(TextureCookingBenchmarkSystem, "Texture Cooking Benchmark System")
+struct TextureCookingBenchmarkSystem final : public DYE::DYEditor::SystemBase
+{
+	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::Initialize; }
+	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+private:
+	int m_NumberOfIterations = 20;
+};
+
+/// Create every shader in 'assets/default' with an empty shader binary cache (cold start) & then again with the cache filled (warm start).
+/// It runs once when the scene is initialized, and is skipped in headless mode because there is no driver to compile the shaders.
+DYE_SYSTEM(ShaderBinaryCacheBenchmarkSystem, "Shader Binary Cache Benchmark System")
+struct ShaderBinaryCacheBenchmarkSystem final : public DYE::DYEditor::SystemBase
+{
+	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::Initialize; }
+	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+};
+
+/// Create a batch of entities with a LocalTransformComponent one by one (World::CreateEntity) & in bulk (World::CreateEntities),
+/// each into a fresh world so the two measurements don't affect each other.
+DYE_SYSTEM(EntityCreationBenchmarkImGuiSystem, "Entity Creation Benchmark ImGui System")
+struct EntityCreationBenchmarkImGuiSystem final : public DYE::DYEditor::SystemBase
+{
+	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::ImGui; }
+	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+private:
+	int m_NumberOfEntities = 1000000;
+	double m_OneByOneMilliseconds = 0;
+	double m_BulkMilliseconds = 0;
+};
+
+/// Fill a fresh world with entities & show the memory the world uses to track them (handles, GUID lookup & built-in components).
+/// Compare the numbers of an editor build against a runtime build with DYE_LEAN_RUNTIME_WORLD enabled.
+/// The estimated bytes per entity (64-bit libstdc++, before any user component) are:
+///	editor ~108 (handle 4, GUID map ~40, ID 16, name 16, metadata 32), runtime ~76,
+///	lean runtime ~52 (GUID array 16), lean runtime without the GUID map ~36.
+DYE_SYSTEM(WorldMemoryBenchmarkImGuiSystem, "World Memory Benchmark ImGui System")
+struct WorldMemoryBenchmarkImGuiSystem final : public DYE::DYEditor::SystemBase
+{
+	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::ImGui; }
+	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+private:
+	int m_NumberOfEntities = 100000;
+	DYE::DYEditor::WorldMemoryStatistics m_Statistics;
+};
+
+/// Test one shape against a batch of AABBs/circles with the one-pair functions in PrimitiveTest.h (AoS),
+/// the scalar batch kernels & the SIMD batch kernels in PrimitiveTestBatch.h (SoA), and show the time each of them takes.
+DYE_SYSTEM(PrimitiveTestBatchBenchmarkImGuiSystem, "Primitive Test Batch Benchmark ImGui System")
+struct PrimitiveTestBatchBenchmarkImGuiSystem final : public DYE::DYEditor::SystemBase
+{
+	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::ImGui; }
+	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+private:
+	struct Result
+	{
+		char const *TestName = "";
+		double OnePairMilliseconds = 0;
+		double ScalarBatchMilliseconds = 0;
+		double SIMDBatchMilliseconds = 0;
+		/// The number of hits of the three paths, they should be the same.
+		std::size_t NumberOfHits[3] {};
+	};
+
+	int m_NumberOfShapes = 10000;
+	int m_NumberOfIterations = 100;
+	std::vector<Result> m_Results;
+};
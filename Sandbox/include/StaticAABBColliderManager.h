@@ -3,13 +3,21 @@
 #include "Math/AABB.h"
 #include "Math/PrimitiveTest.h"
 
+#include <cstdint>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace DYE::Sandbox
 {
 	using ColliderID = std::int32_t;
 
+	/// Each bit is a layer, a collider can be on multiple layers.
+	/// A query only tests the colliders that share at least one layer with the query mask.
+	using ColliderLayerMask = std::uint32_t;
+	constexpr ColliderLayerMask DefaultColliderLayer = 1u << 0;
+	constexpr ColliderLayerMask AllColliderLayers = ~0u;
+
 	struct RaycastHit2D
 	{
 		ColliderID ColliderID;
@@ -22,27 +30,53 @@ namespace DYE::Sandbox
 	class StaticAABBColliderManager
 	{
 	public:
-		ColliderID RegisterAABB(Math::AABB aabb);
+		ColliderID RegisterAABB(Math::AABB aabb, ColliderLayerMask layers = DefaultColliderLayer);
 		void UnregisterAABB(ColliderID id);
 
 		bool IsColliderRegistered(ColliderID id) const;
 		std::optional<Math::AABB> TryGetAABB(ColliderID id);
 		bool SetAABB(ColliderID id, Math::AABB aabb);
+		bool SetLayers(ColliderID id, ColliderLayerMask layers);
+
+		std::vector<ColliderID> OverlapAABB(Math::AABB aabb, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::vector<ColliderID> OverlapCircle(glm::vec2 center, float radius, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::vector<RaycastHit2D> RaycastAll(glm::vec2 start, glm::vec2 end, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::vector<RaycastHit2D> CircleCastAll(glm::vec2 center, float radius, glm::vec2 direction, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::vector<RaycastHit2D> AABBCastAll(Math::AABB aabb, glm::vec2 direction, ColliderLayerMask layerMask = AllColliderLayers) const;
+
+		// The following overloads write into the given span instead of allocating a vector.
+		// The overlap queries stop once the span is full. The cast queries keep the closest hits that fit into the span, sorted by time,
+		// and skip the colliders that cannot be hit earlier than the farthest kept hit once the span is full.
+		// They return the number of the written elements.
 
-		std::vector<ColliderID> OverlapAABB(Math::AABB aabb) const;
-		std::vector<ColliderID> OverlapCircle(glm::vec2 center, float radius) const;
-		std::vector<RaycastHit2D> RaycastAll(glm::vec2 start, glm::vec2 end) const;
-		std::vector<RaycastHit2D> CircleCastAll(glm::vec2 center, float radius, glm::vec2 direction) const;
-		std::vector<RaycastHit2D> AABBCastAll(Math::AABB aabb, glm::vec2 direction) const;
+		std::size_t OverlapAABB(Math::AABB aabb, std::span<ColliderID> outIDs, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::size_t OverlapCircle(glm::vec2 center, float radius, std::span<ColliderID> outIDs, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::size_t RaycastAll(glm::vec2 start, glm::vec2 end, std::span<RaycastHit2D> outHits, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::size_t CircleCastAll(glm::vec2 center, float radius, glm::vec2 direction, std::span<RaycastHit2D> outHits, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::size_t AABBCastAll(Math::AABB aabb, glm::vec2 direction, std::span<RaycastHit2D> outHits, ColliderLayerMask layerMask = AllColliderLayers) const;
+
+		// The first hit of the cast, equivalent to the first element of the *CastAll result but without collecting the other hits.
+
+		std::optional<RaycastHit2D> RaycastClosest(glm::vec2 start, glm::vec2 end, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::optional<RaycastHit2D> CircleCastClosest(glm::vec2 center, float radius, glm::vec2 direction, ColliderLayerMask layerMask = AllColliderLayers) const;
+		std::optional<RaycastHit2D> AABBCastClosest(Math::AABB aabb, glm::vec2 direction, ColliderLayerMask layerMask = AllColliderLayers) const;
 
 		void DrawGizmos() const;
 		void DrawImGui();
 
 	private:
-		int binarySearchIndexOf(std::vector<std::pair<ColliderID, Math::AABB>> const& collection, ColliderID id) const;
+		struct StaticAABBCollider
+		{
+			ColliderID ID;
+			Math::AABB AABB;
+			ColliderLayerMask Layers;
+		};
+
+		int binarySearchIndexOf(std::vector<StaticAABBCollider> const& collection, ColliderID id) const;
 
 	private:
 		ColliderID m_AABBIdCounter = 0;
-		std::vector<std::pair<ColliderID, Math::AABB>> m_AABBs;
+		/// Sorted by ID, because the IDs are increasing & the colliders are always appended.
+		std::vector<StaticAABBCollider> m_AABBs;
 	};
 }
\ No newline at end of file
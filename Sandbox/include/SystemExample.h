@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Core/EditorCore.h"
+#include "Components/TransformComponents.h"
+#include "TestComponents.h"
 
 DYE_SYSTEM(UpdateSystemA, "Update System A")
 struct UpdateSystemA final : public DYE::DYEditor::SystemBase
@@ -77,6 +79,9 @@ struct RotateHasAngularVelocitySystem final : public DYE::DYEditor::SystemBase
 {
 	inline DYE::DYEditor::ExecutionPhase GetPhase() const override { return DYE::DYEditor::ExecutionPhase::Update ; }
 	void Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params) final;
+
+private:
+	DYE::DYEditor::SystemViewQuery<DYE::DYEditor::Get_t<HasAngularVelocity, DYE::DYEditor::LocalTransformComponent>> m_Query {*this};
 };
 
 DYE_SYSTEM(CreateEntitiesSystem, "Create Entities System")
@@ -0,0 +1,701 @@
+#include "BenchmarkSystems.h"
+
+#include "Util/Macro.h"
+#include "Event/KeyEvent.h"
+#include "Event/MouseEvent.h"
+#include "Util/Stopwatch.h"
+#include "ImGui/ImGuiUtil.h"
+#include "Graphics/RenderPipeline2D.h"
+#include "Graphics/RecordingRenderCommand.h"
+#include "Graphics/Texture.h"
+#include "Graphics/TextureCooker.h"
+#include "Graphics/OpenGL.h"
+#include "Graphics/Shader.h"
+#include "Graphics/ShaderProgramBinaryCache.h"
+#include "Core/Entity.h"
+#include "Components/TransformComponents.h"
+#include "Math/PrimitiveTest.h"
+#include "Math/PrimitiveTestBatch.h"
+
+#include "imgui.h"
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include <random>
+
+namespace
+{
+	using namespace DYE;
+
+	/// A recorded SDL-like input event, stored as plain data so the burst can be replayed many times.
+	struct RecordedInputEvent
+	{
+		EventType Type;
+		std::int32_t Data[4];
+	};
+
+	std::vector<RecordedInputEvent> recordEventBurst(int numberOfEvents)
+	{
+		std::vector<RecordedInputEvent> burst;
+		burst.reserve(numberOfEvents);
+
+		// Mostly mouse motion with keys, buttons and scrolls mixed in, which resembles a high-rate mouse being moved around.
+		for (int i = 0; i < numberOfEvents; i++)
+		{
+			switch (i % 16)
+			{
+				case 0:
+					burst.push_back(RecordedInputEvent {.Type = EventType::KeyDown, .Data = {(std::int32_t) KeyCode::A}});
+					break;
+				case 1:
+					burst.push_back(RecordedInputEvent {.Type = EventType::KeyUp, .Data = {(std::int32_t) KeyCode::A}});
+					break;
+				case 2:
+					burst.push_back(RecordedInputEvent {.Type = EventType::MouseButtonDown, .Data = {(std::int32_t) MouseButton::Left}});
+					break;
+				case 3:
+					burst.push_back(RecordedInputEvent {.Type = EventType::MouseButtonUp, .Data = {(std::int32_t) MouseButton::Left}});
+					break;
+				case 4:
+					burst.push_back(RecordedInputEvent {.Type = EventType::MouseScroll, .Data = {0, 1}});
+					break;
+				default:
+					burst.push_back(RecordedInputEvent {.Type = EventType::MouseMove, .Data = {i % 1600, i % 900, 1, -1}});
+					break;
+			}
+		}
+
+		return burst;
+	}
+
+	class CountingEventHandler final : public EventHandler
+	{
+	public:
+		void Handle(Event &event) override
+		{
+			NumberOfHandledEvents++;
+			DispatchEventAs<MouseMovedEvent>(event, [this](MouseMovedEvent &mouseMovedEvent) { AccumulatedDeltaX += mouseMovedEvent.GetDeltaX(); });
+		}
+
+		int NumberOfHandledEvents = 0;
+		float AccumulatedDeltaX = 0;
+	};
+
+	class ReplayEventDispatcher final : public MessageDispatcherBase<Event>
+	{
+	public:
+		/// Replay the burst the way SDLEventSystem used to: one shared_ptr allocation per event.
+		void ReplayWithHeapAllocation(std::vector<RecordedInputEvent> const &burst)
+		{
+			for (auto const &recordedEvent : burst)
+			{
+				std::shared_ptr<Event> eventPtr;
+				auto const &data = recordedEvent.Data;
+				switch (recordedEvent.Type)
+				{
+					case EventType::KeyDown: eventPtr.reset(new KeyDownEvent(static_cast<KeyCode>(data[0]))); break;
+					case EventType::KeyUp: eventPtr.reset(new KeyUpEvent(static_cast<KeyCode>(data[0]))); break;
+					case EventType::MouseButtonDown: eventPtr.reset(new MouseButtonDownEvent(static_cast<MouseButton>(data[0]))); break;
+					case EventType::MouseButtonUp: eventPtr.reset(new MouseButtonUpEvent(static_cast<MouseButton>(data[0]))); break;
+					case EventType::MouseScroll: eventPtr.reset(new MouseScrolledEvent(data[0], data[1])); break;
+					case EventType::MouseMove: eventPtr.reset(new MouseMovedEvent(data[0], data[1], data[2], data[3])); break;
+					default: continue;
+				}
+
+				broadcast(*eventPtr);
+			}
+		}
+
+		/// Replay the burst the way SDLEventSystem does now: events are constructed on the stack.
+		void ReplayInPlace(std::vector<RecordedInputEvent> const &burst)
+		{
+			for (auto const &recordedEvent : burst)
+			{
+				auto const &data = recordedEvent.Data;
+				switch (recordedEvent.Type)
+				{
+					case EventType::KeyDown: emplaceBroadcast<KeyDownEvent>(static_cast<KeyCode>(data[0])); break;
+					case EventType::KeyUp: emplaceBroadcast<KeyUpEvent>(static_cast<KeyCode>(data[0])); break;
+					case EventType::MouseButtonDown: emplaceBroadcast<MouseButtonDownEvent>(static_cast<MouseButton>(data[0])); break;
+					case EventType::MouseButtonUp: emplaceBroadcast<MouseButtonUpEvent>(static_cast<MouseButton>(data[0])); break;
+					case EventType::MouseScroll: emplaceBroadcast<MouseScrolledEvent>(data[0], data[1]); break;
+					case EventType::MouseMove: emplaceBroadcast<MouseMovedEvent>(data[0], data[1], data[2], data[3]); break;
+					default: break;
+				}
+			}
+		}
+	};
+
+	/// Expose the render phases of RenderPipeline2D so the benchmark can drive them without RenderPipelineManager.
+	class BenchmarkRenderPipeline2D final : public RenderPipeline2D
+	{
+	public:
+		using RenderPipeline2D::onCaptureFramePacket;
+		using RenderPipeline2D::onPreRender;
+		using RenderPipeline2D::renderCamera;
+		using RenderPipeline2D::onPostRender;
+	};
+
+	/// The result of the last run, shared by the benchmark system & the ImGui system that shows it.
+	RenderPipeline2DBenchmarkResult lastRenderPipeline2DBenchmarkResult;
+
+	RenderPipeline2DBenchmarkResult runRenderPipeline2DBenchmark(int numberOfSprites)
+	{
+		RenderPipeline2DBenchmarkResult result {.NumberOfSprites = numberOfSprites};
+
+		BenchmarkRenderPipeline2D pipeline;
+		auto const texture = Texture2D::GetDefaultTexture();
+
+		std::mt19937 randomEngine(0);
+		std::uniform_real_distribution<float> positionDistribution(-100.0f, 100.0f);
+
+		Camera camera;
+		camera.Properties.UseManualAspectRatio = true;
+		camera.Properties.ManualAspectRatio = 16.0f / 9.0f;
+
+		// Render with a recording backend, the previous backend is restored afterward.
+		// In headless mode the previous backend is a counters-only recording backend, which doesn't keep the commands.
+		auto previousRenderCommand = RenderCommand::ReplaceInstance(std::make_unique<RecordingRenderCommand>());
+
+		Stopwatch stopwatch;
+		pipeline.onPreRender();
+		for (int i = 0; i < numberOfSprites; i++)
+		{
+			glm::vec3 const position {positionDistribution(randomEngine), positionDistribution(randomEngine), positionDistribution(randomEngine)};
+
+			MaterialPropertyBlock materialPropertyBlock;
+			materialPropertyBlock.SetTexture("_MainTex", texture);
+			materialPropertyBlock.SetFloat4("_MainTex_TilingOffset", {1, 1, 0, 0});
+			materialPropertyBlock.SetFloat4("_Color", {1, 1, 1, 1});
+
+			pipeline.Submit(pipeline.GetDefaultQuadSpriteVAO(), pipeline.GetDefaultSpriteMaterial(), glm::translate(glm::mat4 {1}, position), std::move(materialPropertyBlock));
+		}
+		result.SubmitMilliseconds = stopwatch.GetElapsedMilliseconds();
+
+		stopwatch.Restart();
+		pipeline.onCaptureFramePacket();
+		pipeline.renderCamera(camera);
+		pipeline.onPostRender();
+		result.RenderMilliseconds = stopwatch.GetElapsedMilliseconds();
+
+		auto *pRecordingRenderCommand = RenderCommand::TryGetTypedInstancePtr<RecordingRenderCommand>();
+		auto const &statistics = pRecordingRenderCommand->GetStatistics();
+		result.NumberOfDrawCalls = statistics.NumberOfDrawCalls;
+		result.NumberOfUniformUploads = statistics.NumberOfUniformUploads;
+		result.NumberOfTextureBinds = statistics.NumberOfTextureBinds;
+		result.NumberOfRenderStateChanges = statistics.NumberOfRenderStateChanges;
+		result.NumberOfRecordedCommands = pRecordingRenderCommand->GetRecordedCommands().size();
+		result.StateCacheStatistics = pipeline.GetStateCacheStatisticsLastFrame();
+
+		RenderCommand::ReplaceInstance(std::move(previousRenderCommand));
+
+		DYE_LOG("Render pipeline 2D benchmark (%d sprites): submit %.3f ms, sort & render %.3f ms, "
+				"%llu draw calls, %llu uniform uploads, %llu texture binds, %llu render state changes, %zu recorded commands",
+				numberOfSprites, result.SubmitMilliseconds, result.RenderMilliseconds,
+				(unsigned long long) result.NumberOfDrawCalls, (unsigned long long) result.NumberOfUniformUploads,
+				(unsigned long long) result.NumberOfTextureBinds, (unsigned long long) result.NumberOfRenderStateChanges,
+				result.NumberOfRecordedCommands);
+
+		return result;
+	}
+
+	/// Run the test the given number of times.
+	/// \return the elapsed milliseconds, and the number of hits of the last run in outNumberOfHits.
+	template<typename Func>
+	double measurePrimitiveTest(int numberOfIterations, std::size_t &outNumberOfHits, Func func)
+	{
+		Stopwatch stopwatch;
+		for (int i = 0; i < numberOfIterations; i++)
+		{
+			outNumberOfHits = func();
+		}
+		return stopwatch.GetElapsedMilliseconds();
+	}
+}
+
+void EventDispatchBenchmarkImGuiSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
+{
+	ImGui::SetNextWindowSize({350, 200}, ImGuiCond_FirstUseEver);
+	if (ImGui::Begin("Event Dispatch Benchmark"))
+	{
+		DYE::ImGuiUtil::DrawIntControl("Events In Burst", m_NumberOfEventsInBurst);
+		if (m_NumberOfEventsInBurst < 1)
+		{
+			m_NumberOfEventsInBurst = 1;
+		}
+
+		if (ImGui::Button("Replay Event Burst"))
+		{
+			auto const burst = recordEventBurst(m_NumberOfEventsInBurst);
+
+			CountingEventHandler handler;
+			ReplayEventDispatcher dispatcher;
+			dispatcher.Register(&handler);
+
+			DYE::Stopwatch stopwatch;
+			dispatcher.ReplayWithHeapAllocation(burst);
+			m_HeapAllocatedReplayMilliseconds = stopwatch.GetElapsedMilliseconds();
+
+			stopwatch.Restart();
+			dispatcher.ReplayInPlace(burst);
+			m_InPlaceReplayMilliseconds = stopwatch.GetElapsedMilliseconds();
+
+			m_NumberOfHandledEvents = handler.NumberOfHandledEvents;
+			dispatcher.Unregister(&handler);
+
+			DYE_LOG("Event burst (%d events): heap allocated %.3f ms, in-place %.3f ms",
+					m_NumberOfEventsInBurst, m_HeapAllocatedReplayMilliseconds, m_InPlaceReplayMilliseconds);
+		}
+
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Handled Events", std::to_string(m_NumberOfHandledEvents));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Heap Allocated (ms)", std::to_string(m_HeapAllocatedReplayMilliseconds));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("In-place (ms)", std::to_string(m_InPlaceReplayMilliseconds));
+	}
+
+	ImGui::End();
+}
+
+void RenderPipeline2DBenchmarkSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
+{
+	lastRenderPipeline2DBenchmarkResult = runRenderPipeline2DBenchmark(m_NumberOfSprites);
+}
+
+void RenderPipeline2DBenchmarkImGuiSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
+{
+	ImGui::SetNextWindowSize({350, 300}, ImGuiCond_FirstUseEver);
+	if (ImGui::Begin("Render Pipeline 2D Benchmark"))
+	{
+		DYE::ImGuiUtil::DrawIntControl("Sprites", m_NumberOfSprites);
+		if (m_NumberOfSprites < 1)
+		{
+			m_NumberOfSprites = 1;
+		}
+
+		if (ImGui::Button("Submit & Render Sprites"))
+		{
+			lastRenderPipeline2DBenchmarkResult = runRenderPipeline2DBenchmark(m_NumberOfSprites);
+		}
+
+		auto const &result = lastRenderPipeline2DBenchmarkResult;
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Benchmarked Sprites", std::to_string(result.NumberOfSprites));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Submit (ms)", std::to_string(result.SubmitMilliseconds));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Sort & Render (ms)", std::to_string(result.RenderMilliseconds));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Draw Calls", std::to_string(result.NumberOfDrawCalls));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Uniform Uploads", std::to_string(result.NumberOfUniformUploads));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Texture Binds", std::to_string(result.NumberOfTextureBinds));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Render State Changes", std::to_string(result.NumberOfRenderStateChanges));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Recorded Commands", std::to_string(result.NumberOfRecordedCommands));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Elided State Changes", std::to_string(result.StateCacheStatistics.NumberOfElidedRenderStateChanges));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Elided Shader Binds", std::to_string(result.StateCacheStatistics.NumberOfElidedShaderProgramBinds));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Elided Texture Binds", std::to_string(result.StateCacheStatistics.NumberOfElidedTextureBinds));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Elided VAO Binds", std::to_string(result.StateCacheStatistics.NumberOfElidedVertexArrayBinds));
+	}
+
+	ImGui::End();
+}
+
+void TextureCookingBenchmarkSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
+{
+	std::filesystem::path const sourceFolderPath = "assets/Textures";
+	std::filesystem::path const cacheFolderPath = std::filesystem::temp_directory_path() / "DYEngineTextureCookingBenchmark";
+
+	std::error_code errorCode;
+	if (!std::filesystem::is_directory(sourceFolderPath, errorCode))
+	{
+		DYE_LOG("Texture cooking benchmark: cannot find \"%s\".", sourceFolderPath.string().c_str());
+		return;
+	}
+
+	std::array<DYE::CookedTextureFormat, 3> const formats = {DYE::CookedTextureFormat::RGBA8, DYE::CookedTextureFormat::BC1, DYE::CookedTextureFormat::BC3};
+	std::array<char const *, 3> const formatNames = {"RGBA8", "BC1", "BC3"};
+
+	for (auto const &directoryEntry: std::filesystem::directory_iterator(sourceFolderPath))
+	{
+		std::filesystem::path const &sourcePath = directoryEntry.path();
+		if (!directoryEntry.is_regular_file() || sourcePath.extension() != ".png")
+		{
+			continue;
+		}
+
+		DYE::Stopwatch stopwatch;
+		std::uint64_t decodedBytes = 0;
+		for (int i = 0; i < m_NumberOfIterations; i++)
+		{
+			auto const image = DYE::TextureCooker::DecodeSourceImage(sourcePath);
+			decodedBytes = image.has_value() ? image->Pixels.size() : 0;
+		}
+		double const decodeMilliseconds = stopwatch.GetElapsedMilliseconds() / m_NumberOfIterations;
+
+		DYE_LOG("Texture cooking benchmark \"%s\": decode %.3f ms, %llu bytes (single level RGBA8)",
+				sourcePath.filename().string().c_str(), decodeMilliseconds, (unsigned long long) decodedBytes);
+
+		for (std::size_t formatIndex = 0; formatIndex < formats.size(); formatIndex++)
+		{
+			DYE::TextureCookSettings const settings {.Format = formats[formatIndex], .GenerateMipmaps = true};
+
+			// Cook without the cache first to measure the cooking time, then cook to the cache for the loading test.
+			stopwatch.Restart();
+			auto const image = DYE::TextureCooker::DecodeSourceImage(sourcePath);
+			if (!image.has_value())
+			{
+				break;
+			}
+			DYE::CookedTexture const cookedTexture = DYE::TextureCooker::Cook(image.value(), settings);
+			double const cookMilliseconds = stopwatch.GetElapsedMilliseconds();
+
+			auto const cookedPath = DYE::TextureCooker::CookToCache(sourcePath, cacheFolderPath, settings);
+			if (!cookedPath.has_value())
+			{
+				continue;
+			}
+
+			stopwatch.Restart();
+			for (int i = 0; i < m_NumberOfIterations; i++)
+			{
+				auto const loadedCookedTexture = DYE::TextureCooker::ReadCookedTexture(cookedPath.value());
+			}
+			double const loadMilliseconds = stopwatch.GetElapsedMilliseconds() / m_NumberOfIterations;
+
+			DYE_LOG("\t%s: cook %.3f ms, load %.3f ms, %llu bytes (%zu mip levels)",
+					formatNames[formatIndex], cookMilliseconds, loadMilliseconds,
+					(unsigned long long) cookedTexture.Data.size(), cookedTexture.MipLevels.size());
+		}
+	}
+}
+
+void ShaderBinaryCacheBenchmarkSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
+{
+	if (!DYE::IsOpenGLLoaded())
+	{
+		DYE_LOG("Shader binary cache benchmark is skipped in headless mode.");
+		return;
+	}
+
+	std::filesystem::path const shaderFolderPath = "assets/default";
+	std::error_code errorCode;
+	if (!std::filesystem::is_directory(shaderFolderPath, errorCode))
+	{
+		DYE_LOG("Shader binary cache benchmark: cannot find \"%s\".", shaderFolderPath.string().c_str());
+		return;
+	}
+
+	if (!DYE::ShaderProgramBinaryCache::IsAvailable())
+	{
+		DYE_LOG("Shader binary cache benchmark: the driver doesn't support program binaries.");
+		return;
+	}
+
+	std::vector<std::filesystem::path> shaderPaths;
+	for (auto const &directoryEntry: std::filesystem::directory_iterator(shaderFolderPath))
+	{
+		if (directoryEntry.is_regular_file() && directoryEntry.path().extension() == ".shader")
+		{
+			shaderPaths.push_back(directoryEntry.path());
+		}
+	}
+
+	// Use a separate cache directory so the benchmark doesn't wipe out the cache of the application.
+	std::filesystem::path const originalCacheDirectory = DYE::ShaderProgramBinaryCache::GetCacheDirectory();
+	DYE::ShaderProgramBinaryCache::SetCacheDirectory(std::filesystem::temp_directory_path() / "DYEngineShaderBinaryCacheBenchmark");
+	DYE::ShaderProgramBinaryCache::Clear();
+
+	auto createAllShaders = [&shaderPaths]()
+	{
+		DYE::Stopwatch const stopwatch;
+		for (auto const &shaderPath: shaderPaths)
+		{
+			auto const shaderProgram = DYE::ShaderProgram::CreateFromFile(shaderPath.stem().string(), shaderPath);
+		}
+		return stopwatch.GetElapsedMilliseconds();
+	};
+
+	DYE::ShaderProgramBinaryCache::ResetStatistics();
+	double const coldMilliseconds = createAllShaders();
+	DYE::ShaderProgramBinaryCacheStatistics const coldStatistics = DYE::ShaderProgramBinaryCache::GetStatistics();
+
+	DYE::ShaderProgramBinaryCache::ResetStatistics();
+	double const warmMilliseconds = createAllShaders();
+	DYE::ShaderProgramBinaryCacheStatistics const warmStatistics = DYE::ShaderProgramBinaryCache::GetStatistics();
+
+	DYE_LOG("Shader binary cache benchmark (%zu shaders): cold %.2f ms (%u hits, %u misses), warm %.2f ms (%u hits, %u misses)",
+			shaderPaths.size(),
+			coldMilliseconds, coldStatistics.NumberOfHits, coldStatistics.NumberOfMisses,
+			warmMilliseconds, warmStatistics.NumberOfHits, warmStatistics.NumberOfMisses);
+
+	DYE::ShaderProgramBinaryCache::Clear();
+	DYE::ShaderProgramBinaryCache::SetCacheDirectory(originalCacheDirectory);
+	DYE::ShaderProgramBinaryCache::ResetStatistics();
+}
+
+void EntityCreationBenchmarkImGuiSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
+{
+	ImGui::SetNextWindowSize({350, 200}, ImGuiCond_FirstUseEver);
+	if (ImGui::Begin("Entity Creation Benchmark"))
+	{
+		DYE::ImGuiUtil::DrawIntControl("Entities", m_NumberOfEntities);
+		if (m_NumberOfEntities < 1)
+		{
+			m_NumberOfEntities = 1;
+		}
+
+		if (ImGui::Button("Create Entities"))
+		{
+			DYE::Stopwatch stopwatch;
+			{
+				DYE::DYEditor::World oneByOneWorld;
+				for (int i = 0; i < m_NumberOfEntities; i++)
+				{
+					DYE::DYEditor::Entity entity = oneByOneWorld.CreateEntity("Benchmark Entity");
+					entity.AddComponent<DYE::DYEditor::LocalTransformComponent>();
+				}
+				m_OneByOneMilliseconds = stopwatch.GetElapsedMilliseconds();
+			}
+
+			{
+				DYE::DYEditor::World bulkWorld;
+				DYE::DYEditor::EntityArchetype<DYE::DYEditor::LocalTransformComponent> const archetype {.Name = "Benchmark Entity"};
+
+				stopwatch.Restart();
+				bulkWorld.CreateEntities(m_NumberOfEntities, archetype);
+				m_BulkMilliseconds = stopwatch.GetElapsedMilliseconds();
+			}
+
+			DYE_LOG("Entity creation (%d entities): one by one %.3f ms, bulk %.3f ms",
+					m_NumberOfEntities, m_OneByOneMilliseconds, m_BulkMilliseconds);
+		}
+
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("One By One (ms)", std::to_string(m_OneByOneMilliseconds));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Bulk (ms)", std::to_string(m_BulkMilliseconds));
+	}
+
+	ImGui::End();
+}
+
+void WorldMemoryBenchmarkImGuiSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
+{
+	ImGui::SetNextWindowSize({350, 250}, ImGuiCond_FirstUseEver);
+	if (ImGui::Begin("World Memory Benchmark"))
+	{
+#if defined(DYE_LEAN_RUNTIME_WORLD) && defined(DYE_LEAN_RUNTIME_WORLD_WITHOUT_GUID_MAP)
+		char const *worldMode = "Lean Runtime (No GUID Map)";
+#elif defined(DYE_LEAN_RUNTIME_WORLD)
+		char const *worldMode = "Lean Runtime";
+#elif defined(DYE_EDITOR)
+		char const *worldMode = "Editor";
+#else
+		char const *worldMode = "Runtime";
+#endif
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("World Mode", worldMode);
+
+		DYE::ImGuiUtil::DrawIntControl("Entities", m_NumberOfEntities);
+		if (m_NumberOfEntities < 1)
+		{
+			m_NumberOfEntities = 1;
+		}
+
+		if (ImGui::Button("Measure World Memory"))
+		{
+			DYE::DYEditor::World memoryWorld;
+			memoryWorld.CreateEntities(m_NumberOfEntities, DYE::DYEditor::EntityArchetype<> {.Name = "Benchmark Entity"});
+			m_Statistics = memoryWorld.GetMemoryStatistics();
+
+			DYE_LOG("World memory (%s, %d entities): %.2f bytes per entity (handles %zu, GUID lookup %zu, built-in components %zu bytes)",
+					worldMode, m_NumberOfEntities, m_Statistics.GetBytesPerEntity(),
+					m_Statistics.EntityHandleBytes, m_Statistics.GUIDLookupBytes, m_Statistics.BuiltInComponentBytes);
+		}
+
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Entity Handles (bytes)", std::to_string(m_Statistics.EntityHandleBytes));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("GUID Lookup (bytes)", std::to_string(m_Statistics.GUIDLookupBytes));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Built-in Components (bytes)", std::to_string(m_Statistics.BuiltInComponentBytes));
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Bytes Per Entity", std::to_string(m_Statistics.GetBytesPerEntity()));
+	}
+
+	ImGui::End();
+}
+
+void PrimitiveTestBatchBenchmarkImGuiSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
+{
+	ImGui::SetNextWindowSize({500, 300}, ImGuiCond_FirstUseEver);
+	if (ImGui::Begin("Primitive Test Batch Benchmark"))
+	{
+		DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("SIMD Kernel", DYE::Math::GetSIMDBatchTestKernelName());
+		DYE::ImGuiUtil::DrawIntControl("Shapes", m_NumberOfShapes);
+		if (m_NumberOfShapes < 1)
+		{
+			m_NumberOfShapes = 1;
+		}
+
+		DYE::ImGuiUtil::DrawIntControl("Iterations", m_NumberOfIterations);
+		if (m_NumberOfIterations < 1)
+		{
+			m_NumberOfIterations = 1;
+		}
+
+		if (ImGui::Button("Run Primitive Tests"))
+		{
+			using namespace DYE::Math;
+
+			// The same shapes in AoS (for the one-pair functions) & SoA (for the batch functions).
+			std::mt19937 randomEngine(12345);
+			std::uniform_real_distribution<float> positionDistribution(-100.0f, 100.0f);
+			std::uniform_real_distribution<float> sizeDistribution(0.5f, 5.0f);
+
+			std::vector<AABB> aabbs;
+			std::vector<std::pair<glm::vec2, float>> circles;
+			AABBBatch2D aabbBatch;
+			CircleBatch2D circleBatch;
+			aabbs.reserve(m_NumberOfShapes);
+			circles.reserve(m_NumberOfShapes);
+			aabbBatch.Reserve(m_NumberOfShapes);
+			circleBatch.Reserve(m_NumberOfShapes);
+			for (int i = 0; i < m_NumberOfShapes; i++)
+			{
+				glm::vec3 const center {positionDistribution(randomEngine), positionDistribution(randomEngine), 0};
+				glm::vec3 const size {sizeDistribution(randomEngine), sizeDistribution(randomEngine), 1};
+				aabbs.push_back(AABB::CreateFromCenter(center, size));
+				aabbBatch.Add(aabbs.back());
+
+				circles.emplace_back(glm::vec2 {positionDistribution(randomEngine), positionDistribution(randomEngine)}, sizeDistribution(randomEngine));
+				circleBatch.Add(circles.back().first, circles.back().second);
+			}
+
+			std::vector<std::uint8_t> hits(m_NumberOfShapes);
+			std::vector<float> hitTimes(m_NumberOfShapes);
+
+			AABB const queryAABB = AABB::CreateFromCenter({0, 0, 0}, {20, 20, 1});
+			glm::vec2 const queryCenter {10, -10};
+			float const queryRadius = 15.0f;
+			glm::vec2 const rayOrigin {-100, -50};
+			glm::vec2 const rayDirection {200, 100};
+			glm::vec2 const moveDirection {60, 30};
+
+			auto measure = [this](char const *testName, auto onePairTest, auto batchTest)
+			{
+				Result result {.TestName = testName};
+				result.OnePairMilliseconds = measurePrimitiveTest(m_NumberOfIterations, result.NumberOfHits[0], onePairTest);
+				result.ScalarBatchMilliseconds = measurePrimitiveTest(m_NumberOfIterations, result.NumberOfHits[1], [&batchTest]() { return batchTest(BatchTestKernel::Scalar); });
+				result.SIMDBatchMilliseconds = measurePrimitiveTest(m_NumberOfIterations, result.NumberOfHits[2], [&batchTest]() { return batchTest(BatchTestKernel::SIMD); });
+
+				DYE_LOG("%s (%d shapes x %d iterations): one pair %.3f ms, scalar batch %.3f ms, SIMD batch %.3f ms",
+						testName, m_NumberOfShapes, m_NumberOfIterations,
+						result.OnePairMilliseconds, result.ScalarBatchMilliseconds, result.SIMDBatchMilliseconds);
+				m_Results.push_back(result);
+			};
+
+			m_Results.clear();
+			measure
+				(
+					"AABB AABB",
+					[&]()
+					{
+						std::size_t numberOfHits = 0;
+						for (AABB const &aabb: aabbs) numberOfHits += AABBAABBIntersect2D(queryAABB, aabb) ? 1 : 0;
+						return numberOfHits;
+					},
+					[&](BatchTestKernel kernel) { return AABBAABBIntersect2D(queryAABB, aabbBatch, hits, kernel); }
+				);
+			measure
+				(
+					"AABB Circle",
+					[&]()
+					{
+						std::size_t numberOfHits = 0;
+						for (AABB const &aabb: aabbs) numberOfHits += AABBCircleIntersect(aabb, queryCenter, queryRadius) ? 1 : 0;
+						return numberOfHits;
+					},
+					[&](BatchTestKernel kernel) { return AABBCircleIntersect(aabbBatch, queryCenter, queryRadius, hits, kernel); }
+				);
+			measure
+				(
+					"Circle Circle",
+					[&]()
+					{
+						std::size_t numberOfHits = 0;
+						for (auto const &[center, radius]: circles) numberOfHits += CircleCircleIntersect(queryCenter, queryRadius, center, radius) ? 1 : 0;
+						return numberOfHits;
+					},
+					[&](BatchTestKernel kernel) { return CircleCircleIntersect(queryCenter, queryRadius, circleBatch, hits, kernel); }
+				);
+			measure
+				(
+					"Ray AABB",
+					[&]()
+					{
+						std::size_t numberOfHits = 0;
+						DynamicTestResult2D testResult;
+						for (AABB const &aabb: aabbs) numberOfHits += RayAABBIntersect2D(rayOrigin, rayDirection, 1.0f, aabb, testResult) ? 1 : 0;
+						return numberOfHits;
+					},
+					[&](BatchTestKernel kernel) { return RayAABBIntersect2D(rayOrigin, rayDirection, 1.0f, aabbBatch, hits, hitTimes, kernel); }
+				);
+			measure
+				(
+					"Ray Circle",
+					[&]()
+					{
+						std::size_t numberOfHits = 0;
+						DynamicTestResult2D testResult;
+						for (auto const &[center, radius]: circles) numberOfHits += RayCircleIntersect(rayOrigin, rayDirection, center, radius, testResult) ? 1 : 0;
+						return numberOfHits;
+					},
+					[&](BatchTestKernel kernel) { return RayCircleIntersect(rayOrigin, rayDirection, circleBatch, hits, hitTimes, kernel); }
+				);
+			measure
+				(
+					"Moving AABB AABB",
+					[&]()
+					{
+						std::size_t numberOfHits = 0;
+						DynamicTestResult2D testResult;
+						for (AABB const &aabb: aabbs) numberOfHits += MovingAABBAABBIntersect2D(queryAABB, moveDirection, aabb, testResult) ? 1 : 0;
+						return numberOfHits;
+					},
+					[&](BatchTestKernel kernel) { return MovingAABBAABBIntersect2D(queryAABB, moveDirection, 1.0f, aabbBatch, hits, hitTimes, kernel); }
+				);
+			measure
+				(
+					"Moving Circle AABB",
+					[&]()
+					{
+						std::size_t numberOfHits = 0;
+						DynamicTestResult2D testResult;
+						for (AABB const &aabb: aabbs) numberOfHits += MovingCircleAABBIntersect(queryCenter, queryRadius, moveDirection, aabb, testResult) ? 1 : 0;
+						return numberOfHits;
+					},
+					[&](BatchTestKernel kernel) { return MovingCircleAABBIntersect(queryCenter, queryRadius, moveDirection, 1.0f, aabbBatch, hits, hitTimes, kernel); }
+				);
+		}
+
+		if (ImGui::BeginTable("Primitive Test Results", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+		{
+			ImGui::TableSetupColumn("Test");
+			ImGui::TableSetupColumn("One Pair (ms)");
+			ImGui::TableSetupColumn("Scalar Batch (ms)");
+			ImGui::TableSetupColumn("SIMD Batch (ms)");
+			ImGui::TableSetupColumn("Hits");
+			ImGui::TableHeadersRow();
+
+			for (Result const &result: m_Results)
+			{
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(result.TestName);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", result.OnePairMilliseconds);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", result.ScalarBatchMilliseconds);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", result.SIMDBatchMilliseconds);
+				ImGui::TableNextColumn();
+				ImGui::Text("%zu / %zu / %zu", result.NumberOfHits[0], result.NumberOfHits[1], result.NumberOfHits[2]);
+			}
+
+			ImGui::EndTable();
+		}
+	}
+
+	ImGui::End();
+}
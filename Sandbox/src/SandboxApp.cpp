@@ -30,11 +30,25 @@ DYE::Application * DYE::CreateApplication()
 {
     //return new Sandbox::SandboxApp { "Sandbox", 60 };
 	ProjectConfig &runtimeConfig = DYEditor::GetRuntimeConfig();
+	if (runtimeConfig.GetOrDefault<bool>(RuntimeConfigKeys::HeadlessEnabled, false))
+	{
+		return new DYEditorApplication
+		{
+			HeadlessRunProperties
+			{
+				.MaxNumberOfFrames = (std::uint64_t) runtimeConfig.GetOrDefault<int>(RuntimeConfigKeys::HeadlessMaxFrames, 0),
+				.MaxDurationInSeconds = runtimeConfig.GetOrDefault<float>(RuntimeConfigKeys::HeadlessMaxSeconds, 0.0f),
+				.UseFixedDeltaTime = runtimeConfig.GetOrDefault<bool>(RuntimeConfigKeys::HeadlessUseFixedDeltaTime, true)
+			},
+			60
+		};
+	}
+
 	auto projectName = runtimeConfig.GetOrDefault<std::string>(RuntimeConfigKeys::ProjectName, "Sandbox");
 	auto mainWindowWidth = runtimeConfig.GetOrDefault<int>(RuntimeConfigKeys::MainWindowWidth, 1600);
 	auto mainWindowHeight = runtimeConfig.GetOrDefault<int>(RuntimeConfigKeys::MainWindowHeight, 900);
 
-	return new DYEditorApplication
+	auto *pApplication = new DYEditorApplication
 	{
 		WindowProperties
 		{
@@ -44,4 +58,7 @@ DYE::Application * DYE::CreateApplication()
 		},
 		60
 	};
+	pApplication->SetThreadedRendering(runtimeConfig.GetOrDefault<bool>(RuntimeConfigKeys::ThreadedRendering, false));
+
+	return pApplication;
 }
@@ -131,12 +131,12 @@ namespace DYE::Sandbox
 		if (glm::abs(moveOffset.x) > 0)
 		{
 			// Horizontal collision test
-			auto hits = m_StaticColliderManager.AABBCastAll(playerAABB, glm::vec3 {horizontalDirectionSign * horizontalMoveOffset, 0, 0});
+			auto const hit = m_StaticColliderManager.AABBCastClosest(playerAABB, glm::vec3 {horizontalDirectionSign * horizontalMoveOffset, 0, 0});
 
-			bool const hitHorizontally = !hits.empty();
+			bool const hitHorizontally = hit.has_value();
 			if (hitHorizontally)
 			{
-				horizontalMoveOffset *= hits[0].Time;
+				horizontalMoveOffset *= hit->Time;
 				horizontalMoveOffset -= m_PlayerSkin;
 			}
 		}
@@ -144,12 +144,12 @@ namespace DYE::Sandbox
 		if (glm::abs(moveOffset.y) > 0)
 		{
 			// Vertical collision test
-			auto hits = m_StaticColliderManager.AABBCastAll(playerAABB, glm::vec3 {0, verticalDirectionSign * verticalMoveOffset, 0});
+			auto const hit = m_StaticColliderManager.AABBCastClosest(playerAABB, glm::vec3 {0, verticalDirectionSign * verticalMoveOffset, 0});
 
-			bool const hitVertically = !hits.empty();
+			bool const hitVertically = hit.has_value();
 			if (hitVertically)
 			{
-				verticalMoveOffset *= hits[0].Time;;
+				verticalMoveOffset *= hit->Time;
 				verticalMoveOffset -= m_PlayerSkin;
 
 				// Hit the ground, set vertical velocity to zero.
@@ -160,11 +160,11 @@ namespace DYE::Sandbox
 		moveOffset = {horizontalDirectionSign * horizontalMoveOffset, verticalDirectionSign * verticalMoveOffset, 0};
 		if (glm::length2(moveOffset) > 0)
 		{
-			auto hits = m_StaticColliderManager.AABBCastAll(playerAABB, moveOffset);
+			auto const hit = m_StaticColliderManager.AABBCastClosest(playerAABB, moveOffset);
 
-			if (!hits.empty())
+			if (hit.has_value())
 			{
-				moveOffset *= hits[0].Time;
+				moveOffset *= hit->Time;
 				moveOffset -= glm::vec3 {horizontalDirectionSign * m_PlayerSkin, verticalDirectionSign * m_PlayerSkin, 0};
 			}
 		}
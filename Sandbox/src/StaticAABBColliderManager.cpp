@@ -10,10 +10,60 @@
 
 namespace DYE::Sandbox
 {
-	ColliderID StaticAABBColliderManager::RegisterAABB(Math::AABB aabb)
+	namespace
+	{
+		/// Insert the hit into the hits (sorted by time), the farthest hit is dropped if the hits are full.
+		/// \return the new number of hits.
+		std::size_t insertHitSortedByTime(std::span<RaycastHit2D> hits, std::size_t numberOfHits, RaycastHit2D const& hit)
+		{
+			if (numberOfHits == hits.size())
+			{
+				if (hits[numberOfHits - 1].Time <= hit.Time)
+				{
+					return numberOfHits;
+				}
+
+				// Drop the farthest hit to make space for the new one.
+				numberOfHits--;
+			}
+
+			std::size_t index = numberOfHits;
+			while (index > 0 && hits[index - 1].Time > hit.Time)
+			{
+				hits[index] = hits[index - 1];
+				index--;
+			}
+
+			hits[index] = hit;
+			return numberOfHits + 1;
+		}
+
+		/// Once the hits are full, a collider is only worth testing if it can be hit before the farthest kept hit.
+		float getHitTimeLimit(std::span<RaycastHit2D> hits, std::size_t numberOfHits, float maxTime)
+		{
+			if (numberOfHits < hits.size())
+			{
+				return maxTime;
+			}
+
+			return std::min(hits[numberOfHits - 1].Time, maxTime);
+		}
+
+		RaycastHit2D createHit(ColliderID id, Math::DynamicTestResult2D const& testResult)
+		{
+			return RaycastHit2D { .ColliderID = id, .Time = testResult.HitTime, .Centroid = testResult.HitCentroid, .Point = testResult.HitPoint, .Normal = testResult.HitNormal };
+		}
+
+		void sortHitsByTime(std::vector<RaycastHit2D>& hits)
+		{
+			std::sort(hits.begin(), hits.end(), [](RaycastHit2D const& hitA, RaycastHit2D const& hitB) { return hitA.Time < hitB.Time; });
+		}
+	}
+
+	ColliderID StaticAABBColliderManager::RegisterAABB(Math::AABB aabb, ColliderLayerMask layers)
 	{
 		ColliderID const id = m_AABBIdCounter;
-		m_AABBs.emplace_back(id, aabb);
+		m_AABBs.push_back(StaticAABBCollider { .ID = id, .AABB = aabb, .Layers = layers });
 		m_AABBIdCounter++;
 		return id;
 	}
@@ -43,7 +93,7 @@ namespace DYE::Sandbox
 			return {};
 		}
 
-		return m_AABBs[index].second;
+		return m_AABBs[index].AABB;
 	}
 
 	bool StaticAABBColliderManager::SetAABB(ColliderID id, Math::AABB aabb)
@@ -54,113 +104,322 @@ namespace DYE::Sandbox
 			return false;
 		}
 
-		m_AABBs[index].second = aabb;
+		m_AABBs[index].AABB = aabb;
 		return true;
 	}
 
-	std::vector<ColliderID> StaticAABBColliderManager::OverlapAABB(Math::AABB aabb) const
+	bool StaticAABBColliderManager::SetLayers(ColliderID id, ColliderLayerMask layers)
+	{
+		int const index = binarySearchIndexOf(m_AABBs, id);
+		if (index == -1)
+		{
+			return false;
+		}
+
+		m_AABBs[index].Layers = layers;
+		return true;
+	}
+
+	std::vector<ColliderID> StaticAABBColliderManager::OverlapAABB(Math::AABB aabb, ColliderLayerMask layerMask) const
 	{
 		std::vector<ColliderID> overlappedIds;
 
 		// TODO: improve the performance with AABB tree OR grid broad-phase
-		for (auto const& pair : m_AABBs)
+		for (auto const& collider : m_AABBs)
 		{
-			bool const intersect = Math::AABBAABBIntersect2D(pair.second, aabb);
-			if (intersect)
+			if ((collider.Layers & layerMask) != 0 && Math::AABBAABBIntersect2D(collider.AABB, aabb))
 			{
-				overlappedIds.push_back(pair.first);
+				overlappedIds.push_back(collider.ID);
 			}
 		}
 
 		return std::move(overlappedIds);
 	}
 
-	std::vector<ColliderID> StaticAABBColliderManager::OverlapCircle(glm::vec2 center, float radius) const
+	std::vector<ColliderID> StaticAABBColliderManager::OverlapCircle(glm::vec2 center, float radius, ColliderLayerMask layerMask) const
 	{
 		std::vector<ColliderID> overlappedIds;
 
 		// TODO: improve the performance with AABB tree OR grid broad-phase
-		for (auto const& pair : m_AABBs)
+		for (auto const& collider : m_AABBs)
 		{
-			bool const intersect = Math::AABBCircleIntersect(pair.second, center, radius);
-			if (intersect)
+			if ((collider.Layers & layerMask) != 0 && Math::AABBCircleIntersect(collider.AABB, center, radius))
 			{
-				overlappedIds.push_back(pair.first);
+				overlappedIds.push_back(collider.ID);
 			}
 		}
 
 		return std::move(overlappedIds);
 	}
 
-	std::vector<RaycastHit2D> StaticAABBColliderManager::RaycastAll(glm::vec2 start, glm::vec2 end) const
+	// The *All functions that return a vector keep every hit, so they collect the hits unsorted and sort them once at the end,
+	// instead of keeping the hits sorted like the span versions do.
+
+	std::vector<RaycastHit2D> StaticAABBColliderManager::RaycastAll(glm::vec2 start, glm::vec2 end, ColliderLayerMask layerMask) const
 	{
 		std::vector<RaycastHit2D> hits;
 
+		// The hit times are normalized by the direction, the segment from start to end is [0, 1].
 		glm::vec2 const direction = end - start;
-		float const maxDistance = glm::length(direction);
 
 		// TODO: improve the performance with AABB tree OR grid broad-phase
-		for (auto const& pair : m_AABBs)
+		for (auto const& collider : m_AABBs)
 		{
+			if ((collider.Layers & layerMask) == 0)
+			{
+				continue;
+			}
+
 			Math::DynamicTestResult2D testResult;
-			bool const intersect = Math::RayAABBIntersect2D(start, direction, maxDistance, pair.second, testResult);
+			bool const intersect = Math::RayAABBIntersect2D(start, direction, 1.0f, collider.AABB, testResult);
 			if (intersect)
 			{
-				hits.push_back(RaycastHit2D { .ColliderID = pair.first, .Time = testResult.HitTime, .Centroid = testResult.HitCentroid, .Point = testResult.HitPoint, .Normal = testResult.HitNormal });
+				hits.push_back(createHit(collider.ID, testResult));
 			}
 		}
 
-		std::sort(hits.begin(), hits.end(), [](RaycastHit2D const& hitA, RaycastHit2D const& hitB) { return hitA.Time < hitB.Time; });
-
+		sortHitsByTime(hits);
 		return std::move(hits);
-
 	}
 
-	std::vector<RaycastHit2D> StaticAABBColliderManager::CircleCastAll(glm::vec2 center, float radius, glm::vec2 direction) const
+	std::vector<RaycastHit2D> StaticAABBColliderManager::CircleCastAll(glm::vec2 center, float radius, glm::vec2 direction, ColliderLayerMask layerMask) const
 	{
 		std::vector<RaycastHit2D> hits;
 
 		// TODO: improve the performance with AABB tree OR grid broad-phase
-		for (auto const& pair : m_AABBs)
+		for (auto const& collider : m_AABBs)
 		{
+			if ((collider.Layers & layerMask) == 0)
+			{
+				continue;
+			}
+
 			Math::DynamicTestResult2D testResult;
-			bool const intersect = Math::MovingCircleAABBIntersect(center, radius, direction, pair.second, testResult);
+			bool const intersect = Math::MovingCircleAABBIntersect(center, radius, direction, collider.AABB, testResult);
 			if (intersect)
 			{
-				hits.push_back(RaycastHit2D { .ColliderID = pair.first, .Time = testResult.HitTime, .Centroid = testResult.HitCentroid, .Point = testResult.HitPoint, .Normal = testResult.HitNormal });
+				hits.push_back(createHit(collider.ID, testResult));
 			}
 		}
 
-		std::sort(hits.begin(), hits.end(), [](RaycastHit2D const& hitA, RaycastHit2D const& hitB) { return hitA.Time < hitB.Time; });
-
+		sortHitsByTime(hits);
 		return std::move(hits);
 	}
 
-	std::vector<RaycastHit2D> StaticAABBColliderManager::AABBCastAll(Math::AABB aabb, glm::vec2 direction) const
+	std::vector<RaycastHit2D> StaticAABBColliderManager::AABBCastAll(Math::AABB aabb, glm::vec2 direction, ColliderLayerMask layerMask) const
 	{
 		std::vector<RaycastHit2D> hits;
 
 		// TODO: improve the performance with AABB tree OR grid broad-phase
-		for (auto const& pair : m_AABBs)
+		for (auto const& collider : m_AABBs)
 		{
+			if ((collider.Layers & layerMask) == 0)
+			{
+				continue;
+			}
+
 			Math::DynamicTestResult2D testResult;
-			bool const intersect = Math::MovingAABBAABBIntersect2D(aabb, direction, pair.second, testResult);
+			bool const intersect = Math::MovingAABBAABBIntersect2D(aabb, direction, collider.AABB, testResult);
 			if (intersect)
 			{
-				hits.push_back(RaycastHit2D { .ColliderID = pair.first, .Time = testResult.HitTime, .Centroid = testResult.HitCentroid, .Point = testResult.HitPoint, .Normal = testResult.HitNormal });
+				hits.push_back(createHit(collider.ID, testResult));
 			}
 		}
 
-		std::sort(hits.begin(), hits.end(), [](RaycastHit2D const& hitA, RaycastHit2D const& hitB) { return hitA.Time < hitB.Time; });
-
+		sortHitsByTime(hits);
 		return std::move(hits);
 	}
 
+	std::size_t StaticAABBColliderManager::OverlapAABB(Math::AABB aabb, std::span<ColliderID> outIDs, ColliderLayerMask layerMask) const
+	{
+		std::size_t numberOfOverlaps = 0;
+
+		// TODO: improve the performance with AABB tree OR grid broad-phase
+		for (auto const& collider : m_AABBs)
+		{
+			if (numberOfOverlaps == outIDs.size())
+			{
+				break;
+			}
+
+			if ((collider.Layers & layerMask) == 0)
+			{
+				continue;
+			}
+
+			bool const intersect = Math::AABBAABBIntersect2D(collider.AABB, aabb);
+			if (intersect)
+			{
+				outIDs[numberOfOverlaps] = collider.ID;
+				numberOfOverlaps++;
+			}
+		}
+
+		return numberOfOverlaps;
+	}
+
+	std::size_t StaticAABBColliderManager::OverlapCircle(glm::vec2 center, float radius, std::span<ColliderID> outIDs, ColliderLayerMask layerMask) const
+	{
+		std::size_t numberOfOverlaps = 0;
+
+		// TODO: improve the performance with AABB tree OR grid broad-phase
+		for (auto const& collider : m_AABBs)
+		{
+			if (numberOfOverlaps == outIDs.size())
+			{
+				break;
+			}
+
+			if ((collider.Layers & layerMask) == 0)
+			{
+				continue;
+			}
+
+			bool const intersect = Math::AABBCircleIntersect(collider.AABB, center, radius);
+			if (intersect)
+			{
+				outIDs[numberOfOverlaps] = collider.ID;
+				numberOfOverlaps++;
+			}
+		}
+
+		return numberOfOverlaps;
+	}
+
+	std::size_t StaticAABBColliderManager::RaycastAll(glm::vec2 start, glm::vec2 end, std::span<RaycastHit2D> outHits, ColliderLayerMask layerMask) const
+	{
+		if (outHits.empty())
+		{
+			return 0;
+		}
+
+		std::size_t numberOfHits = 0;
+
+		// The hit times are normalized by the direction, the segment from start to end is [0, 1].
+		glm::vec2 const direction = end - start;
+
+		// TODO: improve the performance with AABB tree OR grid broad-phase
+		for (auto const& collider : m_AABBs)
+		{
+			if ((collider.Layers & layerMask) == 0)
+			{
+				continue;
+			}
+
+			// The ray test exits as soon as the slab interval goes beyond the time limit, so the colliders behind the kept hits are cheap to reject.
+			float const timeLimit = getHitTimeLimit(outHits, numberOfHits, 1.0f);
+
+			Math::DynamicTestResult2D testResult;
+			bool const intersect = Math::RayAABBIntersect2D(start, direction, timeLimit, collider.AABB, testResult);
+			if (intersect)
+			{
+				numberOfHits = insertHitSortedByTime(outHits, numberOfHits, createHit(collider.ID, testResult));
+			}
+		}
+
+		return numberOfHits;
+	}
+
+	std::size_t StaticAABBColliderManager::CircleCastAll(glm::vec2 center, float radius, glm::vec2 direction, std::span<RaycastHit2D> outHits, ColliderLayerMask layerMask) const
+	{
+		if (outHits.empty())
+		{
+			return 0;
+		}
+
+		std::size_t numberOfHits = 0;
+
+		// TODO: improve the performance with AABB tree OR grid broad-phase
+		for (auto const& collider : m_AABBs)
+		{
+			if ((collider.Layers & layerMask) == 0)
+			{
+				continue;
+			}
+
+			// The test exits as soon as the circle cannot hit the collider before the farthest kept hit.
+			float const timeLimit = getHitTimeLimit(outHits, numberOfHits, 1.0f);
+
+			Math::DynamicTestResult2D testResult;
+			bool const intersect = Math::MovingCircleAABBIntersect(center, radius, direction, timeLimit, collider.AABB, testResult);
+			if (intersect)
+			{
+				numberOfHits = insertHitSortedByTime(outHits, numberOfHits, createHit(collider.ID, testResult));
+			}
+		}
+
+		return numberOfHits;
+	}
+
+	std::size_t StaticAABBColliderManager::AABBCastAll(Math::AABB aabb, glm::vec2 direction, std::span<RaycastHit2D> outHits, ColliderLayerMask layerMask) const
+	{
+		if (outHits.empty())
+		{
+			return 0;
+		}
+
+		std::size_t numberOfHits = 0;
+
+		// TODO: improve the performance with AABB tree OR grid broad-phase
+		for (auto const& collider : m_AABBs)
+		{
+			if ((collider.Layers & layerMask) == 0)
+			{
+				continue;
+			}
+
+			// The test exits as soon as the AABB cannot hit the collider before the farthest kept hit.
+			float const timeLimit = getHitTimeLimit(outHits, numberOfHits, 1.0f);
+
+			Math::DynamicTestResult2D testResult;
+			bool const intersect = Math::MovingAABBAABBIntersect2D(aabb, direction, timeLimit, collider.AABB, testResult);
+			if (intersect)
+			{
+				numberOfHits = insertHitSortedByTime(outHits, numberOfHits, createHit(collider.ID, testResult));
+			}
+		}
+
+		return numberOfHits;
+	}
+
+	std::optional<RaycastHit2D> StaticAABBColliderManager::RaycastClosest(glm::vec2 start, glm::vec2 end, ColliderLayerMask layerMask) const
+	{
+		RaycastHit2D hit;
+		if (RaycastAll(start, end, std::span<RaycastHit2D>(&hit, 1), layerMask) == 0)
+		{
+			return {};
+		}
+
+		return hit;
+	}
+
+	std::optional<RaycastHit2D> StaticAABBColliderManager::CircleCastClosest(glm::vec2 center, float radius, glm::vec2 direction, ColliderLayerMask layerMask) const
+	{
+		RaycastHit2D hit;
+		if (CircleCastAll(center, radius, direction, std::span<RaycastHit2D>(&hit, 1), layerMask) == 0)
+		{
+			return {};
+		}
+
+		return hit;
+	}
+
+	std::optional<RaycastHit2D> StaticAABBColliderManager::AABBCastClosest(Math::AABB aabb, glm::vec2 direction, ColliderLayerMask layerMask) const
+	{
+		RaycastHit2D hit;
+		if (AABBCastAll(aabb, direction, std::span<RaycastHit2D>(&hit, 1), layerMask) == 0)
+		{
+			return {};
+		}
+
+		return hit;
+	}
+
 	void StaticAABBColliderManager::DrawGizmos() const
 	{
-		for (auto const& pair : m_AABBs)
+		for (auto const& collider : m_AABBs)
 		{
-			DebugDraw::AABB(pair.second.Min, pair.second.Max, Color::Blue);
+			DebugDraw::AABB(collider.AABB.Min, collider.AABB.Max, Color::Blue);
 		}
 	}
 
@@ -168,24 +427,24 @@ namespace DYE::Sandbox
 	{
 		if (ImGui::Begin("Collider Manager"))
 		{
-			for (auto& aabbPair : m_AABBs)
+			for (auto& collider : m_AABBs)
 			{
-				std::string const label = "AABB " + std::to_string(aabbPair.first);
-				ImGuiUtil::DrawAABBControl(label, aabbPair.second);
+				std::string const label = "AABB " + std::to_string(collider.ID);
+				ImGuiUtil::DrawAABBControl(label, collider.AABB);
 			}
 		}
 
 		ImGui::End();
 	}
 
-	int StaticAABBColliderManager::binarySearchIndexOf(std::vector<std::pair<ColliderID, Math::AABB>> const& collection, ColliderID id) const
+	int StaticAABBColliderManager::binarySearchIndexOf(std::vector<StaticAABBCollider> const& collection, ColliderID id) const
 	{
 		int left = 0;
 		int right = m_AABBs.size() - 1;
 		while (left <= right)
 		{
 			int const mid = left + (right - left) / 2;
-			ColliderID const midId = m_AABBs[mid].first;
+			ColliderID const midId = m_AABBs[mid].ID;
 
 			if (midId == id)
 			{
@@ -52,9 +52,7 @@ void ImGuiSystem1::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecutePa
 
 void RotateHasAngularVelocitySystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor::ExecuteParameters params)
 {
-	auto view = world.GetRegistry().view<HasAngularVelocity, DYE::DYEditor::LocalTransformComponent>();
-
-	for (auto&& [entity, hasAngularVelocity, transform] : view.each())
+	for (auto&& [entity, hasAngularVelocity, transform] : m_Query.Get(world).each())
 	{
 		float const radianZ = glm::radians(DYE::TIME.DeltaTime() * hasAngularVelocity.AngleDegreePerSecond);
 		transform.Rotation *= glm::quat(glm::vec3{0, 0, radianZ});
@@ -91,7 +89,7 @@ void PrintMessageOnTeardownSystem::Execute(DYE::DYEditor::World &world, DYE::DYE
 
 	for (auto&& [entity, name, message] : view.each())
 	{
-		DYE_LOG("%s: %s\n", name.Name.c_str(), message.Message.c_str());
+		DYE_LOG("%s: %s\n", name.Name.GetString().c_str(), message.Message.c_str());
 	}
 }
 
@@ -126,7 +124,7 @@ void GetViewTestImGuiSystem::Execute(DYE::DYEditor::World &world, DYE::DYEditor:
 		{
 			auto& nameComponent = viewWithExclude.get<DYE::DYEditor::NameComponent>(entity);
 			auto& localTransformComponent = viewWithExclude.get<DYE::DYEditor::LocalTransformComponent>(entity);
-			DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Name", nameComponent.Name);
+			DYE::ImGuiUtil::DrawReadOnlyTextWithLabel("Name", nameComponent.Name.GetString());
 			DYE::DebugDraw::Sphere(localTransformComponent.Position, 0.5f, DYE::Color::White);
 			count++;
 		}